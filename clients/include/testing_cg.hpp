@@ -27,7 +27,11 @@
 
 #include "utility.hpp"
 
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
 #include <rocalution.hpp>
+#include <string>
 
 using namespace rocalution;
 
@@ -122,16 +126,28 @@ bool testing_cg(Arguments argus)
         p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "SGS")
         p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SSOR")
+        p = new SSOR<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILU")
         p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILUT")
         p = new ILUT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "IC")
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "ICT")
+        p = new ICT<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCGS")
         p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCSGS")
         p = new MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCSGS-Stream")
+    {
+        MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>* mcsgs
+            = new MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>;
+        mcsgs->SetStreamingSweeps(true);
+
+        p = mcsgs;
+    }
     else if(precond == "MCILU")
         p = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
     else
@@ -173,4 +189,202 @@ bool testing_cg(Arguments argus)
     return success;
 }
 
+template <typename T>
+bool testing_cg_checkpoint(void)
+{
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(31, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    x.Zeros();
+
+    std::string state = "cg_checkpoint.state";
+
+    // Interrupted solve, the last checkpoint is written at iteration 20
+    CG<LocalMatrix<T>, LocalVector<T>, T> ls;
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.Init(1e-8, 0.0, 1e+8, 27);
+    ls.SetCheckpoint(state, 10);
+    ls.Build();
+
+    ls.Solve(b, &x);
+
+    // Resume from the checkpoint with another solver
+    CG<LocalMatrix<T>, LocalVector<T>, T> rs;
+
+    rs.Verbose(0);
+    rs.SetOperator(A);
+    rs.Init(1e-8, 0.0, 1e+8, 10000);
+    rs.Build();
+
+    rs.LoadState(state, &x);
+    rs.Solve(b, &x);
+
+    bool success = (rs.GetIterationCount() > 20);
+
+    // Verify solution
+    x.ScaleAdd(-1.0, e);
+    T nrm2 = x.Norm();
+
+    success = success && check_residual(nrm2);
+
+    // No temporary files are left behind
+    std::ifstream tmp_state((state + ".tmp").c_str());
+    std::ifstream tmp_x((state + ".x.tmp").c_str());
+
+    success = success && !tmp_state.is_open() && !tmp_x.is_open();
+
+    // A state written by another version is rejected
+    {
+        std::fstream file(state.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+
+        std::string header;
+        std::getline(file, header);
+
+        int version = -1;
+        file.seekp(file.tellg());
+        file.write((char*)&version, sizeof(int));
+        file.close();
+
+        EXPECT_DEATH(rs.LoadState(state, &x), ".*");
+    }
+
+    // Clean up
+    ls.Clear();
+    rs.Clear();
+
+    std::remove(state.c_str());
+    std::remove((state + ".x").c_str());
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_cg_async_build(void)
+{
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(4);
+
+    // The build task and the caller use fewer threads than the reference solver
+    set_omp_reproducible_rocalution(true);
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(63, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Allocate x, b and e
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // Reference solve, with a synchronous build
+    LocalVector<T> x_ref;
+    x_ref.Allocate("x_ref", A.GetN());
+    x_ref.Zeros();
+
+    ILU<LocalMatrix<T>, LocalVector<T>, T> p_ref;
+    CG<LocalMatrix<T>, LocalVector<T>, T>  ls_ref;
+
+    p_ref.Set(1);
+
+    ls_ref.Verbose(0);
+    ls_ref.SetOperator(A);
+    ls_ref.SetPreconditioner(p_ref);
+    ls_ref.Init(1e-8, 0.0, 1e+8, 10000);
+    ls_ref.Build();
+
+    // Solver
+    ILU<LocalMatrix<T>, LocalVector<T>, T> p;
+    CG<LocalMatrix<T>, LocalVector<T>, T>  ls;
+
+    p.Set(1);
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.SetPreconditioner(p);
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+
+    // Without accelerator, the solver is built by a host task, while the caller sets up
+    // the right-hand side
+    ls.BuildMoveToAcceleratorAsync();
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    x.Zeros();
+
+    ls.Sync();
+
+    ls.Solve(b, &x);
+    ls_ref.Solve(b, &x_ref);
+
+    // The asynchronous build gives the same solver as the synchronous one
+    bool success = (ls.GetIterationCount() == ls_ref.GetIterationCount());
+
+    x_ref.ScaleAdd(-1.0, x);
+    success = success && (x_ref.Norm() == static_cast<T>(0));
+
+    // Verify solution
+    x.ScaleAdd(-1.0, e);
+    T nrm2 = x.Norm();
+
+    success = success && check_residual(nrm2);
+
+    // Clean up
+    ls.Clear();
+    ls_ref.Clear();
+
+    set_omp_reproducible_rocalution(false);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_CG_HPP
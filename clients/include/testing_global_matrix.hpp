@@ -375,4 +375,160 @@ void testing_global_matrix_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+void testing_global_matrix_overlap_bad_args(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    GlobalMatrix<T> mat;
+    LocalMatrix<T>  ext;
+    ParallelManager pm;
+
+    // ExtractOverlap
+    {
+        ASSERT_DEATH(mat.ExtractOverlap(-1, &pm, &ext), ".*Assertion.*overlap >= 0*");
+        ASSERT_DEATH(mat.ExtractOverlap(1, nullptr, &ext),
+                     ".*Assertion.*pm != (NULL|__null)*");
+        ASSERT_DEATH(mat.ExtractOverlap(1, &pm, nullptr),
+                     ".*Assertion.*ext != (NULL|__null)*");
+    }
+
+    // GlobalRAS
+    {
+        ILU<LocalMatrix<T>, LocalVector<T>, T>         ilu;
+        GlobalRAS<GlobalMatrix<T>, GlobalVector<T>, T> ras;
+
+        ASSERT_DEATH(ras.SetOverlap(-1), ".*Assertion.*overlap >= 0*");
+        ASSERT_DEATH(ras.Build(), ".*Assertion.*op_ != (NULL|__null)*");
+
+        ras.SetOperator(mat);
+
+        ASSERT_DEATH(ras.Build(), ".*Assertion.*local_precond_ != (NULL|__null)*");
+
+        ras.Set(ilu);
+
+        ASSERT_DEATH(ras.Set(ilu), ".*Assertion.*local_precond_ == (NULL|__null)*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+void testing_global_matrix_saamg_bad_args(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    GlobalMatrix<T> mat;
+    GlobalMatrix<T> pro;
+    GlobalMatrix<T> res;
+    GlobalMatrix<T> coarse;
+    ParallelManager pm;
+
+    // AMGSmoothedAggregation
+    {
+        GlobalMatrix<T>* null_mat = nullptr;
+        ParallelManager* null_pm  = nullptr;
+        ASSERT_DEATH(mat.AMGSmoothedAggregation(0.01, 0.5, null_pm, &pro, &res, &coarse),
+                     ".*Assertion.*pm != (NULL|__null)*");
+        ASSERT_DEATH(mat.AMGSmoothedAggregation(0.01, 0.5, &pm, null_mat, &res, &coarse),
+                     ".*Assertion.*prolong != (NULL|__null)*");
+        ASSERT_DEATH(mat.AMGSmoothedAggregation(0.01, 0.5, &pm, &pro, null_mat, &coarse),
+                     ".*Assertion.*restrict != (NULL|__null)*");
+        ASSERT_DEATH(mat.AMGSmoothedAggregation(0.01, 0.5, &pm, &pro, &res, null_mat),
+                     ".*Assertion.*coarse != (NULL|__null)*");
+    }
+
+    // TripleMatrixProduct
+    {
+        ASSERT_DEATH(coarse.TripleMatrixProduct(coarse, mat, pro), ".*Assertion.*this != &R*");
+        ASSERT_DEATH(coarse.TripleMatrixProduct(res, coarse, pro), ".*Assertion.*this != &A*");
+        ASSERT_DEATH(coarse.TripleMatrixProduct(res, mat, coarse), ".*Assertion.*this != &P*");
+    }
+
+    // GlobalSAAMG
+    {
+        GlobalSAAMG<GlobalMatrix<T>, GlobalVector<T>, T> amg;
+
+        ASSERT_DEATH(amg.Build(), ".*Assertion.*op_ != (NULL|__null)*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+void testing_global_matrix_agglomerate_bad_args(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    GlobalMatrix<T> mat;
+    GlobalMatrix<T> agg;
+    GlobalVector<T> vec;
+    ParallelManager pm;
+
+    // Agglomerate
+    {
+        GlobalMatrix<T>* null_mat = nullptr;
+        ParallelManager* null_pm  = nullptr;
+        ASSERT_DEATH(mat.Agglomerate(1, null_pm, &agg), ".*Assertion.*pm != (NULL|__null)*");
+        ASSERT_DEATH(mat.Agglomerate(1, &pm, null_mat), ".*Assertion.*agg != (NULL|__null)*");
+        ASSERT_DEATH(mat.Agglomerate(1, &pm, &mat), ".*Assertion.*agg != this*");
+    }
+
+    // GlobalAgglomeration
+    {
+        GlobalAgglomeration<GlobalMatrix<T>, GlobalVector<T>, T> ga;
+        CG<GlobalMatrix<T>, GlobalVector<T>, T>                  cg;
+        GlobalVector<T>*                                         null_vec = nullptr;
+
+        ASSERT_DEATH(ga.SetProcesses(0), ".*Assertion.*nprocs > 0*");
+        ASSERT_DEATH(ga.Build(), ".*Assertion.*op_ != (NULL|__null)*");
+        ASSERT_DEATH(ga.ReBuildNumeric(), ".*Assertion.*build_ == true*");
+        ASSERT_DEATH(ga.Solve(vec, null_vec), ".*Assertion.*x != (NULL|__null)*");
+        ASSERT_DEATH(ga.Solve(vec, &vec), ".*Assertion.*x != &rhs*");
+
+        ga.SetOperator(mat);
+        ga.SetProcesses(2);
+
+        // More than one process requires a solver for the agglomerated operator
+        ASSERT_DEATH(ga.Build(), ".*Assertion.*solver_ != (NULL|__null)*");
+    }
+
+    // SetAgglomerationSize
+    {
+        GlobalPairwiseAMG<GlobalMatrix<T>, GlobalVector<T>, T> pwamg;
+        GlobalSAAMG<GlobalMatrix<T>, GlobalVector<T>, T>       saamg;
+
+        ASSERT_DEATH(pwamg.SetAgglomerationSize(-1), ".*Assertion.*rows >= 0*");
+        ASSERT_DEATH(saamg.SetAgglomerationSize(-1), ".*Assertion.*rows >= 0*");
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+void testing_global_matrix_multinode_disabled(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Without multinode support, the global structures cannot be set up, thus the
+    // distributed AMG setup fails instead of building empty levels
+    ASSERT_EXIT({ ParallelManager pm; }, ::testing::ExitedWithCode(1), "");
+    ASSERT_EXIT({ GlobalMatrix<T> mat; }, ::testing::ExitedWithCode(1), "");
+    ASSERT_EXIT({ GlobalVector<T> vec; }, ::testing::ExitedWithCode(1), "");
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
 #endif // TESTING_GLOBAL_MATRIX_HPP
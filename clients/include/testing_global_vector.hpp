@@ -59,6 +59,13 @@ void testing_global_vector_bad_args(void)
         free_host(&data);
     }
 
+    // Gather / Scatter
+    {
+        GlobalVector<T> agg;
+        ASSERT_DEATH(agg.Gather(vec), ".*Assertion.*pm_ != (NULL|__null)*");
+        ASSERT_DEATH(vec.Scatter(agg), ".*Assertion.*pm_ != (NULL|__null)*");
+    }
+
     // Stop rocALUTION
     stop_rocalution();
 }
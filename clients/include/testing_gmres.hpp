@@ -113,6 +113,10 @@ bool testing_gmres(Arguments argus)
         p = new GS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "SGS")
         p = new SGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "SSOR")
+        p = new SSOR<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "Kaczmarz")
+        p = new Kaczmarz<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILU")
         p = new ILU<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "ILUT")
@@ -121,6 +125,15 @@ bool testing_gmres(Arguments argus)
         p = new IC<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCGS")
         p = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
+    else if(precond == "MCGS-Stream")
+    {
+        MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>* mcgs
+            = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
+        mcgs->SetStreamingSweeps(true);
+        mcgs->SetPrecondMatrixFormat(format);
+
+        p = mcgs;
+    }
     else if(precond == "MCSGS")
         p = new MultiColoredSGS<LocalMatrix<T>, LocalVector<T>, T>;
     else if(precond == "MCILU")
@@ -27,8 +27,12 @@
 
 #include "utility.hpp"
 
+#include <cmath>
 #include <gtest/gtest.h>
+#include <limits>
 #include <rocalution.hpp>
+#include <thread>
+#include <vector>
 
 using namespace rocalution;
 
@@ -339,4 +343,778 @@ void testing_local_matrix_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_local_matrix_residual_restrict(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(20, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> b;
+    LocalVector<T> x;
+    LocalVector<T> res;
+
+    b.Allocate("b", nrow);
+    x.Allocate("x", nrow);
+    res.Allocate("res", nrow);
+
+    b.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+    x.SetRandomUniform(67890ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    bool success = true;
+
+    // Aggregation with one entry per fine row, and a restriction with the same number of
+    // entries, where some fine rows have two entries and others none
+    for(int shared = 0; shared < 2; ++shared)
+    {
+        int ncoarse = nrow / 4;
+
+        int* r_ptr = NULL;
+        int* r_col = NULL;
+        T*   r_val = NULL;
+
+        allocate_host(ncoarse + 1, &r_ptr);
+        allocate_host(4 * ncoarse, &r_col);
+        allocate_host(4 * ncoarse, &r_val);
+
+        r_ptr[0] = 0;
+
+        for(int i = 0; i < ncoarse; ++i)
+        {
+            for(int k = 0; k < 4; ++k)
+            {
+                r_col[4 * i + k] = 4 * i + k;
+                r_val[4 * i + k] = static_cast<T>(k + 1);
+            }
+
+            if(shared == 1 && 4 * i + 4 < nrow)
+            {
+                r_col[4 * i + 3] = 4 * i + 4;
+            }
+
+            r_ptr[i + 1] = 4 * (i + 1);
+        }
+
+        LocalMatrix<T> R;
+        R.SetDataPtrCSR(&r_ptr, &r_col, &r_val, "R", 4 * ncoarse, ncoarse, nrow);
+
+        LocalVector<T> coarse;
+        LocalVector<T> ref;
+
+        coarse.Allocate("coarse", ncoarse);
+        ref.Allocate("ref", ncoarse);
+
+        // Column check on every call, and once in advance as in the multigrid cycles
+        bool unique = R.HasUniqueColumns();
+
+        success = success && (unique == (shared == 0));
+
+        for(int checked = 0; checked < 2; ++checked)
+        {
+            A.ResidualRestrict(R, b, x, &res, &coarse, checked == 1 && unique);
+
+            A.Residual(b, x, &res);
+            R.Apply(res, &ref);
+
+            T nrm = ref.Norm();
+
+            ref.ScaleAdd(static_cast<T>(-1), coarse);
+
+            success = success
+                      && (std::abs(ref.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+        }
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_apply_sub_matrix(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(16, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Row offset, column offset, number of rows and number of columns
+    int cases[][4] = {{0, 0, nrow, nrow},
+                      {0, 0, 1, 1},
+                      {17, 0, 40, 17},
+                      {100, 30, 56, 200},
+                      {50, 60, 30, 40},
+                      {0, nrow - 5, 10, 5},
+                      {nrow - 1, nrow - 1, 1, 1}};
+
+    bool success = true;
+
+    for(int k = 0; k < 7; ++k)
+    {
+        int row_offset = cases[k][0];
+        int col_offset = cases[k][1];
+        int row_size   = cases[k][2];
+        int col_size   = cases[k][3];
+
+        LocalMatrix<T> sub;
+        A.ExtractSubMatrix(row_offset, col_offset, row_size, col_size, &sub);
+
+        LocalVector<T> in;
+        LocalVector<T> out;
+        LocalVector<T> ref;
+
+        in.Allocate("in", col_size);
+        out.Allocate("out", row_size);
+        ref.Allocate("ref", row_size);
+
+        in.SetRandomUniform(1234ULL + k, static_cast<T>(-1), static_cast<T>(1));
+
+        // out = A(rows, cols) * in
+        A.ApplySubMatrix(row_offset, col_offset, row_size, col_size, in, &out);
+        sub.Apply(in, &ref);
+
+        T nrm = ref.Norm();
+
+        ref.ScaleAdd(static_cast<T>(-1), out);
+
+        success = success
+                  && (std::abs(ref.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+
+        // out = out + 0.5 * A(rows, cols) * in
+        out.SetRandomUniform(5678ULL + k, static_cast<T>(-1), static_cast<T>(1));
+        ref.CopyFrom(out);
+
+        A.ApplyAddSubMatrix(
+            row_offset, col_offset, row_size, col_size, in, static_cast<T>(0.5), &out);
+        sub.ApplyAdd(in, static_cast<T>(0.5), &ref);
+
+        nrm = ref.Norm();
+
+        ref.ScaleAdd(static_cast<T>(-1), out);
+
+        success = success
+                  && (std::abs(ref.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_block_precond(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(16, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> rhs;
+    rhs.Allocate("rhs", nrow);
+    rhs.SetRandomUniform(4321ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    int sizes[3] = {80, 96, nrow - 176};
+
+    LocalVector<T> ref;
+    ref.Allocate("ref", nrow);
+
+    bool success = true;
+
+    // The lower blocks are applied in place for CSR, and extracted once otherwise
+    for(int ell = 0; ell < 2; ++ell)
+    {
+        LocalMatrix<T> op;
+        op.CloneFrom(A);
+
+        if(ell == 1)
+        {
+            op.ConvertToELL();
+        }
+
+        success = success && (op.SupportsApplySubMatrix() == (ell == 0));
+
+        Jacobi<LocalMatrix<T>, LocalVector<T>, T>  jacobi[3];
+        Solver<LocalMatrix<T>, LocalVector<T>, T>* diag[3] = {&jacobi[0], &jacobi[1], &jacobi[2]};
+
+        BlockPreconditioner<LocalMatrix<T>, LocalVector<T>, T> p;
+        p.Set(3, sizes, diag);
+        p.SetLSolver();
+        p.SetOperator(op);
+        p.Build();
+
+        LocalVector<T> x;
+        x.Allocate("x", nrow);
+
+        // Repeated applications reuse the blocks
+        for(int k = 0; k < 2; ++k)
+        {
+            p.Solve(rhs, &x);
+        }
+
+        if(ell == 0)
+        {
+            ref.CopyFrom(x);
+        }
+        else
+        {
+            T nrm = ref.Norm();
+
+            x.ScaleAdd(static_cast<T>(-1), ref);
+
+            success = success
+                      && (std::abs(x.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+        }
+
+        p.Clear();
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+// Factorizes a Laplace matrix with ILUT or ILU(p) using nthreads OpenMP threads and
+// copies the solution of the triangular solves into sol.
+template <typename T>
+static void local_matrix_ilu_solve(int ndim, bool ilut, int nthreads, std::vector<T>& sol)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(nthreads);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<T> b;
+    LocalVector<T> x;
+
+    b.Allocate("b", nrow);
+    x.Allocate("x", nrow);
+
+    b.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    if(ilut == true)
+    {
+        A.ILUTFactorize(1e-4, 20);
+    }
+    else
+    {
+        A.ILUpFactorize(2, true);
+    }
+
+    A.LUAnalyse();
+    A.LUSolve(b, &x);
+
+    sol.resize(nrow);
+    x.CopyToData(sol.data());
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+bool testing_local_matrix_ilu_parallel(void)
+{
+    bool success = true;
+
+    // Every row of the Laplace matrix depends on its lower neighbours, thus the rows form
+    // many dependency levels that are factorized concurrently with more than one thread
+    for(int ilut = 0; ilut < 2; ++ilut)
+    {
+        std::vector<T> seq;
+        std::vector<T> par;
+
+        local_matrix_ilu_solve<T>(24, ilut == 1, 1, seq);
+        local_matrix_ilu_solve<T>(24, ilut == 1, 4, par);
+
+        // Each row is computed from the final values of its predecessors, thus the
+        // factors are identical to the sequential factorization
+        success = success && (seq == par);
+    }
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_coo_unsorted(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Generate A
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(20, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    // COO entries of A, the rows are visited with a stride that is coprime to nrow such
+    // that every chunk of the parallel SpMV contains entries of many rows
+    int* coo_row = NULL;
+    int* coo_col = NULL;
+    T*   coo_val = NULL;
+
+    allocate_host(nnz, &coo_row);
+    allocate_host(nnz, &coo_col);
+    allocate_host(nnz, &coo_val);
+
+    int k = 0;
+    for(int n = 0; n < nrow; ++n)
+    {
+        int i = static_cast<int>((7LL * n) % nrow);
+
+        for(int j = csr_ptr[i + 1] - 1; j >= csr_ptr[i]; --j)
+        {
+            coo_row[k] = i;
+            coo_col[k] = csr_col[j];
+            coo_val[k] = csr_val[j];
+            ++k;
+        }
+    }
+
+    LocalMatrix<T> A;
+    LocalMatrix<T> B;
+    LocalMatrix<T> C;
+
+    B.AllocateCOO("B", nnz, nrow, nrow);
+    B.CopyFromCOO(coo_row, coo_col, coo_val);
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+    C.SetDataPtrCOO(&coo_row, &coo_col, &coo_val, "C", nnz, nrow, nrow);
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> ref;
+
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+    ref.Allocate("ref", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    A.Apply(x, &ref);
+
+    T nrm = ref.Norm();
+
+    bool success = true;
+
+    // y = C * x and y = B * x
+    for(int m = 0; m < 2; ++m)
+    {
+        LocalMatrix<T>& coo = (m == 0) ? C : B;
+
+        coo.Apply(x, &y);
+        y.ScaleAdd(static_cast<T>(-1), ref);
+
+        success = success
+                  && (std::abs(y.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+
+        // y = y + 2 * C * x, with y = -A * x
+        y.CopyFrom(ref);
+        y.Scale(static_cast<T>(-1));
+        coo.ApplyAdd(x, static_cast<T>(2), &y);
+        y.ScaleAdd(static_cast<T>(-1), ref);
+
+        success = success
+                  && (std::abs(y.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+    }
+
+    // Sorting the entries switches to the parallel SpMV
+    C.Sort();
+    C.Apply(x, &y);
+    y.ScaleAdd(static_cast<T>(-1), ref);
+
+    success = success && (std::abs(y.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_dia_tiles(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    // Banded matrix with more rows than a tile of the DIA SpMV holds, the diagonals
+    // reach across one or more tiles and some of them only touch parts of a tile
+    int nrow     = 3001;
+    int offset[] = {-2500, -1100, -1024, -1023, -1, 0, 1, 7, 1023, 1024, 1500, 3000};
+    int ndiag    = 12;
+
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    allocate_host(nrow + 1, &csr_ptr);
+    allocate_host(nrow * ndiag, &csr_col);
+    allocate_host(nrow * ndiag, &csr_val);
+
+    int nnz    = 0;
+    csr_ptr[0] = 0;
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int d = 0; d < ndiag; ++d)
+        {
+            int j = i + offset[d];
+
+            if(j >= 0 && j < nrow)
+            {
+                csr_col[nnz] = j;
+                csr_val[nnz] = static_cast<T>(1) / static_cast<T>(1 + (i + 3 * d) % 17);
+                ++nnz;
+            }
+        }
+
+        csr_ptr[i + 1] = nnz;
+    }
+
+    LocalMatrix<T> A;
+    LocalMatrix<T> D;
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+    D.CloneFrom(A);
+    D.ConvertToDIA();
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> ref;
+
+    x.Allocate("x", nrow);
+    y.Allocate("y", nrow);
+    ref.Allocate("ref", nrow);
+
+    x.SetRandomUniform(12345ULL, static_cast<T>(-1), static_cast<T>(1));
+
+    bool success = (D.GetFormat() == DIA);
+
+    // y = D * x
+    A.Apply(x, &ref);
+    D.Apply(x, &y);
+
+    T nrm = ref.Norm();
+
+    y.ScaleAdd(static_cast<T>(-1), ref);
+
+    success = success && (std::abs(y.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+
+    // y = y + 0.5 * D * x
+    y.SetRandomUniform(67890ULL, static_cast<T>(-1), static_cast<T>(1));
+    ref.CopyFrom(y);
+
+    A.ApplyAdd(x, static_cast<T>(0.5), &ref);
+    D.ApplyAdd(x, static_cast<T>(0.5), &y);
+
+    nrm = ref.Norm();
+
+    y.ScaleAdd(static_cast<T>(-1), ref);
+
+    success = success && (std::abs(y.Norm()) <= 100 * std::numeric_limits<T>::epsilon() * nrm);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_matrix_autotune_cache(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // Laplace matrix, where the heuristics select DIA
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(30, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Scattered matrix of the same size, where the heuristics keep CSR
+    int* b_ptr = NULL;
+    int* b_col = NULL;
+    T*   b_val = NULL;
+
+    allocate_host(nrow + 1, &b_ptr);
+    allocate_host(2 * nrow, &b_col);
+    allocate_host(2 * nrow, &b_val);
+
+    int b_nnz = 0;
+    b_ptr[0]  = 0;
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        int j = static_cast<int>((37LL * i + 11) % nrow);
+
+        b_col[b_nnz]   = std::min(i, j);
+        b_val[b_nnz++] = static_cast<T>(2);
+
+        if(j != i)
+        {
+            b_col[b_nnz]   = std::max(i, j);
+            b_val[b_nnz++] = static_cast<T>(-1);
+        }
+
+        b_ptr[i + 1] = b_nnz;
+    }
+
+    LocalMatrix<T> B;
+    B.SetDataPtrCSR(&b_ptr, &b_col, &b_val, "B", b_nnz, nrow, nrow);
+
+    // Reference decisions
+    LocalMatrix<T> A0;
+    LocalMatrix<T> B0;
+
+    A0.CloneFrom(A);
+    B0.CloneFrom(B);
+
+    unsigned int format_a = A0.AutotuneFormat(false);
+    unsigned int format_b = B0.AutotuneFormat(false);
+
+    bool success = (format_a == DIA) && (format_b == CSR);
+
+    // Cached decisions are made for the pattern only, thus different values on the same
+    // pattern select the same format
+    A0.ConvertToCSR();
+    A0.Scale(static_cast<T>(2));
+
+    success = success && (A0.AutotuneFormat(false) == format_a);
+    success = success && (B0.AutotuneFormat(false) == format_b);
+
+    // Concurrent builds look up and insert decisions at the same time
+    std::vector<unsigned int> formats(8);
+    std::vector<std::thread>  threads;
+
+    for(int t = 0; t < 8; ++t)
+    {
+        threads.push_back(std::thread([&, t]() {
+            LocalMatrix<T> mat;
+            mat.CloneFrom((t % 2 == 0) ? A : B);
+
+            formats[t] = mat.AutotuneFormat(false);
+        }));
+    }
+
+    for(int t = 0; t < 8; ++t)
+    {
+        threads[t].join();
+
+        success = success && (formats[t] == ((t % 2 == 0) ? format_a : format_b));
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+// Runs the initial or the further pairwise aggregation with nthreads OpenMP threads. With
+// single_team, the OpenMP threshold serializes the parallel regions, while the matching is
+// still split into nthreads blocks.
+template <typename T>
+static void local_matrix_pairwise(int               nthreads,
+                                  bool              single_team,
+                                  bool              further,
+                                  int&              nc,
+                                  int&              Gsize,
+                                  int&              rGsize,
+                                  std::vector<int>& G,
+                                  std::vector<int>& rG)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(nthreads);
+    set_omp_threshold_rocalution(single_team == true ? std::numeric_limits<int>::max() : 0);
+
+    // Generate A, with varying couplings and some strongly diagonal dominant rows
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(40, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = csr_ptr[i]; j < csr_ptr[i + 1]; ++j)
+        {
+            if(csr_col[j] != i)
+            {
+                csr_val[j] *= static_cast<T>(1 + ((31 * i + 17 * csr_col[j]) % 5) / 4.0);
+            }
+            else if(i % 13 == 0)
+            {
+                csr_val[j] *= static_cast<T>(30);
+            }
+        }
+    }
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    LocalVector<int> vG;
+    vG.Allocate("G", nrow);
+
+    int* prG = NULL;
+
+    if(further == true)
+    {
+        // Every node forms an aggregate of its own
+        Gsize  = 1;
+        rGsize = nrow;
+        allocate_host(nrow, &prG);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            prG[i] = i;
+        }
+
+        A.FurtherPairwiseAggregation(static_cast<T>(0.25), nc, &vG, Gsize, &prG, rGsize, 0);
+    }
+    else
+    {
+        A.InitialPairwiseAggregation(static_cast<T>(0.25), nc, &vG, Gsize, &prG, rGsize, 0);
+    }
+
+    G.resize(nrow);
+    vG.CopyToData(G.data());
+
+    rG.assign(prG, prG + Gsize * rGsize);
+    free_host(&prG);
+
+    // Stop rocALUTION
+    stop_rocalution();
+}
+
+template <typename T>
+bool testing_local_matrix_pairwise_parallel(void)
+{
+    bool success = true;
+
+    for(int further = 0; further < 2; ++further)
+    {
+        for(int nthreads = 1; nthreads <= 8; nthreads *= 2)
+        {
+            int              nc;
+            int              Gsize;
+            int              rGsize;
+            std::vector<int> G;
+            std::vector<int> rG;
+
+            local_matrix_pairwise<T>(nthreads, false, further == 1, nc, Gsize, rGsize, G, rG);
+
+            // Each aggregate lists its members, which are assigned to it, and no node is
+            // in two aggregates. Only the initial aggregation leaves nodes unassigned.
+            int nodes = 0;
+
+            for(int i = 0; i < static_cast<int>(G.size()); ++i)
+            {
+                success = success && (G[i] < nc) && (G[i] >= (further == 1 ? 0 : -1));
+                nodes += (G[i] >= 0) ? 1 : 0;
+            }
+
+            int members = 0;
+
+            for(int k = 0; k < nc; ++k)
+            {
+                success = success && (rG[k] >= 0);
+
+                for(int r = 0; r < Gsize; ++r)
+                {
+                    int m = rG[r * rGsize + k];
+
+                    if(m >= 0)
+                    {
+                        success = success && (G[m] == k);
+                        ++members;
+                    }
+                }
+            }
+
+            success = success && (members == nodes) && (nc > 0) && (nc < nodes);
+
+            // The aggregates depend on the number of threads only, not on the scheduling
+            int              nc_serial;
+            int              Gsize_serial;
+            int              rGsize_serial;
+            std::vector<int> G_serial;
+            std::vector<int> rG_serial;
+
+            local_matrix_pairwise<T>(nthreads,
+                                     true,
+                                     further == 1,
+                                     nc_serial,
+                                     Gsize_serial,
+                                     rGsize_serial,
+                                     G_serial,
+                                     rG_serial);
+
+            success = success && (nc == nc_serial) && (Gsize == Gsize_serial)
+                      && (rGsize == rGsize_serial) && (G == G_serial) && (rG == rG_serial);
+        }
+    }
+
+    return success;
+}
+
 #endif // TESTING_LOCAL_MATRIX_HPP
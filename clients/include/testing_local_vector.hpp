@@ -27,8 +27,10 @@
 
 #include "utility.hpp"
 
+#include <cmath>
 #include <gtest/gtest.h>
 #include <rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -60,6 +62,13 @@ void testing_local_vector_bad_args(void)
         free_host(&vdata);
     }
 
+    // SetView
+    {
+        LocalVector<T> view;
+        ASSERT_DEATH(vec.SetView(vec, 0, 0), ".*Assertion.*this != &src*");
+        ASSERT_DEATH(view.SetView(vec, 0, safe_size), ".*Assertion.*src.GetSize()*");
+    }
+
     // CopyFromData
     {
         T* null_ptr = nullptr;
@@ -137,4 +146,428 @@ void testing_local_vector_bad_args(void)
     stop_rocalution();
 }
 
+template <typename T>
+bool testing_local_vector_view(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    LocalVector<T> src;
+    src.Allocate("src", 100);
+    src.Zeros();
+
+    // Write through a view on the entries 30 to 69
+    LocalVector<T> view;
+    view.SetView(src, 30, 40);
+
+    bool success = (view.GetSize() == 40);
+
+    for(int i = 0; i < 40; ++i)
+    {
+        view[i] = static_cast<T>(i + 1);
+    }
+
+    view.Scale(static_cast<T>(2));
+
+    // Clearing the view must not release src
+    view.Clear();
+
+    success = success && (view.GetSize() == 0) && (src.GetSize() == 100);
+
+    for(int i = 0; i < 100; ++i)
+    {
+        T expected = (i >= 30 && i < 70) ? static_cast<T>(2 * (i - 29)) : static_cast<T>(0);
+
+        success = success && (src[i] == expected);
+    }
+
+    src.Ones();
+
+    success = success && (src[99] == static_cast<T>(1));
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_vector_dot_future(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> z;
+
+    x.Allocate("x", 1000);
+    y.Allocate("y", 1000);
+    z.Allocate("z", 1000);
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+    y.SetRandomUniform(67890ULL, -1.0, 1.0);
+    z.SetRandomUniform(13579ULL, -1.0, 1.0);
+
+    T xy = x.Dot(y);
+    T xz = x.Dot(z);
+    T yz = y.DotNonConj(z);
+
+    // Completed dot products match the blocking ones exactly
+    DotFuture<T> dot;
+
+    x.DotBegin(y, &dot);
+    bool success = (x.DotEnd(&dot) == xy);
+
+    // A completed future can be reused
+    y.DotNonConjBegin(z, &dot);
+    success = success && (y.DotEnd(&dot) == yz);
+
+    // Several dot products can be pending at once, and work can be done in between
+    DotFuture<T> dot1;
+    DotFuture<T> dot2;
+    DotFuture<T> dot3;
+
+    x.DotBegin(y, &dot1);
+    x.DotBegin(z, &dot2);
+    y.DotNonConjBegin(z, &dot3);
+
+    LocalVector<T> w;
+    w.CloneFrom(x);
+    w.ScaleAdd(static_cast<T>(2), y);
+
+    success = success && (x.DotEnd(&dot1) == xy);
+    success = success && (x.DotEnd(&dot2) == xz);
+    success = success && (y.DotEnd(&dot3) == yz);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_vector_reproducible(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threshold_rocalution(0);
+    set_omp_reproducible_rocalution(true);
+
+    // Values of very different magnitude, such that the sums depend on their order
+    int size = 100003;
+
+    std::vector<T> xdata(size);
+    std::vector<T> ydata(size);
+
+    for(int i = 0; i < size; ++i)
+    {
+        T scale  = static_cast<T>(std::pow(10.0, (i * 7) % 13 - 6));
+        xdata[i] = scale * static_cast<T>((i * 37) % 101 - 50) / static_cast<T>(17);
+        ydata[i] = static_cast<T>((i * 53) % 97 - 48) / static_cast<T>(29);
+    }
+
+    // Dot, Norm, Asum and Reduce for each number of threads
+    int            threads[] = {1, 2, 3, 4, 7, 8};
+    std::vector<T> results[6];
+
+    for(int k = 0; k < 6; ++k)
+    {
+        set_omp_threads_rocalution(threads[k]);
+
+        LocalVector<T> x;
+        LocalVector<T> y;
+
+        x.Allocate("x", size);
+        y.Allocate("y", size);
+
+        x.CopyFromData(xdata.data());
+        y.CopyFromData(ydata.data());
+
+        results[k].push_back(x.Dot(y));
+        results[k].push_back(x.Norm());
+        results[k].push_back(x.Asum());
+        results[k].push_back(x.Reduce());
+    }
+
+    set_omp_reproducible_rocalution(false);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    bool success = true;
+
+    // Bitwise identical
+    for(int k = 1; k < 6; ++k)
+    {
+        success = success && (results[k] == results[0]);
+    }
+
+    return success;
+}
+
+// Returns true if vec is bitwise identical to ref
+template <typename T>
+static bool blas1_matches(LocalVector<T>& vec, const std::vector<T>& ref)
+{
+    std::vector<T> data(ref.size());
+
+    vec.CopyToData(data.data());
+
+    return data == ref;
+}
+
+template <typename T>
+bool testing_local_vector_blas1(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    T alpha = static_cast<T>(1.5);
+    T beta  = static_cast<T>(-0.7);
+    T gamma = static_cast<T>(0.3);
+
+    bool success = true;
+
+    // Sizes below, at and above the vector widths, with remainder loops on every thread.
+    // Each kernel is compared bitwise with the scalar loop, whatever variant the CPU
+    // selects.
+    int sizes[] = {1, 15, 1000, 100003};
+
+    for(int k = 0; k < 4; ++k)
+    {
+        int size = sizes[k];
+
+        std::vector<T> x(size);
+        std::vector<T> y(size);
+        std::vector<T> z(size);
+        std::vector<T> ref(size);
+
+        for(int i = 0; i < size; ++i)
+        {
+            x[i] = static_cast<T>((i * 37) % 101 - 50) / static_cast<T>(17);
+            y[i] = static_cast<T>((i * 53) % 97 - 48) / static_cast<T>(29);
+            z[i] = static_cast<T>((i * 11) % 89 - 44) / static_cast<T>(13);
+        }
+
+        LocalVector<T> vx;
+        LocalVector<T> vy;
+        LocalVector<T> vz;
+
+        vx.Allocate("x", size);
+        vy.Allocate("y", size);
+        vz.Allocate("z", size);
+
+        vx.CopyFromData(x.data());
+        vz.CopyFromData(z.data());
+
+        // y = y + alpha * x
+        vy.CopyFromData(y.data());
+        vy.AddScale(vx, alpha);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = y[i] + alpha * x[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // y = alpha * y + x
+        vy.CopyFromData(y.data());
+        vy.ScaleAdd(alpha, vx);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = alpha * y[i] + x[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // y = alpha * y + beta * x
+        vy.CopyFromData(y.data());
+        vy.ScaleAddScale(alpha, vx, beta);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = alpha * y[i] + beta * x[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // Same on a range that starts off the vector alignment
+        int offset = (size > 2) ? 1 : 0;
+        int length = size - 2 * offset;
+
+        vy.CopyFromData(y.data());
+        vy.ScaleAddScale(alpha, vx, beta, 0, offset, length);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = (i >= offset && i < offset + length) ? alpha * y[i] + beta * x[i - offset]
+                                                          : y[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // y = alpha * y + beta * x + gamma * z
+        vy.CopyFromData(y.data());
+        vy.ScaleAdd2(alpha, vx, beta, vz, gamma);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = alpha * y[i] + beta * x[i] + gamma * z[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // y = alpha * y
+        vy.CopyFromData(y.data());
+        vy.Scale(alpha);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = alpha * y[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        // y = y * x and y = x * z
+        vy.CopyFromData(y.data());
+        vy.PointWiseMult(vx);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = y[i] * x[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+
+        vy.PointWiseMult(vx, vz);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = z[i] * x[i];
+        }
+
+        success = success && blas1_matches(vy, ref);
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+template <typename T>
+bool testing_local_vector_copy_permute(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(4);
+    set_omp_threshold_rocalution(0);
+
+    bool success = true;
+
+    // A small vector, and a vector that exceeds the last level cache of most CPUs and
+    // takes the streaming paths
+    int sizes[] = {1000, (1 << 22) + 7};
+
+    for(int k = 0; k < 2; ++k)
+    {
+        int size = sizes[k];
+
+        std::vector<T>   data(size);
+        std::vector<T>   ref(size);
+        std::vector<int> perm(size);
+
+        // Random permutation, such that the entries move far
+        unsigned long long seed = 12345ULL;
+
+        for(int i = 0; i < size; ++i)
+        {
+            data[i] = static_cast<T>(i % 1009) / static_cast<T>(7);
+            perm[i] = i;
+        }
+
+        for(int i = size - 1; i > 0; --i)
+        {
+            seed  = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            int j = static_cast<int>((seed >> 33) % static_cast<unsigned long long>(i + 1));
+
+            std::swap(perm[i], perm[j]);
+        }
+
+        LocalVector<T>   src;
+        LocalVector<T>   dst;
+        LocalVector<int> vperm;
+
+        src.Allocate("src", size);
+        dst.Allocate("dst", size);
+        vperm.Allocate("perm", size);
+
+        src.CopyFromData(data.data());
+        vperm.CopyFromData(perm.data());
+
+        // CopyFromData and CopyToData
+        src.CopyToData(ref.data());
+
+        success = success && (ref == data);
+
+        // CopyFrom
+        dst.Zeros();
+        dst.CopyFrom(src);
+
+        success = success && blas1_matches(dst, data);
+
+        // CopyFrom with offsets that are not aligned to a cache line
+        int src_offset = 3;
+        int dst_offset = 5;
+        int length     = size - 9;
+
+        dst.Zeros();
+        dst.CopyFrom(src, src_offset, dst_offset, length);
+
+        for(int i = 0; i < size; ++i)
+        {
+            bool copied = (i >= dst_offset) && (i < dst_offset + length);
+
+            ref[i] = copied ? data[i - dst_offset + src_offset] : static_cast<T>(0);
+        }
+
+        success = success && blas1_matches(dst, ref);
+
+        // dst[perm[i]] = src[i]
+        dst.CopyFromPermute(src, vperm);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[perm[i]] = data[i];
+        }
+
+        success = success && blas1_matches(dst, ref);
+
+        // dst[i] = src[perm[i]]
+        dst.CopyFromPermuteBackward(src, vperm);
+
+        for(int i = 0; i < size; ++i)
+        {
+            ref[i] = data[perm[i]];
+        }
+
+        success = success && blas1_matches(dst, ref);
+    }
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
 #endif // TESTING_LOCAL_VECTOR_HPP
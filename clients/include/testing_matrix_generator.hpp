@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_MATRIX_GENERATOR_HPP
+#define TESTING_MATRIX_GENERATOR_HPP
+
+#include "utility.hpp"
+
+#include <rocalution.hpp>
+
+using namespace rocalution;
+
+static bool check_residual(float res)
+{
+    return (res < 1e-3f);
+}
+
+static bool check_residual(double res)
+{
+    return (res < 1e-6);
+}
+
+template <typename T>
+bool testing_matrix_generator(Arguments argus)
+{
+    int         ndim   = argus.size;
+    std::string matrix = argus.matrix;
+
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // rocALUTION structures
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> y;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    // Generate A
+    MatrixGenerator<T> gen;
+
+    gen.SetGrid(ndim, ndim + 1, ndim + 2);
+
+    int  nrow      = ndim * (ndim + 1) * (ndim + 2);
+    bool symmetric = true;
+
+    if(matrix == "Laplace7")
+        gen.SetLaplace(7);
+    else if(matrix == "Laplace27")
+        gen.SetLaplace(27);
+    else if(matrix == "AnisotropicDiffusion")
+        gen.SetAnisotropicDiffusion(1.0, 0.1, 10.0);
+    else if(matrix == "JumpingDiffusion")
+        gen.SetJumpingDiffusion(100.0, 2);
+    else if(matrix == "Elasticity")
+    {
+        gen.SetElasticity(2.0, 1.0);
+        nrow *= 3;
+    }
+    else if(matrix == "ConvectionDiffusion")
+    {
+        gen.SetConvectionDiffusion(1.0, 2.0, -1.0, 0.5);
+        symmetric = false;
+    }
+    else if(matrix == "PowerLawGraph")
+        gen.SetPowerLawGraph(nrow, 6, 50, 2.5, 12345ULL);
+    else
+        return false;
+
+    gen.Generate(&A);
+
+    bool success = (A.GetM() == nrow && A.GetN() == nrow);
+
+    // The 7 point stencils couple all grid neighbours
+    if(matrix == "Laplace7" || matrix == "AnisotropicDiffusion" || matrix == "JumpingDiffusion"
+       || matrix == "ConvectionDiffusion")
+    {
+        int faces = ndim * (ndim + 1) + (ndim + 1) * (ndim + 2) + ndim * (ndim + 2);
+
+        success = success && (A.GetNnz() == 7 * nrow - 2 * faces);
+    }
+
+    // Move data to accelerator
+    A.MoveToAccelerator();
+    x.MoveToAccelerator();
+    y.MoveToAccelerator();
+    b.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate x, y, b and e
+    x.Allocate("x", A.GetN());
+    y.Allocate("y", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    // Symmetry, y^T A x = x^T A y
+    if(symmetric == true)
+    {
+        x.SetRandomUniform(12345ULL, -1.0, 1.0);
+        y.SetRandomUniform(67890ULL, -1.0, 1.0);
+
+        A.Apply(x, &b);
+        T yAx = y.Dot(b);
+
+        A.Apply(y, &b);
+        T xAy = x.Dot(b);
+
+        success = success && check_residual(std::abs(yAx - xAy) / std::abs(yAx));
+    }
+
+    // b = A * 1
+    e.Ones();
+    A.Apply(e, &b);
+
+    // Random initial guess
+    x.SetRandomUniform(12345ULL, -4.0, 6.0);
+
+    // Solver
+    IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>* ls;
+
+    if(symmetric == true)
+        ls = new CG<LocalMatrix<T>, LocalVector<T>, T>;
+    else
+        ls = new GMRES<LocalMatrix<T>, LocalVector<T>, T>;
+
+    // Preconditioner
+    Jacobi<LocalMatrix<T>, LocalVector<T>, T> p;
+
+    ls->Verbose(0);
+    ls->SetOperator(A);
+    ls->SetPreconditioner(p);
+
+    ls->Init(1e-8, 0.0, 1e+8, 10000);
+    ls->Build();
+    ls->Solve(b, &x);
+
+    // Verify solution
+    x.ScaleAdd(-1.0, e);
+    T nrm2 = x.Norm();
+
+    success = success && check_residual(nrm2);
+
+    // Clean up
+    ls->Clear();
+    delete ls;
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_MATRIX_GENERATOR_HPP
@@ -135,6 +135,15 @@ bool testing_pairwise_amg(Arguments argus)
         }
         else if(smoother == "MCILU")
             smooth = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(smoother == "SSOR")
+            smooth = new SSOR<LocalMatrix<T>, LocalVector<T>, T>;
+        else if(smoother == "Kaczmarz")
+        {
+            Kaczmarz<LocalMatrix<T>, LocalVector<T>, T>* kacz
+                = new Kaczmarz<LocalMatrix<T>, LocalVector<T>, T>;
+            kacz->SetRelaxation(1.5);
+            smooth = kacz;
+        }
         else
             return false;
 
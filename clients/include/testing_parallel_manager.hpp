@@ -52,6 +52,12 @@ void testing_parallel_manager_bad_args(void)
         ASSERT_DEATH(pm.SetMPICommunicator(null_ptr), ".*Assertion.*comm != (NULL|__null)*");
     }
 
+    // SetMPICommunicator of a subset of the processes
+    {
+        ParallelManager parent;
+        ASSERT_DEATH(pm.SetMPICommunicator(parent, 1), ".*Assertion.*pm.Status*");
+    }
+
     // SetBoundaryIndex
     {
         int* null_int = nullptr;
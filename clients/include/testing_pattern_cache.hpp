@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_PATTERN_CACHE_HPP
+#define TESTING_PATTERN_CACHE_HPP
+
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <rocalution.hpp>
+#include <vector>
+
+using namespace rocalution;
+
+// Returns true if no two coupled rows of mat share a color
+template <typename T>
+static bool valid_coloring(const LocalMatrix<T>& mat,
+                           int                   num_colors,
+                           const int*            size_colors,
+                           LocalVector<int>&     permutation)
+{
+    int nrow = mat.GetM();
+    int nnz  = mat.GetNnz();
+
+    std::vector<int> row_offset(nrow + 1);
+    std::vector<int> col(nnz);
+    std::vector<T>   val(nnz);
+    std::vector<int> perm(nrow);
+    std::vector<int> color(nrow);
+
+    mat.CopyToCSR(row_offset.data(), col.data(), val.data());
+    permutation.CopyToData(perm.data());
+
+    // The rows of each color are consecutive after the permutation
+    std::vector<int> color_of_pos(nrow);
+
+    int pos = 0;
+    for(int c = 0; c < num_colors; ++c)
+    {
+        for(int k = 0; k < size_colors[c]; ++k)
+        {
+            color_of_pos[pos++] = c;
+        }
+    }
+
+    if(pos != nrow)
+    {
+        return false;
+    }
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        color[i] = color_of_pos[perm[i]];
+    }
+
+    for(int i = 0; i < nrow; ++i)
+    {
+        for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+        {
+            if(col[j] != i && color[col[j]] == color[i])
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+bool testing_pattern_cache_coloring(void)
+{
+    // Initialize rocALUTION
+    set_device_rocalution(device);
+    init_rocalution();
+
+    // 5-point Laplace matrix, which needs two colors
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(20, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> A;
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    // Same matrix with a coupling to the diagonal neighbour below, such that the
+    // coloring of A is not valid
+    LocalMatrix<T> B;
+    {
+        int nnz_a = A.GetNnz();
+
+        std::vector<int> a_ptr(nrow + 1);
+        std::vector<int> a_col(nnz_a);
+        std::vector<T>   a_val(nnz_a);
+
+        A.CopyToCSR(a_ptr.data(), a_col.data(), a_val.data());
+
+        std::vector<int> b_ptr(1, 0);
+        std::vector<int> b_col;
+        std::vector<T>   b_val;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(int j = a_ptr[i]; j < a_ptr[i + 1]; ++j)
+            {
+                b_col.push_back(a_col[j]);
+                b_val.push_back(a_val[j]);
+            }
+
+            int up   = i - 21;
+            int down = i + 21;
+
+            if(up >= 0 && i % 20 != 0)
+            {
+                b_col.insert(b_col.begin() + b_ptr[i], up);
+                b_val.insert(b_val.begin() + b_ptr[i], static_cast<T>(-1));
+            }
+
+            if(down < nrow && i % 20 != 19)
+            {
+                b_col.push_back(down);
+                b_val.push_back(static_cast<T>(-1));
+            }
+
+            b_ptr.push_back(static_cast<int>(b_col.size()));
+        }
+
+        B.AllocateCSR("B", b_ptr[nrow], nrow, nrow);
+        B.CopyFromCSR(b_ptr.data(), b_col.data(), b_val.data());
+    }
+
+    bool success = true;
+
+    // The first coloring of A is computed, the second one is taken from the cache
+    int              num_colors[2];
+    int*             size_colors[2] = {NULL, NULL};
+    LocalVector<int> permutation[2];
+
+    for(int k = 0; k < 2; ++k)
+    {
+        A.MultiColoring(num_colors[k], &size_colors[k], &permutation[k]);
+
+        success = success
+                  && valid_coloring(A, num_colors[k], size_colors[k], permutation[k]);
+    }
+
+    std::vector<int> perm0(nrow);
+    std::vector<int> perm1(nrow);
+
+    permutation[0].CopyToData(perm0.data());
+    permutation[1].CopyToData(perm1.data());
+
+    success = success && (num_colors[0] == num_colors[1]) && (perm0 == perm1);
+
+    // Another pattern of the same size must not reuse the coloring of A
+    int              num_colors_b;
+    int*             size_colors_b = NULL;
+    LocalVector<int> permutation_b;
+
+    B.MultiColoring(num_colors_b, &size_colors_b, &permutation_b);
+
+    success = success && valid_coloring(B, num_colors_b, size_colors_b, permutation_b);
+    success = success && (valid_coloring(B, num_colors[0], size_colors[0], permutation[0])
+                          == false);
+
+    free_host(&size_colors[0]);
+    free_host(&size_colors[1]);
+    free_host(&size_colors_b);
+
+    // Stop rocALUTION, which clears the cached colorings
+    stop_rocalution();
+
+    // A fresh coloring of the pattern of A matches the cached one
+    init_rocalution();
+
+    nrow = gen_2d_laplacian(20, &csr_ptr, &csr_col, &csr_val);
+    nnz  = csr_ptr[nrow];
+
+    LocalMatrix<T> C;
+    C.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "C", nnz, nrow, nrow);
+
+    int              num_colors_c;
+    int*             size_colors_c = NULL;
+    LocalVector<int> permutation_c;
+
+    C.MultiColoring(num_colors_c, &size_colors_c, &permutation_c);
+
+    std::vector<int> perm_c(nrow);
+    permutation_c.CopyToData(perm_c.data());
+
+    success = success && (num_colors_c == num_colors[0]) && (perm_c == perm0);
+
+    free_host(&size_colors_c);
+
+    // Stop rocALUTION
+    stop_rocalution();
+
+    return success;
+}
+
+#endif // TESTING_PATTERN_CACHE_HPP
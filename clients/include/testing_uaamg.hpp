@@ -27,7 +27,9 @@
 
 #include "utility.hpp"
 
+#include <cmath>
 #include <rocalution.hpp>
+#include <vector>
 
 using namespace rocalution;
 
@@ -170,4 +172,148 @@ bool testing_uaamg(Arguments argus)
     return success;
 }
 
+// Solves a Laplace problem with multi-colored smoothers using nthreads OpenMP threads.
+// Returns the number of iterations, the solution is copied into sol.
+template <typename T>
+static int uaamg_multicolored_solve(int ndim, int nthreads, std::vector<T>& sol)
+{
+    // Initialize rocALUTION platform
+    set_device_rocalution(device);
+    init_rocalution();
+    set_omp_threads_rocalution(nthreads);
+
+    // The iteration count must not depend on the rounding of the reductions
+    set_omp_reproducible_rocalution(true);
+
+    LocalMatrix<T> A;
+    LocalVector<T> x;
+    LocalVector<T> b;
+    LocalVector<T> e;
+
+    int* csr_ptr = NULL;
+    int* csr_col = NULL;
+    T*   csr_val = NULL;
+
+    int nrow = gen_2d_laplacian(ndim, &csr_ptr, &csr_col, &csr_val);
+    int nnz  = csr_ptr[nrow];
+
+    A.SetDataPtrCSR(&csr_ptr, &csr_col, &csr_val, "A", nnz, nrow, nrow);
+
+    x.Allocate("x", A.GetN());
+    b.Allocate("b", A.GetM());
+    e.Allocate("e", A.GetN());
+
+    e.Ones();
+    A.Apply(e, &b);
+    x.Zeros();
+
+    FCG<LocalMatrix<T>, LocalVector<T>, T>   ls;
+    UAAMG<LocalMatrix<T>, LocalVector<T>, T> p;
+
+    p.SetCoarsestLevel(200);
+    p.SetOperator(A);
+    p.SetManualSmoothers(true);
+    p.SetManualSolver(true);
+    p.BuildHierarchy();
+
+    int levels = p.GetNumLevels();
+
+    FCG<LocalMatrix<T>, LocalVector<T>, T> cgs;
+    cgs.Verbose(0);
+
+    // Alternate multi-colored Gauss-Seidel and ILU smoothers
+    IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>** sm
+        = new IterativeLinearSolver<LocalMatrix<T>, LocalVector<T>, T>*[levels - 1];
+    Preconditioner<LocalMatrix<T>, LocalVector<T>, T>** smooth
+        = new Preconditioner<LocalMatrix<T>, LocalVector<T>, T>*[levels - 1];
+
+    for(int i = 0; i < levels - 1; ++i)
+    {
+        if(i % 2 == 0)
+        {
+            smooth[i] = new MultiColoredGS<LocalMatrix<T>, LocalVector<T>, T>;
+        }
+        else
+        {
+            smooth[i] = new MultiColoredILU<LocalMatrix<T>, LocalVector<T>, T>;
+        }
+
+        sm[i] = new FixedPoint<LocalMatrix<T>, LocalVector<T>, T>;
+        sm[i]->SetPreconditioner(*smooth[i]);
+        sm[i]->Verbose(0);
+    }
+
+    p.SetSmoother(sm);
+    p.SetSolver(cgs);
+    p.InitMaxIter(1);
+    p.Verbose(0);
+
+    ls.Verbose(0);
+    ls.SetOperator(A);
+    ls.SetPreconditioner(p);
+    ls.Init(1e-8, 0.0, 1e+8, 10000);
+    ls.Build();
+
+    ls.Solve(b, &x);
+
+    int iter = ls.GetIterationCount();
+
+    sol.resize(nrow);
+    x.CopyToData(sol.data());
+
+    ls.Clear();
+    p.Clear();
+
+    for(int i = 0; i < levels - 1; ++i)
+    {
+        delete sm[i];
+        delete smooth[i];
+    }
+
+    delete[] sm;
+    delete[] smooth;
+
+    set_omp_reproducible_rocalution(false);
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    return iter;
+}
+
+template <typename T>
+bool testing_uaamg_concurrent_build(void)
+{
+    std::vector<T> seq;
+
+    // A single thread builds the smoothers one after another, more threads build the
+    // smoothers of all levels concurrently. With two threads, the coarse levels share a
+    // host task.
+    int seq_iter = uaamg_multicolored_solve<T>(63, 1, seq);
+
+    for(int nthreads = 2; nthreads <= 4; nthreads += 2)
+    {
+        std::vector<T> con;
+
+        int con_iter = uaamg_multicolored_solve<T>(63, nthreads, con);
+
+        // The smoothers do not depend on the build order and the reductions are
+        // reproducible, thus both solves take the same number of iterations
+        if(seq_iter != con_iter || seq.size() != con.size())
+        {
+            return false;
+        }
+
+        for(size_t i = 0; i < seq.size(); ++i)
+        {
+            if(check_residual(std::abs(seq[i] - con[i])) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 #endif // TESTING_UAAMG_HPP
@@ -128,6 +128,9 @@ public:
     double beta  = 0.0;
     double gamma = 0.0;
 
+    // Matrix variables
+    std::string matrix = "";
+
     // Solver variables
     std::string solver   = "";
     std::string precond  = "";
@@ -160,6 +163,8 @@ public:
         this->beta  = rhs.beta;
         this->gamma = rhs.gamma;
 
+        this->matrix = rhs.matrix;
+
         this->solver   = rhs.solver;
         this->precond  = rhs.precond;
         this->smoother = rhs.smoother;
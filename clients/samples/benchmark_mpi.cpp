@@ -53,6 +53,8 @@ int main(int argc, char* argv[])
     if(argc < 2)
     {
         std::cerr << argv[0] << " <global_matrix>" << std::endl;
+        std::cerr << argv[0] << " -laplace <grid points per process and direction>"
+                  << std::endl;
         return -1;
     }
 
@@ -68,16 +70,33 @@ int main(int argc, char* argv[])
     // Print platform
     info_rocalution();
 
-    // Load undistributed matrix
-    LocalMatrix<ValueType> lmat;
-    lmat.ReadFileMTX(argv[1]);
-
     // Global structures
     ParallelManager         manager;
     GlobalMatrix<ValueType> mat;
 
-    // Distribute matrix - lmat will be destroyed
-    distribute_matrix(&comm, &lmat, &mat, &manager);
+    if(std::string(argv[1]) == "-laplace" && argc > 2)
+    {
+        // Generate a 27 point Laplacian of fixed size per process
+        int n = atoi(argv[2]);
+
+        MatrixGenerator<ValueType> gen;
+
+        gen.SetGrid(n, n, n * num_procs);
+        gen.SetProcessGrid(1, 1, num_procs);
+        gen.SetLaplace(27);
+
+        manager.SetMPICommunicator(&comm);
+        gen.Generate(&manager, &mat);
+    }
+    else
+    {
+        // Load undistributed matrix
+        LocalMatrix<ValueType> lmat;
+        lmat.ReadFileMTX(argv[1]);
+
+        // Distribute matrix - lmat will be destroyed
+        distribute_matrix(&comm, &lmat, &mat, &manager);
+    }
 
     // rocALUTION vectors
     GlobalVector<ValueType> v1(manager);
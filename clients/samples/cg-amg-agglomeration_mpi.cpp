@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cstdlib>
+#include <iostream>
+#include <mpi.h>
+#include <rocalution.hpp>
+
+#define ValueType double
+
+using namespace rocalution;
+
+int main(int argc, char* argv[])
+{
+    // Initialize MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Check command line parameters
+    if(num_procs < 2)
+    {
+        std::cerr << "Expecting at least 2 MPI processes" << std::endl;
+        MPI_Finalize();
+        return -1;
+    }
+
+    // Grid points per process and direction
+    int n = (argc > 1) ? atoi(argv[1]) : 20;
+
+    // Disable OpenMP thread affinity
+    set_omp_affinity_rocalution(false);
+
+    // Initialize platform with rank and # of accelerator devices in the node
+    init_rocalution(rank, 2);
+
+    // Disable OpenMP
+    set_omp_threads_rocalution(1);
+
+    // Print platform
+    info_rocalution();
+
+    // Global structures
+    ParallelManager         manager;
+    GlobalMatrix<ValueType> mat;
+
+    // Generate a 7 point Laplacian of fixed size per process
+    MatrixGenerator<ValueType> gen;
+
+    gen.SetGrid(n, n, n * num_procs);
+    gen.SetProcessGrid(1, 1, num_procs);
+    gen.SetLaplace(7);
+
+    manager.SetMPICommunicator(&comm);
+    gen.Generate(&manager, &mat);
+
+    // rocALUTION vectors
+    GlobalVector<ValueType> rhs(manager);
+    GlobalVector<ValueType> x(manager);
+    GlobalVector<ValueType> e(manager);
+
+    // Allocate memory
+    rhs.Allocate("rhs", mat.GetM());
+    x.Allocate("x", mat.GetN());
+    e.Allocate("sol", mat.GetN());
+
+    e.Ones();
+    mat.Apply(e, &rhs);
+
+    mat.Info();
+
+    bool failed = false;
+
+    // Pairwise AMG without agglomeration, i.e. all levels on all processes, and with the
+    // coarse levels agglomerated once they have less than 500 rows per process
+    for(int size = 0; size <= 500; size += 500)
+    {
+        CG<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType>                ls;
+        GlobalPairwiseAMG<GlobalMatrix<ValueType>, GlobalVector<ValueType>, ValueType> p;
+
+        p.SetAgglomerationSize(size);
+        p.InitMaxIter(1);
+        p.Verbose(0);
+
+        ls.SetPreconditioner(p);
+        ls.SetOperator(mat);
+        ls.Init(1e-10, 1e-8, 1e+8, 10000);
+        ls.Verbose(0);
+
+        double time = rocalution_time();
+
+        ls.Build();
+
+        time = rocalution_time() - time;
+
+        x.Zeros();
+
+        double solve_time = rocalution_time();
+
+        ls.Solve(rhs, &x);
+
+        solve_time = rocalution_time() - solve_time;
+
+        int iter   = ls.GetIterationCount();
+        int status = ls.GetSolverStatus();
+
+        x.ScaleAdd(-1.0, e);
+        double nrm2 = x.Norm();
+
+        // The relative residual has to be reached with both hierarchies
+        if(status != 2)
+        {
+            failed = true;
+        }
+
+        if(rank == 0)
+        {
+            if(size == 0)
+            {
+                std::cout << "Without agglomeration:";
+            }
+            else
+            {
+                std::cout << "Agglomeration size " << size << ":";
+            }
+
+            std::cout << " levels " << p.GetNumLevels() << ", iterations " << iter
+                      << ", building " << time / 1e6 << " sec, solving " << solve_time / 1e6
+                      << " sec, ||e - x||_2 = " << nrm2 << std::endl;
+
+            if(status != 2)
+            {
+                std::cout << "CG did not converge" << std::endl;
+            }
+        }
+
+        ls.Clear();
+    }
+
+    stop_rocalution();
+
+    MPI_Finalize();
+
+    return (failed == true) ? 1 : 0;
+}
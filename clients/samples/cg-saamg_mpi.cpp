@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "common.hpp"
+
+#include <iostream>
+#include <mpi.h>
+#include <rocalution.hpp>
+#include <string>
+
+#define ValueType double
+
+using namespace rocalution;
+
+int main(int argc, char* argv[])
+{
+    // Initialize MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Check command line parameters
+    if(argc < 2)
+    {
+        std::cerr << argv[0] << " <global_matrix>" << std::endl;
+        std::cerr << argv[0] << " -elasticity <grid points per direction>" << std::endl;
+        return -1;
+    }
+
+    // Disable OpenMP thread affinity
+    set_omp_affinity_rocalution(false);
+
+    // Initialize platform with rank and # of accelerator devices in the node
+    init_rocalution(rank, 2);
+
+    // Disable OpenMP
+    set_omp_threads_rocalution(1);
+
+    // Print platform
+    info_rocalution();
+
+    // Global structures
+    ParallelManager         manager;
+    GlobalMatrix<ValueType> mat;
+
+    if(std::string(argv[1]) == "-elasticity" && argc > 2)
+    {
+        // Generate a linear elasticity problem on a cube
+        int n = atoi(argv[2]);
+
+        MatrixGenerator<ValueType> gen;
+
+        gen.SetGrid(n, n, n);
+        gen.SetElasticity(1.0, 1.0);
+
+        manager.SetMPICommunicator(&comm);
+        gen.Generate(&manager, &mat);
+    }
+    else
+    {
+        // Load undistributed matrix
+        LocalMatrix<ValueType> lmat;
+        lmat.ReadFileMTX(argv[1]);
+
+        // Distribute matrix - lmat will be destroyed
+        distribute_matrix(&comm, &lmat, &mat, &manager);
+    }
+
+    // rocALUTION vectors
+    GlobalVector<ValueType> rhs(manager);
+    GlobalVector<ValueType> x(manager);
+    GlobalVector<ValueType> e(manager);
+
+    // Allocate memory
+    rhs.Allocate("rhs", mat.GetM());
+    x.Allocate("x", mat.GetN());
+    e.Allocate("sol", mat.GetN());
+
+    // Initialize rhs such that A 1 = rhs
+    e.Ones();
+    mat.Apply(e, &rhs);
+
+    // Initial zero guess
+    x.Zeros();
+
+    // Linear solver
+    CG<GlobalMatrix<double>, GlobalVector<double>, double> ls;
+    // Global preconditioner
+    GlobalSAAMG<GlobalMatrix<double>, GlobalVector<double>, double> p;
+
+    // Limit number of AMG preconditioner iterations to 1 iteration per CG iteration
+    p.InitMaxIter(1);
+    // Disable AMG preconditioner verbosity output
+    p.Verbose(0);
+
+    // Set solver preconditioner
+    ls.SetPreconditioner(p);
+    // Set solver operator
+    ls.SetOperator(mat);
+
+    // Start time measurement
+    double time = rocalution_time();
+
+    // Build solver, the aggregates may span process boundaries
+    ls.Build();
+
+    // Stop time measurement
+    time = rocalution_time() - time;
+    if(rank == 0)
+    {
+        std::cout << "Building: " << time / 1e6 << " sec" << std::endl;
+    }
+
+    // Move structures to accelerator, if available
+    mat.MoveToAccelerator();
+    rhs.MoveToAccelerator();
+    x.MoveToAccelerator();
+    e.MoveToAccelerator();
+    ls.MoveToAccelerator();
+
+    // Set verbosity output
+    ls.Verbose(2);
+
+    // Print matrix info
+    mat.Info();
+
+    // Start time measurement
+    time = rocalution_time();
+
+    // Solve A x = rhs
+    ls.Solve(rhs, &x);
+
+    // Stop time measurement
+    time = rocalution_time() - time;
+    if(rank == 0)
+    {
+        std::cout << "Solving: " << time / 1e6 << " sec" << std::endl;
+    }
+
+    // Compute error L2 norm
+    e.ScaleAdd(-1.0, x);
+    double nrm2 = e.Norm();
+    if(rank == 0)
+    {
+        std::cout << "||e - x||_2 = " << nrm2 << std::endl;
+    }
+
+    // Clear solver
+    ls.Clear();
+
+    // Stop rocALUTION platform
+    stop_rocalution();
+
+    MPI_Finalize();
+
+    return 0;
+}
@@ -127,9 +127,54 @@ int main(int argc, char* argv[])
 
     ls.Clear();
 
+    // Write matrix and solution into single files, all processes write concurrently
+    mat.WriteFileDistributed("global-io_mpi.mat");
+    x.WriteFileDistributed("global-io_mpi.vec");
+
+    // Read them back, the parallel manager is stored together with the matrix
+    ParallelManager pm_read;
+    pm_read.SetMPICommunicator(&comm);
+    pm_read.ReadFileDistributed("global-io_mpi.mat");
+
+    GlobalMatrix<double> mat_read(pm_read);
+    GlobalVector<double> x_read(pm_read);
+
+    mat_read.ReadFileDistributed("global-io_mpi.mat");
+    x_read.ReadFileDistributed("global-io_mpi.vec");
+
+    // Compare x^T A x and x^T x of the original and the read structures
+    GlobalVector<double> y(pm);
+    GlobalVector<double> y_read(pm_read);
+
+    y.CloneBackend(x);
+    y.Allocate("y", mat.GetM());
+    y_read.Allocate("y read", mat_read.GetM());
+
+    mat.Apply(x, &y);
+    mat_read.Apply(x_read, &y_read);
+
+    double xAx      = x.Dot(y);
+    double xAx_read = x_read.Dot(y_read);
+    double xx       = x.Dot(x);
+    double xx_read  = x_read.Dot(x_read);
+
+    // The dot products are global, thus all processes agree on the result
+    bool failed = (xAx != xAx_read || xx != xx_read);
+
+    if(rank == 0)
+    {
+        std::cout << "Distributed I/O round trip: x^T A x = " << xAx << " / " << xAx_read
+                  << ", x^T x = " << xx << " / " << xx_read << std::endl;
+
+        if(failed == true)
+        {
+            std::cout << "Distributed I/O round trip failed" << std::endl;
+        }
+    }
+
     stop_rocalution();
 
     MPI_Finalize();
 
-    return 0;
+    return (failed == true) ? 1 : 0;
 }
@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "common.hpp"
+
+#include <iostream>
+#include <mpi.h>
+#include <rocalution.hpp>
+
+#define ValueType double
+
+using namespace rocalution;
+
+int main(int argc, char* argv[])
+{
+    // Initialize MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    // Check command line parameters
+    if(num_procs < 2)
+    {
+        std::cerr << "Expecting at least 2 MPI processes" << std::endl;
+        return -1;
+    }
+
+    if(argc < 2)
+    {
+        std::cerr << argv[0] << " <global_matrix>" << std::endl;
+        return -1;
+    }
+
+    // Disable OpenMP thread affinity
+    set_omp_affinity_rocalution(false);
+
+    // Initialize platform with rank and # of accelerator devices in the node
+    init_rocalution(rank, 2);
+
+    // Disable OpenMP
+    set_omp_threads_rocalution(1);
+
+    // Print platform
+    info_rocalution();
+
+    // Load undistributed matrix
+    LocalMatrix<ValueType> lmat;
+    lmat.ReadFileMTX(argv[1]);
+
+    // Global structures
+    ParallelManager         manager;
+    GlobalMatrix<ValueType> mat;
+
+    // Distribute matrix - lmat will be destroyed
+    distribute_matrix(&comm, &lmat, &mat, &manager);
+
+    // rocALUTION vectors
+    GlobalVector<ValueType> rhs(manager);
+    GlobalVector<ValueType> x(manager);
+    GlobalVector<ValueType> e(manager);
+
+    // Move structures to accelerator, if available
+    mat.MoveToAccelerator();
+    rhs.MoveToAccelerator();
+    x.MoveToAccelerator();
+    e.MoveToAccelerator();
+
+    // Allocate memory
+    rhs.Allocate("rhs", mat.GetM());
+    x.Allocate("x", mat.GetN());
+    e.Allocate("sol", mat.GetN());
+
+    e.Ones();
+    mat.Apply(e, &rhs);
+
+    mat.Info();
+
+    // Block-Jacobi as reference, followed by restricted additive Schwarz with increasing
+    // overlap. Both apply ILU(8) on each process. Overlap 0 is equivalent to Block-Jacobi.
+    int bj_iter = 0;
+
+    for(int overlap = -1; overlap <= 3; ++overlap)
+    {
+        FGMRES<GlobalMatrix<double>, GlobalVector<double>, double>      ls;
+        BlockJacobi<GlobalMatrix<double>, GlobalVector<double>, double> bj;
+        GlobalRAS<GlobalMatrix<double>, GlobalVector<double>, double>   ras;
+        ILU<LocalMatrix<double>, LocalVector<double>, double>           p;
+
+        p.Set(8);
+
+        if(overlap < 0)
+        {
+            bj.Set(p);
+            ls.SetPreconditioner(bj);
+        }
+        else
+        {
+            ras.Set(p);
+            ras.SetOverlap(overlap);
+            ls.SetPreconditioner(ras);
+        }
+
+        ls.SetOperator(mat);
+        ls.Init(1e-10, 1e-8, 1e+8, 10000);
+        ls.Build();
+        ls.Verbose(0);
+
+        x.Zeros();
+
+        double time = rocalution_time();
+
+        ls.Solve(rhs, &x);
+
+        time = rocalution_time() - time;
+
+        int iter = ls.GetIterationCount();
+
+        if(overlap < 0)
+        {
+            bj_iter = iter;
+        }
+
+        x.ScaleAdd(-1.0, e);
+        double nrm2 = x.Norm();
+
+        if(rank == 0)
+        {
+            if(overlap < 0)
+            {
+                std::cout << "Block-Jacobi:";
+            }
+            else
+            {
+                std::cout << "RAS, overlap " << overlap << ":";
+            }
+
+            std::cout << " iterations " << iter << ", solving " << time / 1e6
+                      << " sec, ||e - x||_2 = " << nrm2 << std::endl;
+        }
+
+        if(overlap == 0 && iter != bj_iter && rank == 0)
+        {
+            std::cerr << "RAS without overlap does not match Block-Jacobi" << std::endl;
+        }
+
+        ls.Clear();
+    }
+
+    stop_rocalution();
+
+    MPI_Finalize();
+
+    return 0;
+}
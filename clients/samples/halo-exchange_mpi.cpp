@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cstdlib>
+#include <iostream>
+#include <mpi.h>
+#include <rocalution.hpp>
+
+using namespace rocalution;
+
+// Generates a 7 point Laplacian on a grid of n x n x (n * num_procs) points
+static void generate_laplace(int n, int num_procs, ParallelManager* pm, GlobalMatrix<double>* mat)
+{
+    MatrixGenerator<double> gen;
+
+    gen.SetGrid(n, n, n * num_procs);
+    gen.SetProcessGrid(1, 1, num_procs);
+    gen.SetLaplace(7);
+    gen.Generate(pm, mat);
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize MPI
+    MPI_Init(&argc, &argv);
+    MPI_Comm comm = MPI_COMM_WORLD;
+
+    int rank;
+    int num_procs;
+
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_procs);
+
+    if(num_procs < 2)
+    {
+        std::cerr << "Expecting more than 1 MPI process\n";
+        MPI_Finalize();
+        return -1;
+    }
+
+    int n = (argc > 1) ? atoi(argv[1]) : 16;
+
+    // Disable OpenMP thread affinity
+    set_omp_affinity_rocalution(false);
+
+    // Initialize platform with rank and # of accelerator devices in the node
+    init_rocalution(rank, 2);
+
+    // Disable OpenMP
+    set_omp_threads_rocalution(1);
+
+    // Print platform
+    info_rocalution();
+
+    bool failed = false;
+
+    // The ghost values are exchanged by persistent requests, which are set up by the first
+    // product and reused by all further products on the same parallel manager
+    ParallelManager pm;
+    pm.SetMPICommunicator(&comm);
+
+    GlobalMatrix<double> mat;
+    generate_laplace(n, num_procs, &pm, &mat);
+
+    GlobalVector<double> x(pm);
+    GlobalVector<double> y(pm);
+
+    x.Allocate("x", mat.GetN());
+    y.Allocate("y", mat.GetM());
+
+    x.SetRandomUniform(12345ULL, -1.0, 1.0);
+
+    mat.Apply(x, &y);
+    double xAx = x.Dot(y);
+
+    // Repeated products reuse the exchange and give the same result
+    for(int i = 0; i < 3; ++i)
+    {
+        mat.Apply(x, &y);
+
+        if(x.Dot(y) != xAx)
+        {
+            failed = true;
+        }
+    }
+
+    // Store the problem, the parallel manager holds the communication pattern. The vector
+    // is read back, such that both products below use the same rounded values.
+    pm.WriteFileASCII("halo-exchange_mpi.pm");
+    mat.WriteFileMTX("halo-exchange_mpi.mtx");
+    x.WriteFileASCII("halo-exchange_mpi.vec");
+
+    // The head files are written by rank 0 only
+    MPI_Barrier(comm);
+
+    x.ReadFileASCII("halo-exchange_mpi.vec");
+
+    mat.Apply(x, &y);
+    xAx = x.Dot(y);
+
+    // A parallel manager with a different communication pattern and its own exchange
+    ParallelManager pm_other;
+    pm_other.SetMPICommunicator(&comm);
+
+    {
+        GlobalMatrix<double> mat_other;
+        generate_laplace(n + 3, num_procs, &pm_other, &mat_other);
+
+        GlobalVector<double> x_other(pm_other);
+        GlobalVector<double> y_other(pm_other);
+
+        x_other.Allocate("x", mat_other.GetN());
+        y_other.Allocate("y", mat_other.GetM());
+
+        x_other.Ones();
+        mat_other.Apply(x_other, &y_other);
+    }
+
+    // Reading the pattern of the first problem replaces the exchange of the old pattern
+    pm_other.ReadFileASCII("halo-exchange_mpi.pm");
+
+    GlobalMatrix<double> mat_read(pm_other);
+    GlobalVector<double> x_read(pm_other);
+    GlobalVector<double> y_read(pm_other);
+
+    mat_read.ReadFileMTX("halo-exchange_mpi.mtx");
+    x_read.ReadFileASCII("halo-exchange_mpi.vec");
+    y_read.Allocate("y", mat_read.GetM());
+
+    mat_read.Apply(x_read, &y_read);
+    double xAx_read = x_read.Dot(y_read);
+
+    // Both products perform the same operations, thus the results are identical
+    if(xAx_read != xAx)
+    {
+        failed = true;
+    }
+
+    if(rank == 0)
+    {
+        std::cout << "Halo exchange: x^T A x = " << xAx << " / " << xAx_read << std::endl;
+
+        if(failed == true)
+        {
+            std::cout << "Halo exchange failed" << std::endl;
+        }
+    }
+
+    stop_rocalution();
+
+    MPI_Finalize();
+
+    return (failed == true) ? 1 : 0;
+}
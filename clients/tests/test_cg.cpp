@@ -36,10 +36,13 @@ std::string  cg_precond[] = {"None",
                             "TNS",
                             "Jacobi",
                             "SGS",
+                            "SSOR",
                             "ILU",
                             "ILUT",
                             "IC",
+                            "ICT",
                             "MCSGS",
+                            "MCSGS-Stream",
                             "MCILU"};
 unsigned int cg_format[]  = {1, 2, 4, 5, 6, 7};
 
@@ -73,6 +76,26 @@ TEST_P(parameterized_cg, cg_double)
     ASSERT_EQ(testing_cg<double>(arg), true);
 }
 
+TEST(cg_checkpoint, cg_float)
+{
+    ASSERT_EQ(testing_cg_checkpoint<float>(), true);
+}
+
+TEST(cg_checkpoint, cg_double)
+{
+    ASSERT_EQ(testing_cg_checkpoint<double>(), true);
+}
+
+TEST(cg_async_build, cg_float)
+{
+    ASSERT_EQ(testing_cg_async_build<float>(), true);
+}
+
+TEST(cg_async_build, cg_double)
+{
+    ASSERT_EQ(testing_cg_async_build<double>(), true);
+}
+
 INSTANTIATE_TEST_CASE_P(cg,
                         parameterized_cg,
                         testing::Combine(testing::ValuesIn(cg_size),
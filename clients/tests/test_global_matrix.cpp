@@ -62,6 +62,21 @@ TEST(global_matrix_bad_args, global_matrix)
 {
     testing_global_matrix_bad_args<float>();
 }
+
+TEST(global_matrix_overlap_bad_args, global_matrix)
+{
+    testing_global_matrix_overlap_bad_args<float>();
+}
+
+TEST(global_matrix_saamg_bad_args, global_matrix)
+{
+    testing_global_matrix_saamg_bad_args<float>();
+}
+
+TEST(global_matrix_agglomerate_bad_args, global_matrix)
+{
+    testing_global_matrix_agglomerate_bad_args<float>();
+}
 /*
 TEST_P(parameterized_backend, backend)
 {
@@ -62,6 +62,86 @@ TEST(local_matrix_bad_args, local_matrix)
 {
     testing_local_matrix_bad_args<float>();
 }
+
+TEST(local_matrix_residual_restrict, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_residual_restrict<float>(), true);
+}
+
+TEST(local_matrix_residual_restrict, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_residual_restrict<double>(), true);
+}
+
+TEST(local_matrix_apply_sub_matrix, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_apply_sub_matrix<float>(), true);
+}
+
+TEST(local_matrix_apply_sub_matrix, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_apply_sub_matrix<double>(), true);
+}
+
+TEST(local_matrix_block_precond, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_block_precond<float>(), true);
+}
+
+TEST(local_matrix_block_precond, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_block_precond<double>(), true);
+}
+
+TEST(local_matrix_ilu_parallel, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_ilu_parallel<float>(), true);
+}
+
+TEST(local_matrix_ilu_parallel, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_ilu_parallel<double>(), true);
+}
+
+TEST(local_matrix_coo_unsorted, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_coo_unsorted<float>(), true);
+}
+
+TEST(local_matrix_coo_unsorted, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_coo_unsorted<double>(), true);
+}
+
+TEST(local_matrix_dia_tiles, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_dia_tiles<float>(), true);
+}
+
+TEST(local_matrix_dia_tiles, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_dia_tiles<double>(), true);
+}
+
+TEST(local_matrix_autotune_cache, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_autotune_cache<float>(), true);
+}
+
+TEST(local_matrix_autotune_cache, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_autotune_cache<double>(), true);
+}
+
+TEST(local_matrix_pairwise_parallel, local_matrix_float)
+{
+    ASSERT_EQ(testing_local_matrix_pairwise_parallel<float>(), true);
+}
+
+TEST(local_matrix_pairwise_parallel, local_matrix_double)
+{
+    ASSERT_EQ(testing_local_matrix_pairwise_parallel<double>(), true);
+}
 /*
 TEST_P(parameterized_backend, backend)
 {
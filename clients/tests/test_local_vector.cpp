@@ -62,6 +62,56 @@ TEST(local_vector_bad_args, local_vector)
 {
     testing_local_vector_bad_args<float>();
 }
+
+TEST(local_vector_view, local_vector_float)
+{
+    ASSERT_EQ(testing_local_vector_view<float>(), true);
+}
+
+TEST(local_vector_view, local_vector_double)
+{
+    ASSERT_EQ(testing_local_vector_view<double>(), true);
+}
+
+TEST(local_vector_dot_future, local_vector_float)
+{
+    ASSERT_EQ(testing_local_vector_dot_future<float>(), true);
+}
+
+TEST(local_vector_dot_future, local_vector_double)
+{
+    ASSERT_EQ(testing_local_vector_dot_future<double>(), true);
+}
+
+TEST(local_vector_reproducible, local_vector_float)
+{
+    ASSERT_EQ(testing_local_vector_reproducible<float>(), true);
+}
+
+TEST(local_vector_reproducible, local_vector_double)
+{
+    ASSERT_EQ(testing_local_vector_reproducible<double>(), true);
+}
+
+TEST(local_vector_blas1, local_vector_float)
+{
+    ASSERT_EQ(testing_local_vector_blas1<float>(), true);
+}
+
+TEST(local_vector_blas1, local_vector_double)
+{
+    ASSERT_EQ(testing_local_vector_blas1<double>(), true);
+}
+
+TEST(local_vector_copy_permute, local_vector_float)
+{
+    ASSERT_EQ(testing_local_vector_copy_permute<float>(), true);
+}
+
+TEST(local_vector_copy_permute, local_vector_double)
+{
+    ASSERT_EQ(testing_local_vector_copy_permute<double>(), true);
+}
 /*
 TEST_P(parameterized_backend, backend)
 {
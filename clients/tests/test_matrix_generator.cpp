@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_matrix_generator.hpp"
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+
+typedef std::tuple<int, std::string> matrix_generator_tuple;
+
+int         matrix_generator_size[]   = {4, 11};
+std::string matrix_generator_matrix[] = {"Laplace7",
+                                         "Laplace27",
+                                         "AnisotropicDiffusion",
+                                         "JumpingDiffusion",
+                                         "Elasticity",
+                                         "ConvectionDiffusion",
+                                         "PowerLawGraph"};
+
+class parameterized_matrix_generator : public testing::TestWithParam<matrix_generator_tuple>
+{
+protected:
+    parameterized_matrix_generator() {}
+    virtual ~parameterized_matrix_generator() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_matrix_generator_arguments(matrix_generator_tuple tup)
+{
+    Arguments arg;
+    arg.size   = std::get<0>(tup);
+    arg.matrix = std::get<1>(tup);
+    return arg;
+}
+
+TEST_P(parameterized_matrix_generator, matrix_generator_float)
+{
+    Arguments arg = setup_matrix_generator_arguments(GetParam());
+    ASSERT_EQ(testing_matrix_generator<float>(arg), true);
+}
+
+TEST_P(parameterized_matrix_generator, matrix_generator_double)
+{
+    Arguments arg = setup_matrix_generator_arguments(GetParam());
+    ASSERT_EQ(testing_matrix_generator<double>(arg), true);
+}
+
+INSTANTIATE_TEST_CASE_P(matrix_generator,
+                        parameterized_matrix_generator,
+                        testing::Combine(testing::ValuesIn(matrix_generator_size),
+                                         testing::ValuesIn(matrix_generator_matrix)));
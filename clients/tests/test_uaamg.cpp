@@ -59,6 +59,16 @@ Arguments setup_uaamg_arguments(uaamg_tuple tup)
     return arg;
 }
 
+TEST(uaamg_concurrent_build, uaamg_float)
+{
+    ASSERT_EQ(testing_uaamg_concurrent_build<float>(), true);
+}
+
+TEST(uaamg_concurrent_build, uaamg_double)
+{
+    ASSERT_EQ(testing_uaamg_concurrent_build<double>(), true);
+}
+
 TEST_P(parameterized_uaamg, uaamg_float)
 {
     Arguments arg = setup_uaamg_arguments(GetParam());
@@ -38,6 +38,9 @@ else()
   option(SUPPORT_OMP "Compile WITH OpenMP support." ON)
 endif()
 
+# Threads
+find_package(Threads REQUIRED)
+
 # MPI
 find_package(MPI)
 if (NOT MPI_FOUND)
@@ -36,9 +36,11 @@
 #include "host/host_matrix_ell.hpp"
 #include "host/host_matrix_hyb.hpp"
 #include "host/host_matrix_mcsr.hpp"
+#include "host/host_tasks.hpp"
 #include "host/host_vector.hpp"
 #include "version.hpp"
 
+#include <mutex>
 #include <stdlib.h>
 #include <string.h>
 
@@ -89,7 +91,8 @@ namespace rocalution
         0,
         // LOG
         0,
-        NULL // FILE, file log
+        NULL, // FILE, file log
+        false // reproducible reductions
     };
 
     /// Host name
@@ -208,6 +211,7 @@ namespace rocalution
         }
 
         _rocalution_delete_all_obj();
+        _rocalution_clear_pattern_caches();
 
 #ifdef SUPPORT_HIP
         if(_get_backend_descriptor()->disable_accelerator == false)
@@ -319,6 +323,11 @@ namespace rocalution
 
 #ifdef _OPENMP
         LOG_INFO("OpenMP threads: " << backend_descriptor.OpenMP_threads);
+
+        if(backend_descriptor.OpenMP_reproducible == true)
+        {
+            LOG_INFO("OpenMP reductions are reproducible");
+        }
 #else
         LOG_INFO("No OpenMP support");
 #endif
@@ -386,6 +395,11 @@ namespace rocalution
         _get_backend_descriptor()->OpenMP_threshold = threshold;
     }
 
+    void set_omp_reproducible_rocalution(bool reproducible)
+    {
+        _get_backend_descriptor()->OpenMP_reproducible = reproducible;
+    }
+
     bool _rocalution_available_accelerator(void)
     {
         return _get_backend_descriptor()->accelerator;
@@ -521,15 +535,32 @@ namespace rocalution
         else
         {
 #ifdef _OPENMP
-            omp_set_num_threads(backend_descriptor.OpenMP_threads);
+            int threads = backend_descriptor.OpenMP_threads;
+
+            // Host tasks are restricted to their thread budget
+            int budget = _get_host_task_threads();
+
+            if(budget > 0 && budget < threads)
+            {
+                threads = budget;
+            }
+
+            omp_set_num_threads(threads);
 #endif
         }
     }
 
+#ifndef OBJ_TRACKING_OFF
+    // Objects might be created and deleted by concurrent host tasks
+    static std::mutex obj_tracking_mutex;
+#endif
+
     size_t _rocalution_add_obj(class RocalutionObj* ptr)
     {
 #ifndef OBJ_TRACKING_OFF
 
+        std::lock_guard<std::mutex> lock(obj_tracking_mutex);
+
         log_debug(0, "Creating new rocALUTION object, ptr=", ptr);
 
         Rocalution_Object_Data_Tracking.all_obj.push_back(ptr);
@@ -553,6 +584,8 @@ namespace rocalution
 
 #ifndef OBJ_TRACKING_OFF
 
+        std::lock_guard<std::mutex> lock(obj_tracking_mutex);
+
         log_debug(0, "Deleting rocALUTION object, ptr=", ptr);
 
         log_debug(0, "Deleting rocALUTION object, id=", id);
@@ -83,6 +83,9 @@ namespace rocalution
         // Logging
         int            log_mode;
         std::ofstream* log_file;
+
+        // Host reductions are bitwise reproducible (true-yes/false-no)
+        bool OpenMP_reproducible;
     };
 
     // Global backend descriptor
@@ -217,6 +220,21 @@ namespace rocalution
   */
     void set_omp_threshold_rocalution(int threshold);
 
+    /** \ingroup backend_module
+  * \brief Enable/disable bitwise reproducible host reductions
+  * \details
+  * By default, the host reductions (such as dot products and norms) accumulate one
+  * partial sum per OpenMP thread, such that the result can change with the number of
+  * threads. If \p set_omp_reproducible_rocalution is called with true, the reductions
+  * accumulate partial sums over fixed size blocks and combine them pairwise. The result
+  * is then bitwise identical for any number of threads. The setting takes effect
+  * immediately and can be changed at any time.
+  *
+  * @param[in]
+  * reproducible    boolean to turn on/off reproducible host reductions
+  */
+    void set_omp_reproducible_rocalution(bool reproducible);
+
     /** \ingroup backend_module
   * \brief Print info about rocALUTION
   * \details
@@ -286,6 +304,9 @@ namespace rocalution
     void   _rocalution_delete_all_obj(void);
     bool   _rocalution_check_if_any_obj(void);
 
+    // Clear the caches of data that only depends on sparsity patterns
+    void _rocalution_clear_pattern_caches(void);
+
 } // namespace rocalution
 
 #endif // ROCALUTION_BACKEND_MANAGER_HPP_
@@ -320,6 +320,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ICTFactorize(double t, int maxrow, BaseVector<ValueType>* inv_diag)
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Permute(const BaseVector<int>& permutation)
     {
@@ -403,6 +409,42 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::Residual(const BaseVector<ValueType>& b,
+                                         const BaseVector<ValueType>& x,
+                                         BaseVector<ValueType>*       res) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ResidualRestrict(const BaseMatrix<ValueType>& restriction,
+                                                 const BaseVector<ValueType>& b,
+                                                 const BaseVector<ValueType>& x,
+                                                 BaseVector<ValueType>*       coarse,
+                                                 bool                         unique_cols) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ApplyAddSubMatrix(int                          row_offset,
+                                                  int                          col_offset,
+                                                  int                          row_size,
+                                                  int                          col_size,
+                                                  const BaseVector<ValueType>& in,
+                                                  ValueType                    scalar,
+                                                  BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::SupportsApplyAddSubMatrix(void) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::Scale(ValueType alpha)
     {
@@ -533,6 +575,32 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::SSORSolve(ValueType                    omega,
+                                          int                          nblocks,
+                                          const BaseVector<ValueType>& in,
+                                          BaseVector<ValueType>*       out) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::ComponentAveragingSplit(int                    nblocks,
+                                                        BaseMatrix<ValueType>* split,
+                                                        BaseMatrix<ValueType>* average) const
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::KaczmarzSweep(ValueType                    omega,
+                                              int                          nblocks,
+                                              const BaseVector<ValueType>& rhs,
+                                              BaseVector<ValueType>*       x) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     bool BaseMatrix<ValueType>::NumericMatMatMult(const BaseMatrix<ValueType>& A,
                                                   const BaseMatrix<ValueType>& B)
@@ -748,6 +816,12 @@ namespace rocalution
         return false;
     }
 
+    template <typename ValueType>
+    bool BaseMatrix<ValueType>::CopyPatternToCSR(int* row_offsets, int* col) const
+    {
+        return false;
+    }
+
     template <typename ValueType>
     void BaseMatrix<ValueType>::SetDataPtrCOO(
         int** row, int** col, ValueType** val, int nnz, int nrow, int ncol)
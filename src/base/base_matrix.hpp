@@ -232,6 +232,10 @@ namespace rocalution
         /// Copy to CSR array (the arrays have to be allocated)
         virtual void CopyToCSR(int* row_offsets, int* col, ValueType* val) const;
 
+        /// Copy the sparsity pattern to CSR arrays, without the values (the arrays have
+        /// to be allocated)
+        virtual bool CopyPatternToCSR(int* row_offsets, int* col) const;
+
         /// Copy from COO array (the matrix has to be allocated)
         virtual void CopyFromCOO(const int* row, const int* col, const ValueType* val);
 
@@ -307,6 +311,9 @@ namespace rocalution
 
         /// Perform IC(0) factorization
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        /// Perform IC(t,m) factorization based on threshold and maximum
+        /// number of elements per row
+        virtual bool ICTFactorize(double t, int maxrow, BaseVector<ValueType>* inv_diag);
 
         /// Analyse the structure (level-scheduling)
         virtual void LUAnalyse(void);
@@ -347,6 +354,25 @@ namespace rocalution
         /// graph traversing is performed in parallel
         virtual bool USolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
 
+        /// Solve M out = in with the SSOR(omega) matrix M of the diagonal blocks of nblocks
+        /// consecutive row blocks; the blocks are processed in parallel
+        virtual bool SSORSolve(ValueType                    omega,
+                               int                          nblocks,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+        /// Split nblocks consecutive row blocks into split, such that the blocks have
+        /// disjoint columns; average maps the columns of split back to the columns of
+        /// this, each column is averaged over the blocks it appears in
+        virtual bool ComponentAveragingSplit(int                    nblocks,
+                                             BaseMatrix<ValueType>* split,
+                                             BaseMatrix<ValueType>* average) const;
+        /// Forward and backward Kaczmarz sweep with relaxation omega on x, the nblocks
+        /// consecutive row blocks are processed in parallel and need disjoint columns
+        virtual bool KaczmarzSweep(ValueType                    omega,
+                                   int                          nblocks,
+                                   const BaseVector<ValueType>& rhs,
+                                   BaseVector<ValueType>*       x) const;
+
         /// Compute Householder vector
         virtual bool Householder(int idx, ValueType& beta, BaseVector<ValueType>* vec) const;
         /// QR Decomposition
@@ -366,6 +392,29 @@ namespace rocalution
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const = 0;
+        /// Compute the residual in a single pass, res = b - this*x;
+        virtual bool Residual(const BaseVector<ValueType>& b,
+                              const BaseVector<ValueType>& x,
+                              BaseVector<ValueType>*       res) const;
+        /// Compute the restricted residual, coarse = restriction*(b - this*x), without
+        /// storing the residual; unique_cols states that the caller already checked
+        /// that restriction has at most one entry per column
+        virtual bool ResidualRestrict(const BaseMatrix<ValueType>& restriction,
+                                      const BaseVector<ValueType>& b,
+                                      const BaseVector<ValueType>& x,
+                                      BaseVector<ValueType>*       coarse,
+                                      bool                         unique_cols) const;
+        /// Apply and add a sub-matrix to vector without extracting it,
+        /// out = out + scalar*this(rows, cols)*in;
+        virtual bool ApplyAddSubMatrix(int                          row_offset,
+                                       int                          col_offset,
+                                       int                          row_size,
+                                       int                          col_size,
+                                       const BaseVector<ValueType>& in,
+                                       ValueType                    scalar,
+                                       BaseVector<ValueType>*       out) const;
+        /// Return true if ApplyAddSubMatrix() is supported
+        virtual bool SupportsApplyAddSubMatrix(void) const;
 
         /// Delete all entries abs(a_ij) <= drop_off;
         /// the diagonal elements are never deleted
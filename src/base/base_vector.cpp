@@ -40,6 +40,7 @@ namespace rocalution
 
         this->size_       = 0;
         this->index_size_ = 0;
+        this->view_       = false;
     }
 
     template <typename ValueType>
@@ -66,6 +66,8 @@ namespace rocalution
         virtual void SetDataPtr(ValueType** ptr, int size) = 0;
         /// Get a pointer from the vector data and free the vector object
         virtual void LeaveDataPtr(ValueType** ptr) = 0;
+        /// Initialize a vector as view on the data of another vector, starting at offset
+        virtual void SetView(BaseVector<ValueType>& src, int offset, int size) = 0;
 
         /// Clear (free) the vector
         virtual void Clear(void) = 0;
@@ -184,6 +186,8 @@ namespace rocalution
         int size_;
         /// The size of the boundary index
         int index_size_;
+        /// The vector does not own its data
+        bool view_;
 
         /// Backend descriptor (local copy)
         Rocalution_Backend_Descriptor local_backend_;
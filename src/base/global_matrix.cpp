@@ -26,6 +26,7 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "backend_manager.hpp"
 #include "global_vector.hpp"
 #include "local_matrix.hpp"
 #include "local_vector.hpp"
@@ -36,13 +37,331 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <limits>
 #include <sstream>
+#include <typeinfo>
+#include <vector>
 
 namespace rocalution
 {
 
+#ifdef SUPPORT_MULTINODE
+    static const char* _global_matrix_file_id = "#rocALUTION distributed matrix";
+
+    // Values of distributed files are always stored in double precision
+    template <typename ValueType>
+    static void write_file_values(MFile* file, long long offset, const ValueType* val, int n)
+    {
+        if(typeid(ValueType) == typeid(double))
+        {
+            communication_file_write_at(file, offset, val, sizeof(double) * n);
+        }
+        else if(typeid(ValueType) == typeid(float))
+        {
+            std::vector<double> tmp(n);
+
+            for(int i = 0; i < n; ++i)
+            {
+                tmp[i] = rocalution_double(val[i]);
+            }
+
+            communication_file_write_at(file, offset, tmp.data(), sizeof(double) * n);
+        }
+        else
+        {
+            LOG_INFO("WriteFileDistributed: complex values are not supported");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    template <typename ValueType>
+    static void read_file_values(MFile* file, long long offset, ValueType* val, int n)
+    {
+        if(typeid(ValueType) == typeid(double))
+        {
+            communication_file_read_at(file, offset, val, sizeof(double) * n);
+        }
+        else if(typeid(ValueType) == typeid(float))
+        {
+            std::vector<double> tmp(n);
+
+            communication_file_read_at(file, offset, tmp.data(), sizeof(double) * n);
+
+            for(int i = 0; i < n; ++i)
+            {
+                val[i] = static_cast<ValueType>(tmp[i]);
+            }
+        }
+        else
+        {
+            LOG_INFO("ReadFileDistributed: complex values are not supported");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    // First global id of each process, given the local size of this process
+    static void global_offsets(int local_size, int nprocs, const void* comm, IndexType2* offsets)
+    {
+        std::vector<long long> sizes(nprocs);
+
+        communication_allgather_single(local_size, sizes.data(), comm);
+
+        offsets[0] = 0;
+
+        for(int p = 0; p < nprocs; ++p)
+        {
+            offsets[p + 1] = offsets[p] + static_cast<IndexType2>(sizes[p]);
+        }
+    }
+
+    // Copies the rows of a local matrix to the host in CSR format
+    template <typename ValueType>
+    static void host_rows(const LocalMatrix<ValueType>& mat,
+                          int                           nrow,
+                          std::vector<int>*             row_offset,
+                          std::vector<int>*             col,
+                          std::vector<ValueType>*       val)
+    {
+        row_offset->assign(nrow + 1, 0);
+        col->clear();
+        val->clear();
+
+        if(mat.GetNnz() == 0)
+        {
+            return;
+        }
+
+        LocalMatrix<ValueType> tmp;
+        tmp.CloneFrom(mat);
+        tmp.MoveToHost();
+        tmp.ConvertToCSR();
+
+        assert(tmp.GetLocalM() == nrow);
+
+        int        nnz = tmp.GetLocalNnz();
+        int*       ro  = NULL;
+        int*       c   = NULL;
+        ValueType* v   = NULL;
+
+        tmp.LeaveDataPtrCSR(&ro, &c, &v);
+
+        row_offset->assign(ro, ro + nrow + 1);
+        col->assign(c, c + nnz);
+        val->assign(v, v + nnz);
+
+        free_host(&ro);
+        free_host(&c);
+        free_host(&v);
+    }
+
+    // Rows of the interior and the ghost part on the host in CSR format, the ghost
+    // columns follow the ncol interior columns
+    template <typename ValueType>
+    static void extended_rows(const LocalMatrix<ValueType>& interior,
+                              const LocalMatrix<ValueType>& ghost,
+                              int                           nrow,
+                              int                           ncol,
+                              std::vector<int>*             row_offset,
+                              std::vector<int>*             col,
+                              std::vector<ValueType>*       val)
+    {
+        std::vector<int>       int_row_offset;
+        std::vector<int>       int_col;
+        std::vector<ValueType> int_val;
+        std::vector<int>       gst_row_offset;
+        std::vector<int>       gst_col;
+        std::vector<ValueType> gst_val;
+
+        host_rows(interior, nrow, &int_row_offset, &int_col, &int_val);
+        host_rows(ghost, nrow, &gst_row_offset, &gst_col, &gst_val);
+
+        row_offset->resize(nrow + 1);
+        col->resize(int_col.size() + gst_col.size());
+        val->resize(int_val.size() + gst_val.size());
+
+        int k = 0;
+
+        (*row_offset)[0] = 0;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(int j = int_row_offset[i]; j < int_row_offset[i + 1]; ++j)
+            {
+                (*col)[k] = int_col[j];
+                (*val)[k] = int_val[j];
+                ++k;
+            }
+
+            for(int j = gst_row_offset[i]; j < gst_row_offset[i + 1]; ++j)
+            {
+                (*col)[k] = ncol + gst_col[j];
+                (*val)[k] = gst_val[j];
+                ++k;
+            }
+
+            (*row_offset)[i + 1] = k;
+        }
+    }
+
+    // Appends the rows of b to the rows of a
+    template <typename ValueType>
+    static void append_rows(std::vector<int>*              a_row_offset,
+                            std::vector<IndexType2>*       a_col,
+                            std::vector<ValueType>*        a_val,
+                            const std::vector<int>&        b_row_offset,
+                            const std::vector<IndexType2>& b_col,
+                            const std::vector<ValueType>&  b_val)
+    {
+        int nnz = a_row_offset->back();
+
+        for(size_t i = 1; i < b_row_offset.size(); ++i)
+        {
+            a_row_offset->push_back(nnz + b_row_offset[i]);
+        }
+
+        a_col->insert(a_col->end(), b_col.begin(), b_col.end());
+        a_val->insert(a_val->end(), b_val.begin(), b_val.end());
+    }
+
+    // Sparse product of the rows of A with the rows of B, the columns of A are rows of B.
+    // The columns of B and of the product are global ids.
+    template <typename ValueType>
+    static void multiply_rows(const std::vector<int>&        a_row_offset,
+                              const std::vector<int>&        a_col,
+                              const std::vector<ValueType>&  a_val,
+                              const std::vector<int>&        b_row_offset,
+                              const std::vector<IndexType2>& b_col,
+                              const std::vector<ValueType>&  b_val,
+                              std::vector<int>*              c_row_offset,
+                              std::vector<IndexType2>*       c_col,
+                              std::vector<ValueType>*        c_val)
+    {
+        int nrow = static_cast<int>(a_row_offset.size()) - 1;
+
+        // Compress the columns of B, such that a dense marker can be used
+        std::vector<IndexType2> ids(b_col);
+
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+        int ncol = static_cast<int>(ids.size());
+
+        std::vector<int> b_idx(b_col.size());
+
+        for(size_t j = 0; j < b_col.size(); ++j)
+        {
+            b_idx[j] = static_cast<int>(std::lower_bound(ids.begin(), ids.end(), b_col[j])
+                                        - ids.begin());
+        }
+
+        c_row_offset->assign(nrow + 1, 0);
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), nrow);
+
+        // Count the entries of each row
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int> marker(ncol, -1);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                int row_nnz = 0;
+
+                for(int j = a_row_offset[i]; j < a_row_offset[i + 1]; ++j)
+                {
+                    int r = a_col[j];
+
+                    for(int k = b_row_offset[r]; k < b_row_offset[r + 1]; ++k)
+                    {
+                        if(marker[b_idx[k]] != i)
+                        {
+                            marker[b_idx[k]] = i;
+                            ++row_nnz;
+                        }
+                    }
+                }
+
+                (*c_row_offset)[i + 1] = row_nnz;
+            }
+        }
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            (*c_row_offset)[i + 1] += (*c_row_offset)[i];
+        }
+
+        c_col->resize((*c_row_offset)[nrow]);
+        c_val->resize((*c_row_offset)[nrow]);
+
+        // Fill the rows, a thread processes its rows in ascending order
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<int> marker(ncol, -1);
+
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int i = 0; i < nrow; ++i)
+            {
+                int row_begin = (*c_row_offset)[i];
+                int row_end   = row_begin;
+
+                for(int j = a_row_offset[i]; j < a_row_offset[i + 1]; ++j)
+                {
+                    int       r = a_col[j];
+                    ValueType v = a_val[j];
+
+                    for(int k = b_row_offset[r]; k < b_row_offset[r + 1]; ++k)
+                    {
+                        int c = b_idx[k];
+
+                        if(marker[c] < row_begin)
+                        {
+                            marker[c]         = row_end;
+                            (*c_col)[row_end] = ids[c];
+                            (*c_val)[row_end] = v * b_val[k];
+                            ++row_end;
+                        }
+                        else
+                        {
+                            (*c_val)[marker[c]] += v * b_val[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Returns true, if the local unknown i is sent to the neighbour at position pos of
+    // the senders. sent holds the boundary unknowns, sorted for each neighbour.
+    static bool is_sent(const std::vector<int>& sent, const int* send_offset, int pos, int i)
+    {
+        if(pos < 0)
+        {
+            return false;
+        }
+
+        return std::binary_search(
+            sent.begin() + send_offset[pos], sent.begin() + send_offset[pos + 1], i);
+    }
+
+    template <typename ValueType>
+    static bool compare_col(const std::pair<IndexType2, ValueType>& lhs,
+                            const std::pair<IndexType2, ValueType>& rhs)
+    {
+        return lhs.first < rhs.first;
+    }
+#endif
+
     template <typename ValueType>
     GlobalMatrix<ValueType>::GlobalMatrix()
     {
@@ -55,7 +374,9 @@ namespace rocalution
 
         this->object_name_ = "";
 
-        this->nnz_ = 0;
+        this->nnz_    = 0;
+        this->pm_     = NULL;
+        this->pm_row_ = NULL;
     }
 
     template <typename ValueType>
@@ -67,7 +388,8 @@ namespace rocalution
 
         this->object_name_ = "";
 
-        this->pm_ = &pm;
+        this->pm_     = &pm;
+        this->pm_row_ = NULL;
 
         this->nnz_ = 0;
     }
@@ -94,6 +416,11 @@ namespace rocalution
     template <typename ValueType>
     IndexType2 GlobalMatrix<ValueType>::GetM(void) const
     {
+        if(this->pm_row_ != NULL)
+        {
+            return this->pm_row_->GetGlobalSize();
+        }
+
         return this->pm_->GetGlobalSize();
     }
 
@@ -161,6 +488,12 @@ namespace rocalution
         return this->matrix_ghost_;
     }
 
+    template <typename ValueType>
+    const ParallelManager* GlobalMatrix<ValueType>::GetParallelManager(void) const
+    {
+        return this->pm_;
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::SetParallelManager(const ParallelManager& pm)
     {
@@ -168,7 +501,24 @@ namespace rocalution
 
         assert(pm.Status() == true);
 
-        this->pm_ = &pm;
+        this->pm_     = &pm;
+        this->pm_row_ = NULL;
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::SetParallelManager(const ParallelManager& pm_row,
+                                                     const ParallelManager& pm_col)
+    {
+        log_debug(this,
+                  "GlobalMatrix::SetParallelManager()",
+                  (const void*&)pm_row,
+                  (const void*&)pm_col);
+
+        assert(pm_row.Status() == true);
+        assert(pm_col.Status() == true);
+
+        this->pm_     = &pm_col;
+        this->pm_row_ = (&pm_row == &pm_col) ? NULL : &pm_row;
     }
 
     template <typename ValueType>
@@ -810,6 +1160,7 @@ namespace rocalution
 
         this->object_name_ = "Copy from " + src.object_name_;
         this->pm_          = src.pm_;
+        this->pm_row_      = src.pm_row_;
 
         this->nnz_ = src.nnz_;
     }
@@ -873,6 +1224,19 @@ namespace rocalution
         this->matrix_ghost_.ConvertTo(COO);
     }
 
+    template <typename ValueType>
+    unsigned int GlobalMatrix<ValueType>::AutotuneFormat(bool benchmark)
+    {
+        log_debug(this, "GlobalMatrix::AutotuneFormat()", benchmark);
+
+        unsigned int format = this->matrix_interior_.AutotuneFormat(benchmark);
+
+        // Ghost part remains COO
+        this->matrix_ghost_.ConvertTo(COO);
+
+        return format;
+    }
+
     template <typename ValueType>
     void GlobalMatrix<ValueType>::Apply(const GlobalVector<ValueType>& in,
                                         GlobalVector<ValueType>*       out) const
@@ -887,14 +1251,25 @@ namespace rocalution
         assert(this->is_host_() == in.is_host_());
         assert(this->is_host_() == out->is_host_());
 
-        out->UpdateGhostValuesAsync_(in);
+        // The ghost values of a rectangular matrix are distributed as the input vector
+        GlobalVector<ValueType>* ghost
+            = (this->pm_row_ == NULL) ? out : const_cast<GlobalVector<ValueType>*>(&in);
+
+        ghost->UpdateGhostValuesAsync_(in);
 
-        this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
+        if(this->matrix_interior_.GetNnz() > 0)
+        {
+            this->matrix_interior_.Apply(in.vector_interior_, &out->vector_interior_);
+        }
+        else
+        {
+            out->vector_interior_.Zeros();
+        }
 
-        out->UpdateGhostValuesSync_();
+        ghost->UpdateGhostValuesSync_();
 
         this->matrix_ghost_.ApplyAdd(
-            out->vector_ghost_, static_cast<ValueType>(1), &out->vector_interior_);
+            ghost->vector_ghost_, static_cast<ValueType>(1), &out->vector_interior_);
     }
 
     template <typename ValueType>
@@ -912,7 +1287,44 @@ namespace rocalution
         assert(this->is_host_() == in.is_host_());
         assert(this->is_host_() == out->is_host_());
 
-        FATAL_ERROR(__FILE__, __LINE__);
+        GlobalVector<ValueType>* ghost
+            = (this->pm_row_ == NULL) ? out : const_cast<GlobalVector<ValueType>*>(&in);
+
+        ghost->UpdateGhostValuesAsync_(in);
+
+        this->matrix_interior_.ApplyAdd(in.vector_interior_, scalar, &out->vector_interior_);
+
+        ghost->UpdateGhostValuesSync_();
+
+        this->matrix_ghost_.ApplyAdd(ghost->vector_ghost_, scalar, &out->vector_interior_);
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Residual(const GlobalVector<ValueType>& b,
+                                           const GlobalVector<ValueType>& x,
+                                           GlobalVector<ValueType>*       res) const
+    {
+        log_debug(this, "GlobalMatrix::Residual()", (const void*&)b, (const void*&)x, res);
+
+        assert(res != NULL);
+        assert(&x != res);
+
+        assert(this->GetM() == res->GetSize());
+        assert(this->GetM() == b.GetSize());
+        assert(this->GetN() == x.GetSize());
+        assert(this->is_host_() == b.is_host_());
+        assert(this->is_host_() == x.is_host_());
+        assert(this->is_host_() == res->is_host_());
+
+        res->UpdateGhostValuesAsync_(x);
+
+        this->matrix_interior_.Residual(
+            b.vector_interior_, x.vector_interior_, &res->vector_interior_);
+
+        res->UpdateGhostValuesSync_();
+
+        this->matrix_ghost_.ApplyAdd(
+            res->vector_ghost_, static_cast<ValueType>(-1), &res->vector_interior_);
     }
 
     template <typename ValueType>
@@ -1117,6 +1529,188 @@ namespace rocalution
         this->matrix_ghost_.WriteFileCSR(ghost_name);
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ReadFileDistributed(const std::string filename)
+    {
+        log_debug(this, "GlobalMatrix::ReadFileDistributed()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; reading...");
+
+        this->Clear();
+
+#ifdef SUPPORT_MULTINODE
+        MFile     file;
+        long long offset
+            = this->pm_->OpenFileDistributed_(filename, _global_matrix_file_id, false, 0, &file);
+
+        // The parallel manager data has been read already, only check that it matches
+        long long pm_info[6];
+        communication_file_read_at(&file, offset, pm_info, sizeof(pm_info));
+        offset += this->pm_->SizeFileDistributed_();
+
+        if(pm_info[1] != this->pm_->GetLocalSize()
+           || pm_info[4] != this->pm_->GetNumReceivers())
+        {
+            LOG_INFO("ReadFileDistributed: filename=" << filename
+                                                      << "; parallel manager does not match");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        long long info[2];
+        communication_file_read_at(&file, offset, info, sizeof(info));
+        offset += sizeof(info);
+
+        int nrow      = this->pm_->GetLocalSize();
+        int nnz       = static_cast<int>(info[0]);
+        int ghost_nnz = static_cast<int>(info[1]);
+
+        // Interior part in CSR format
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+
+        allocate_host(nrow + 1, &row_offset);
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+        communication_file_read_at(&file, offset, row_offset, sizeof(int) * (nrow + 1));
+        offset += sizeof(int) * (nrow + 1);
+        communication_file_read_at(&file, offset, col, sizeof(int) * nnz);
+        offset += sizeof(int) * nnz;
+        read_file_values(&file, offset, val, nnz);
+        offset += sizeof(double) * nnz;
+
+        this->matrix_interior_.SetDataPtrCSR(
+            &row_offset, &col, &val, "Interior of " + filename, nnz, nrow, nrow);
+
+        // Ghost part in COO format
+        if(ghost_nnz > 0)
+        {
+            int*       ghost_row = NULL;
+            int*       ghost_col = NULL;
+            ValueType* ghost_val = NULL;
+
+            allocate_host(ghost_nnz, &ghost_row);
+            allocate_host(ghost_nnz, &ghost_col);
+            allocate_host(ghost_nnz, &ghost_val);
+
+            communication_file_read_at(&file, offset, ghost_row, sizeof(int) * ghost_nnz);
+            offset += sizeof(int) * ghost_nnz;
+            communication_file_read_at(&file, offset, ghost_col, sizeof(int) * ghost_nnz);
+            offset += sizeof(int) * ghost_nnz;
+            read_file_values(&file, offset, ghost_val, ghost_nnz);
+
+            this->matrix_ghost_.SetDataPtrCOO(&ghost_row,
+                                              &ghost_col,
+                                              &ghost_val,
+                                              "Ghost of " + filename,
+                                              ghost_nnz,
+                                              nrow,
+                                              this->pm_->GetNumReceivers());
+        }
+
+        communication_file_close(&file);
+
+        this->object_name_ = filename;
+
+        IndexType2 nnz_local;
+        IndexType2 nnz_ghost;
+
+        communication_allreduce_single_sum(
+            this->matrix_interior_.GetNnz(), &nnz_local, this->pm_->comm_);
+        communication_allreduce_single_sum(
+            this->matrix_ghost_.GetNnz(), &nnz_ghost, this->pm_->comm_);
+
+        this->nnz_ = nnz_local + nnz_ghost;
+#endif
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; done");
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::WriteFileDistributed(const std::string filename) const
+    {
+        log_debug(this, "GlobalMatrix::WriteFileDistributed()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        LOG_INFO("WriteFileDistributed: filename=" << filename << "; writing...");
+
+#ifdef SUPPORT_MULTINODE
+        // Host copies of the interior part in CSR and the ghost part in COO format
+        LocalMatrix<ValueType> interior;
+        LocalMatrix<ValueType> ghost;
+
+        interior.CloneFrom(this->matrix_interior_);
+        interior.MoveToHost();
+
+        int nrow      = this->pm_->GetLocalSize();
+        int nnz       = interior.GetNnz();
+        int ghost_nnz = this->matrix_ghost_.GetNnz();
+
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+
+        interior.LeaveDataPtrCSR(&row_offset, &col, &val);
+
+        int*       ghost_row = NULL;
+        int*       ghost_col = NULL;
+        ValueType* ghost_val = NULL;
+
+        if(ghost_nnz > 0)
+        {
+            ghost.CloneFrom(this->matrix_ghost_);
+            ghost.MoveToHost();
+            ghost.LeaveDataPtrCOO(&ghost_row, &ghost_col, &ghost_val);
+        }
+
+        long long info[2] = {nnz, ghost_nnz};
+        long long size    = this->pm_->SizeFileDistributed_() + sizeof(info)
+                         + sizeof(int) * (nrow + 1) + (sizeof(int) + sizeof(double)) * nnz
+                         + (2 * sizeof(int) + sizeof(double)) * ghost_nnz;
+
+        MFile     file;
+        long long offset
+            = this->pm_->OpenFileDistributed_(filename, _global_matrix_file_id, true, size, &file);
+
+        offset = this->pm_->WriteFileDistributed_(&file, offset);
+
+        communication_file_write_at(&file, offset, info, sizeof(info));
+        offset += sizeof(info);
+        communication_file_write_at(&file, offset, row_offset, sizeof(int) * (nrow + 1));
+        offset += sizeof(int) * (nrow + 1);
+        communication_file_write_at(&file, offset, col, sizeof(int) * nnz);
+        offset += sizeof(int) * nnz;
+        write_file_values(&file, offset, val, nnz);
+        offset += sizeof(double) * nnz;
+        communication_file_write_at(&file, offset, ghost_row, sizeof(int) * ghost_nnz);
+        offset += sizeof(int) * ghost_nnz;
+        communication_file_write_at(&file, offset, ghost_col, sizeof(int) * ghost_nnz);
+        offset += sizeof(int) * ghost_nnz;
+        write_file_values(&file, offset, ghost_val, ghost_nnz);
+
+        communication_file_close(&file);
+
+        free_host(&row_offset);
+        free_host(&col);
+        free_host(&val);
+
+        if(ghost_nnz > 0)
+        {
+            free_host(&ghost_row);
+            free_host(&ghost_col);
+            free_host(&ghost_val);
+        }
+#endif
+
+        LOG_INFO("WriteFileDistributed: filename=" << filename << "; done");
+    }
+
     template <typename ValueType>
     void
         GlobalMatrix<ValueType>::ExtractInverseDiagonal(GlobalVector<ValueType>* vec_inv_diag) const
@@ -1493,6 +2087,1307 @@ namespace rocalution
 #endif
     }
 
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::AMGSmoothedAggregation(ValueType                eps,
+                                                         ValueType                relax,
+                                                         ParallelManager*         pm,
+                                                         GlobalMatrix<ValueType>* prolong,
+                                                         GlobalMatrix<ValueType>* restrict,
+                                                         GlobalMatrix<ValueType>* coarse) const
+    {
+        log_debug(this,
+                  "GlobalMatrix::AMGSmoothedAggregation()",
+                  eps,
+                  relax,
+                  pm,
+                  prolong,
+                  restrict,
+                  coarse);
+
+        assert(pm != NULL);
+        assert(prolong != NULL);
+        assert(restrict != NULL);
+        assert(coarse != NULL);
+        assert(pm != this->pm_);
+        assert(this->pm_row_ == NULL);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm_fine = *this->pm_;
+
+        int rank   = pm_fine.rank_;
+        int nprocs = pm_fine.num_procs_;
+        int nrow   = pm_fine.GetLocalSize();
+        int nghost = pm_fine.GetNumReceivers();
+
+        // Rows of this process on the host, the ghost columns follow the local ones
+        std::vector<int>       row_offset;
+        std::vector<int>       col;
+        std::vector<ValueType> val;
+
+        extended_rows(
+            this->matrix_interior_, this->matrix_ghost_, nrow, nrow, &row_offset, &col, &val);
+
+        int nnz = row_offset[nrow];
+
+        std::vector<IndexType2> offsets(nprocs + 1);
+        global_offsets(nrow, nprocs, pm_fine.comm_, offsets.data());
+
+        // Global ids and owners of the ghost unknowns
+        std::vector<IndexType2> global(nrow + nghost);
+        std::vector<int>        ghost_owner(nghost);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            global[i] = offsets[rank] + i;
+        }
+
+        ExchangeGhostValues_(pm_fine, global.data(), global.data() + nrow);
+
+        for(int n = 0; n < pm_fine.nrecv_; ++n)
+        {
+            for(int k = pm_fine.recv_offset_index_[n]; k < pm_fine.recv_offset_index_[n + 1];
+                ++k)
+            {
+                ghost_owner[k] = pm_fine.recvs_[n];
+            }
+        }
+
+        // Boundary unknowns of each neighbour, sorted for the lookup
+        std::vector<int> send_pos(nprocs, -1);
+        std::vector<int> sent(pm_fine.boundary_index_,
+                              pm_fine.boundary_index_ + pm_fine.send_index_size_);
+
+        for(int n = 0; n < pm_fine.nsend_; ++n)
+        {
+            send_pos[pm_fine.sends_[n]] = n;
+
+            std::sort(sent.begin() + pm_fine.send_offset_index_[n],
+                      sent.begin() + pm_fine.send_offset_index_[n + 1]);
+        }
+
+        // Diagonal of the local and the ghost unknowns
+        std::vector<ValueType> diag(nrow + nghost, static_cast<ValueType>(0));
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(col[j] == i)
+                {
+                    diag[i] += val[j];
+                }
+            }
+        }
+
+        ExchangeGhostValues_(pm_fine, diag.data(), diag.data() + nrow);
+
+        // Strong couplings, as in LocalMatrix::AMGConnect()
+        std::vector<char> strong(nnz);
+
+        ValueType eps2 = eps * eps;
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+        for(int i = 0; i < nrow; ++i)
+        {
+            ValueType eps_dia_i = eps2 * diag[i];
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int       c = col[j];
+                ValueType v = val[j];
+
+                strong[j] = (c != i) && (v * v > eps_dia_i * diag[c]);
+            }
+        }
+
+        const int undefined = -1;
+        const int removed   = -2;
+
+        // Aggregate of each unknown with its id on the owning process of the aggregate
+        std::vector<int> agg(nrow + nghost);
+        std::vector<int> agg_owner(nrow, rank);
+
+        // Unknowns with strong couplings to other processes are aggregated last
+        std::vector<char> interface(nrow, 0);
+
+        // Remove unknowns without strong couplings
+        for(int i = 0; i < nrow; ++i)
+        {
+            agg[i] = removed;
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(strong[j])
+                {
+                    agg[i] = undefined;
+
+                    if(col[j] >= nrow)
+                    {
+                        interface[i] = 1;
+                    }
+                }
+            }
+        }
+
+        int nc = 0;
+
+        std::vector<int> neib;
+
+        // Plain aggregation as in LocalMatrix::AMGAggregate(), seeded by the unknowns
+        // without strong couplings to other processes
+        for(int i = 0; i < nrow; ++i)
+        {
+            if(agg[i] != undefined || interface[i] == 1)
+            {
+                continue;
+            }
+
+            agg[i] = nc;
+
+            neib.clear();
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int c = col[j];
+
+                if(strong[j] && agg[c] != removed)
+                {
+                    agg[c] = nc;
+                    neib.push_back(c);
+                }
+            }
+
+            for(size_t n = 0; n < neib.size(); ++n)
+            {
+                for(int j = row_offset[neib[n]]; j < row_offset[neib[n] + 1]; ++j)
+                {
+                    int c = col[j];
+
+                    if(strong[j] && c < nrow && agg[c] == undefined)
+                    {
+                        agg[c] = nc;
+                    }
+                }
+            }
+
+            ++nc;
+        }
+
+        // The remaining unknowns join the aggregate of their strongest coupling, which
+        // may be an aggregate of a neighbour. This requires the unknown to be sent to the
+        // neighbour, and this process to keep aggregates of its own.
+        ExchangeGhostValues_(pm_fine, agg.data(), agg.data() + nrow);
+
+        std::vector<int> join(agg.begin(), agg.begin() + nrow);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            if(agg[i] != undefined)
+            {
+                continue;
+            }
+
+            int    best     = -1;
+            double best_val = 0.0;
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int c = col[j];
+
+                if(!strong[j] || agg[c] < 0)
+                {
+                    continue;
+                }
+
+                if(c >= nrow
+                   && (nc == 0
+                       || is_sent(sent,
+                                  pm_fine.send_offset_index_,
+                                  send_pos[ghost_owner[c - nrow]],
+                                  i)
+                              == false))
+                {
+                    continue;
+                }
+
+                double a = std::abs(val[j]);
+
+                if(a > best_val)
+                {
+                    best     = c;
+                    best_val = a;
+                }
+            }
+
+            if(best >= 0)
+            {
+                join[i] = agg[best];
+
+                if(best >= nrow)
+                {
+                    agg_owner[i] = ghost_owner[best - nrow];
+                }
+            }
+        }
+
+        std::copy(join.begin(), join.end(), agg.begin());
+
+        // New aggregates of the unknowns, which are still undefined
+        for(int i = 0; i < nrow; ++i)
+        {
+            if(agg[i] != undefined)
+            {
+                continue;
+            }
+
+            agg[i] = nc;
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int c = col[j];
+
+                if(strong[j] && c < nrow && agg[c] == undefined)
+                {
+                    agg[c] = nc;
+                }
+            }
+
+            ++nc;
+        }
+
+        // Each process keeps at least one coarse unknown
+        if(nc == 0)
+        {
+            agg[0]       = 0;
+            agg_owner[0] = rank;
+            nc           = 1;
+        }
+
+        std::vector<IndexType2> coarse_offsets(nprocs + 1);
+        global_offsets(nc, nprocs, pm_fine.comm_, coarse_offsets.data());
+
+        IndexType2 coarse_begin = coarse_offsets[rank];
+
+        // Global aggregates of the local and the ghost unknowns
+        std::vector<IndexType2> agg_global(nrow + nghost);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            agg_global[i] = (agg[i] < 0) ? -1 : coarse_offsets[agg_owner[i]] + agg[i];
+        }
+
+        ExchangeGhostValues_(pm_fine, agg_global.data(), agg_global.data() + nrow);
+
+        // Smoothed prolongation, as in LocalMatrix::AMGSmoothedAggregation(). Couplings
+        // to aggregates of a neighbour are dropped, if the unknown is not sent to it,
+        // such that the restriction only requires the ghost unknowns of this level.
+        std::vector<int>        p_row_offset(1, 0);
+        std::vector<IndexType2> p_col;
+        std::vector<ValueType>  p_val;
+
+        std::vector<std::pair<IndexType2, ValueType>> entries;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            // Diagonal of the filtered matrix is the original diagonal minus its weak
+            // couplings
+            ValueType dia = static_cast<ValueType>(0);
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(col[j] == i)
+                {
+                    dia += val[j];
+                }
+                else if(!strong[j])
+                {
+                    dia -= val[j];
+                }
+            }
+
+            dia = static_cast<ValueType>(1) / dia;
+
+            entries.clear();
+
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int c = col[j];
+
+                if(c != i && !strong[j])
+                {
+                    continue;
+                }
+
+                IndexType2 g = agg_global[c];
+
+                if(g < 0)
+                {
+                    continue;
+                }
+
+                int owner = static_cast<int>(
+                    std::upper_bound(coarse_offsets.begin(), coarse_offsets.end(), g)
+                    - coarse_offsets.begin() - 1);
+
+                if(owner != rank
+                   && is_sent(sent, pm_fine.send_offset_index_, send_pos[owner], i) == false)
+                {
+                    continue;
+                }
+
+                ValueType v = (c == i) ? static_cast<ValueType>(1) - relax : -relax * dia * val[j];
+
+                entries.push_back(std::make_pair(g, v));
+            }
+
+            std::sort(entries.begin(), entries.end(), compare_col<ValueType>);
+
+            for(size_t k = 0; k < entries.size(); ++k)
+            {
+                if(k > 0 && entries[k].first == entries[k - 1].first)
+                {
+                    p_val.back() += entries[k].second;
+                }
+                else
+                {
+                    p_col.push_back(entries[k].first);
+                    p_val.push_back(entries[k].second);
+                }
+            }
+
+            p_row_offset.push_back(static_cast<int>(p_col.size()));
+        }
+
+        // Rows of the prolongation of the ghost unknowns
+        std::vector<int>        pg_row_offset;
+        std::vector<IndexType2> pg_col;
+        std::vector<ValueType>  pg_val;
+
+        ExchangeGhostRows_(pm_fine, p_row_offset, p_col, p_val, &pg_row_offset, &pg_col, &pg_val);
+
+        // Restriction as the transpose of the prolongation, for the aggregates of this
+        // process. Its couplings to ghost unknowns are found in their prolongation rows.
+        std::vector<int> r_row_offset(nc + 1, 0);
+
+        for(int i = 0; i < nrow + nghost; ++i)
+        {
+            const std::vector<int>&        ro = (i < nrow) ? p_row_offset : pg_row_offset;
+            const std::vector<IndexType2>& pc = (i < nrow) ? p_col : pg_col;
+            int                            r  = (i < nrow) ? i : i - nrow;
+
+            for(int j = ro[r]; j < ro[r + 1]; ++j)
+            {
+                if(pc[j] >= coarse_begin && pc[j] < coarse_begin + nc)
+                {
+                    ++r_row_offset[pc[j] - coarse_begin + 1];
+                }
+            }
+        }
+
+        for(int i = 0; i < nc; ++i)
+        {
+            r_row_offset[i + 1] += r_row_offset[i];
+        }
+
+        std::vector<int>       r_col(r_row_offset[nc]);
+        std::vector<ValueType> r_val(r_row_offset[nc]);
+        std::vector<int>       r_pos(r_row_offset.begin(), r_row_offset.end() - 1);
+
+        for(int i = 0; i < nrow + nghost; ++i)
+        {
+            const std::vector<int>&        ro = (i < nrow) ? p_row_offset : pg_row_offset;
+            const std::vector<IndexType2>& pc = (i < nrow) ? p_col : pg_col;
+            const std::vector<ValueType>&  pv = (i < nrow) ? p_val : pg_val;
+            int                            r  = (i < nrow) ? i : i - nrow;
+
+            for(int j = ro[r]; j < ro[r + 1]; ++j)
+            {
+                if(pc[j] >= coarse_begin && pc[j] < coarse_begin + nc)
+                {
+                    int pos = r_pos[pc[j] - coarse_begin]++;
+
+                    r_col[pos] = i;
+                    r_val[pos] = pv[j];
+                }
+            }
+        }
+
+        // Galerkin product with the prolongation rows of the local and the ghost unknowns
+        std::vector<int>        pe_row_offset(p_row_offset);
+        std::vector<IndexType2> pe_col(p_col);
+        std::vector<ValueType>  pe_val(p_val);
+
+        append_rows(&pe_row_offset, &pe_col, &pe_val, pg_row_offset, pg_col, pg_val);
+
+        std::vector<int>        c_row_offset;
+        std::vector<IndexType2> c_col;
+        std::vector<ValueType>  c_val;
+
+        GalerkinProduct_(pm_fine,
+                         row_offset,
+                         col,
+                         val,
+                         r_row_offset,
+                         r_col,
+                         r_val,
+                         pe_row_offset,
+                         pe_col,
+                         pe_val,
+                         &c_row_offset,
+                         &c_col,
+                         &c_val);
+
+        // The ghost unknowns of the coarse level are the columns of other processes in the
+        // coarse operator and in the prolongation
+        std::vector<IndexType2> coarse_ghost;
+
+        for(size_t j = 0; j < c_col.size(); ++j)
+        {
+            if(c_col[j] < coarse_begin || c_col[j] >= coarse_begin + nc)
+            {
+                coarse_ghost.push_back(c_col[j]);
+            }
+        }
+
+        for(size_t j = 0; j < p_col.size(); ++j)
+        {
+            if(p_col[j] < coarse_begin || p_col[j] >= coarse_begin + nc)
+            {
+                coarse_ghost.push_back(p_col[j]);
+            }
+        }
+
+        std::sort(coarse_ghost.begin(), coarse_ghost.end());
+        coarse_ghost.erase(std::unique(coarse_ghost.begin(), coarse_ghost.end()),
+                           coarse_ghost.end());
+
+        pm->Clear();
+        pm->SetMPICommunicator(pm_fine.comm_);
+        pm->SetGlobalSize(coarse_offsets[nprocs]);
+        pm->SetLocalSize(nc);
+        pm->SetGhostGlobalIndex_(
+            static_cast<int>(coarse_ghost.size()), coarse_ghost.data(), coarse_offsets.data());
+
+        coarse->SetGlobalRows_(
+            *pm, *pm, coarse_begin, coarse_ghost.data(), c_row_offset, c_col, c_val);
+        prolong->SetGlobalRows_(
+            pm_fine, *pm, coarse_begin, coarse_ghost.data(), p_row_offset, p_col, p_val);
+
+        // Restriction with the global ids of the fine level
+        std::vector<IndexType2> r_global(r_col.size());
+
+        for(size_t j = 0; j < r_col.size(); ++j)
+        {
+            r_global[j] = global[r_col[j]];
+        }
+
+        restrict->SetGlobalRows_(
+            *pm, pm_fine, offsets[rank], global.data() + nrow, r_row_offset, r_global, r_val);
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::TripleMatrixProduct(const GlobalMatrix<ValueType>& R,
+                                                      const GlobalMatrix<ValueType>& A,
+                                                      const GlobalMatrix<ValueType>& P)
+    {
+        log_debug(this,
+                  "GlobalMatrix::TripleMatrixProduct()",
+                  (const void*&)R,
+                  (const void*&)A,
+                  (const void*&)P);
+
+        assert(this != &R);
+        assert(this != &A);
+        assert(this != &P);
+        assert(A.pm_row_ == NULL);
+        assert(R.pm_ == A.pm_);
+        assert(P.pm_row_ == A.pm_);
+        assert(R.pm_row_ == P.pm_);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm_fine   = *A.pm_;
+        const ParallelManager& pm_coarse = *P.pm_;
+
+        int nprocs = pm_fine.num_procs_;
+        int nrow   = pm_fine.GetLocalSize();
+        int nc     = pm_coarse.GetLocalSize();
+        int ncg    = pm_coarse.GetNumReceivers();
+
+        std::vector<int>       a_row_offset;
+        std::vector<int>       a_col;
+        std::vector<ValueType> a_val;
+        std::vector<int>       r_row_offset;
+        std::vector<int>       r_col;
+        std::vector<ValueType> r_val;
+        std::vector<int>       p_row_offset;
+        std::vector<int>       p_ext_col;
+        std::vector<ValueType> p_val;
+
+        extended_rows(
+            A.matrix_interior_, A.matrix_ghost_, nrow, nrow, &a_row_offset, &a_col, &a_val);
+        extended_rows(
+            R.matrix_interior_, R.matrix_ghost_, nc, nrow, &r_row_offset, &r_col, &r_val);
+        extended_rows(
+            P.matrix_interior_, P.matrix_ghost_, nrow, nc, &p_row_offset, &p_ext_col, &p_val);
+
+        // Global ids of the coarse level
+        std::vector<IndexType2> coarse_offsets(nprocs + 1);
+        global_offsets(nc, nprocs, pm_coarse.comm_, coarse_offsets.data());
+
+        std::vector<IndexType2> coarse_global(nc + ncg);
+
+        for(int i = 0; i < nc; ++i)
+        {
+            coarse_global[i] = coarse_offsets[pm_coarse.rank_] + i;
+        }
+
+        ExchangeGhostValues_(pm_coarse, coarse_global.data(), coarse_global.data() + nc);
+
+        std::vector<IndexType2> p_col(p_ext_col.size());
+
+        for(size_t j = 0; j < p_ext_col.size(); ++j)
+        {
+            p_col[j] = coarse_global[p_ext_col[j]];
+        }
+
+        std::vector<int>        pg_row_offset;
+        std::vector<IndexType2> pg_col;
+        std::vector<ValueType>  pg_val;
+
+        ExchangeGhostRows_(pm_fine, p_row_offset, p_col, p_val, &pg_row_offset, &pg_col, &pg_val);
+        append_rows(&p_row_offset, &p_col, &p_val, pg_row_offset, pg_col, pg_val);
+
+        std::vector<int>        c_row_offset;
+        std::vector<IndexType2> c_col;
+        std::vector<ValueType>  c_val;
+
+        GalerkinProduct_(pm_fine,
+                         a_row_offset,
+                         a_col,
+                         a_val,
+                         r_row_offset,
+                         r_col,
+                         r_val,
+                         p_row_offset,
+                         p_col,
+                         p_val,
+                         &c_row_offset,
+                         &c_col,
+                         &c_val);
+
+        this->SetGlobalRows_(pm_coarse,
+                             pm_coarse,
+                             coarse_offsets[pm_coarse.rank_],
+                             coarse_global.data() + nc,
+                             c_row_offset,
+                             c_col,
+                             c_val);
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::Agglomerate(int                      nprocs,
+                                              ParallelManager*         pm,
+                                              GlobalMatrix<ValueType>* agg) const
+    {
+        log_debug(this, "GlobalMatrix::Agglomerate()", nprocs, pm, agg);
+
+        assert(pm != NULL);
+        assert(agg != NULL);
+        assert(agg != this);
+        assert(pm != this->pm_);
+        assert(this->pm_row_ == NULL);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm_fine = *this->pm_;
+
+        int rank   = pm_fine.rank_;
+        int size   = pm_fine.num_procs_;
+        int nrow   = pm_fine.GetLocalSize();
+        int nghost = pm_fine.GetNumReceivers();
+
+        pm->SetMPICommunicator(pm_fine, nprocs);
+
+        // Rows of this process with global columns
+        std::vector<int>       row_offset;
+        std::vector<int>       col;
+        std::vector<ValueType> val;
+
+        extended_rows(
+            this->matrix_interior_, this->matrix_ghost_, nrow, nrow, &row_offset, &col, &val);
+
+        int nnz = row_offset[nrow];
+
+        std::vector<IndexType2> offsets(size + 1);
+        global_offsets(nrow, size, pm_fine.comm_, offsets.data());
+
+        std::vector<IndexType2> global(nrow + nghost);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            global[i] = offsets[rank] + i;
+        }
+
+        ExchangeGhostValues_(pm_fine, global.data(), global.data() + nrow);
+
+        std::vector<int>        length(nrow);
+        std::vector<IndexType2> global_col(nnz);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            length[i] = row_offset[i + 1] - row_offset[i];
+        }
+
+        for(int j = 0; j < nnz; ++j)
+        {
+            global_col[j] = global[col[j]];
+        }
+
+        // The row lengths are sent first, such that the receivers know the sizes
+        bool active = pm->IsActive();
+        int  nsrc   = active ? static_cast<int>(pm->parent_offset_.size()) - 1 : 0;
+        int  nloc   = active ? pm->local_size_ : 0;
+
+        const std::vector<int>& src_offset = pm->parent_offset_;
+
+        std::vector<int>      agg_length(nloc);
+        std::vector<MRequest> req(2 * nsrc + 2);
+
+        int nreq = 0;
+
+        for(int n = 0; n < nsrc; ++n)
+        {
+            int count = src_offset[n + 1] - src_offset[n];
+
+            if(count > 0)
+            {
+                communication_async_recv(agg_length.data() + src_offset[n],
+                                         count,
+                                         pm->parent_first_ + n,
+                                         0,
+                                         &req[nreq++],
+                                         pm_fine.comm_);
+            }
+        }
+
+        if(nrow > 0)
+        {
+            communication_async_send(
+                length.data(), nrow, pm->parent_dest_, 0, &req[nreq++], pm_fine.comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, req.data());
+        }
+
+        std::vector<int> agg_row_offset(nloc + 1);
+        agg_row_offset[0] = 0;
+
+        for(int i = 0; i < nloc; ++i)
+        {
+            agg_row_offset[i + 1] = agg_row_offset[i] + agg_length[i];
+        }
+
+        std::vector<IndexType2> agg_col(agg_row_offset[nloc]);
+        std::vector<ValueType>  agg_val(agg_row_offset[nloc]);
+
+        nreq = 0;
+
+        for(int n = 0; n < nsrc; ++n)
+        {
+            int begin = agg_row_offset[src_offset[n]];
+            int count = agg_row_offset[src_offset[n + 1]] - begin;
+
+            if(count > 0)
+            {
+                communication_async_recv(agg_col.data() + begin,
+                                         count,
+                                         pm->parent_first_ + n,
+                                         1,
+                                         &req[nreq++],
+                                         pm_fine.comm_);
+                communication_async_recv(agg_val.data() + begin,
+                                         count,
+                                         pm->parent_first_ + n,
+                                         2,
+                                         &req[nreq++],
+                                         pm_fine.comm_);
+            }
+        }
+
+        if(nnz > 0)
+        {
+            communication_async_send(
+                global_col.data(), nnz, pm->parent_dest_, 1, &req[nreq++], pm_fine.comm_);
+            communication_async_send(
+                val.data(), nnz, pm->parent_dest_, 2, &req[nreq++], pm_fine.comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, req.data());
+        }
+
+        if(active == false)
+        {
+            agg->Clear();
+
+            return;
+        }
+
+        // Communication pattern of the agglomerated rows
+        std::vector<IndexType2> agg_offsets(nprocs + 1);
+        global_offsets(nloc, nprocs, pm->comm_, agg_offsets.data());
+
+        IndexType2 begin = agg_offsets[pm->rank_];
+
+        assert(begin == offsets[pm->parent_first_]);
+
+        std::vector<IndexType2> ghost;
+
+        for(size_t j = 0; j < agg_col.size(); ++j)
+        {
+            if(agg_col[j] < begin || agg_col[j] >= begin + nloc)
+            {
+                ghost.push_back(agg_col[j]);
+            }
+        }
+
+        std::sort(ghost.begin(), ghost.end());
+        ghost.erase(std::unique(ghost.begin(), ghost.end()), ghost.end());
+
+        pm->SetGhostGlobalIndex_(static_cast<int>(ghost.size()), ghost.data(), agg_offsets.data());
+
+        agg->SetGlobalRows_(*pm, *pm, begin, ghost.data(), agg_row_offset, agg_col, agg_val);
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExtractOverlap(int                     overlap,
+                                                 ParallelManager*        pm,
+                                                 LocalMatrix<ValueType>* ext) const
+    {
+        log_debug(this, "GlobalMatrix::ExtractOverlap()", overlap, pm, ext);
+
+        assert(overlap >= 0);
+        assert(pm != NULL);
+        assert(ext != NULL);
+        assert(pm != this->pm_);
+        assert(this->pm_row_ == NULL);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm_mat = *this->pm_;
+
+        int rank   = pm_mat.rank_;
+        int nprocs = pm_mat.num_procs_;
+        int nrow   = pm_mat.GetLocalSize();
+        int nghost = pm_mat.GetNumReceivers();
+
+        // Rows of this process on the host, the ghost columns follow the local ones
+        std::vector<int>       row_offset;
+        std::vector<int>       col;
+        std::vector<ValueType> val;
+
+        extended_rows(
+            this->matrix_interior_, this->matrix_ghost_, nrow, nrow, &row_offset, &col, &val);
+
+        std::vector<IndexType2> offsets(nprocs + 1);
+        global_offsets(nrow, nprocs, pm_mat.comm_, offsets.data());
+
+        IndexType2 begin = offsets[rank];
+
+        // Global ids of the local and the ghost unknowns
+        std::vector<IndexType2> global(nrow + nghost);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            global[i] = begin + i;
+        }
+
+        ExchangeGhostValues_(pm_mat, global.data(), global.data() + nrow);
+
+        // Rows of this process with global columns
+        std::vector<IndexType2> global_col(col.size());
+
+        for(size_t j = 0; j < col.size(); ++j)
+        {
+            global_col[j] = global[col[j]];
+        }
+
+        // The first overlap level are the ghost unknowns
+        std::vector<IndexType2> ghost;
+
+        if(overlap > 0)
+        {
+            ghost.assign(global.begin() + nrow, global.end());
+            std::sort(ghost.begin(), ghost.end());
+        }
+
+        // Rows of the overlap unknowns
+        std::vector<int>        ov_row_offset;
+        std::vector<IndexType2> ov_col;
+        std::vector<ValueType>  ov_val;
+
+        pm->Clear();
+        pm->SetMPICommunicator(pm_mat.comm_);
+
+        for(int level = 1;; ++level)
+        {
+            // The owners are asked for the rows of the overlap unknowns
+            pm->Clear();
+            pm->SetGlobalSize(pm_mat.GetGlobalSize());
+            pm->SetLocalSize(nrow);
+            pm->SetGhostGlobalIndex_(static_cast<int>(ghost.size()), ghost.data(), offsets.data());
+
+            ExchangeGhostRows_(
+                *pm, row_offset, global_col, val, &ov_row_offset, &ov_col, &ov_val);
+
+            if(level >= overlap)
+            {
+                break;
+            }
+
+            // The next level are the unknowns coupled to the current one
+            for(size_t j = 0; j < ov_col.size(); ++j)
+            {
+                if(ov_col[j] < begin || ov_col[j] >= begin + nrow)
+                {
+                    ghost.push_back(ov_col[j]);
+                }
+            }
+
+            std::sort(ghost.begin(), ghost.end());
+            ghost.erase(std::unique(ghost.begin(), ghost.end()), ghost.end());
+        }
+
+        int nov = static_cast<int>(ghost.size());
+
+        append_rows(&row_offset, &global_col, &val, ov_row_offset, ov_col, ov_val);
+
+        // Extended matrix of the local and the overlap unknowns
+        int m = nrow + nov;
+
+        std::vector<int> ext_col(global_col.size());
+
+        int nnz = 0;
+
+        for(size_t j = 0; j < global_col.size(); ++j)
+        {
+            IndexType2 c = global_col[j];
+
+            if(c >= begin && c < begin + nrow)
+            {
+                ext_col[j] = static_cast<int>(c - begin);
+            }
+            else
+            {
+                std::vector<IndexType2>::const_iterator it
+                    = std::lower_bound(ghost.begin(), ghost.end(), c);
+
+                ext_col[j] = (it == ghost.end() || *it != c)
+                                 ? -1
+                                 : nrow + static_cast<int>(it - ghost.begin());
+            }
+
+            if(ext_col[j] >= 0)
+            {
+                ++nnz;
+            }
+        }
+
+        int*       ext_row_offset = NULL;
+        int*       ext_c          = NULL;
+        ValueType* ext_v          = NULL;
+
+        allocate_host(m + 1, &ext_row_offset);
+        allocate_host(nnz, &ext_c);
+        allocate_host(nnz, &ext_v);
+
+        int k = 0;
+
+        ext_row_offset[0] = 0;
+
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(ext_col[j] >= 0)
+                {
+                    ext_c[k] = ext_col[j];
+                    ext_v[k] = val[j];
+                    ++k;
+                }
+            }
+
+            ext_row_offset[i + 1] = k;
+        }
+
+        ext->Clear();
+        ext->MoveToHost();
+        ext->SetDataPtrCSR(
+            &ext_row_offset, &ext_c, &ext_v, "Overlap of " + this->object_name_, nnz, m, m);
+        ext->Sort();
+
+        if(this->is_accel_() == true)
+        {
+            ext->MoveToAccelerator();
+        }
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    template <typename DataType>
+    void GlobalMatrix<ValueType>::ExchangeGhostValues_(const ParallelManager& pm,
+                                                       const DataType*        local,
+                                                       DataType*              ghost)
+    {
+#ifdef SUPPORT_MULTINODE
+        HaloExchange* halo = pm.GetHaloExchange_(sizeof(DataType));
+
+        halo->StartRecv();
+
+        DataType* send = static_cast<DataType*>(halo->GetSendBuffer());
+
+        for(int i = 0; i < pm.send_index_size_; ++i)
+        {
+            send[i] = local[pm.boundary_index_[i]];
+        }
+
+        halo->StartSend();
+        halo->Wait();
+
+        const DataType* recv = static_cast<const DataType*>(halo->GetRecvBuffer());
+
+        for(int i = 0; i < pm.recv_index_size_; ++i)
+        {
+            ghost[i] = recv[i];
+        }
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::ExchangeGhostRows_(const ParallelManager&         pm,
+                                                     const std::vector<int>&        row_offset,
+                                                     const std::vector<IndexType2>& col,
+                                                     const std::vector<ValueType>&  val,
+                                                     std::vector<int>*        ghost_row_offset,
+                                                     std::vector<IndexType2>* ghost_col,
+                                                     std::vector<ValueType>*  ghost_val)
+    {
+#ifdef SUPPORT_MULTINODE
+        int nrow   = pm.local_size_;
+        int nghost = pm.recv_index_size_;
+
+        assert(static_cast<int>(row_offset.size()) == nrow + 1);
+
+        // Row lengths
+        std::vector<int> length(nrow);
+        std::vector<int> ghost_length(nghost);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            length[i] = row_offset[i + 1] - row_offset[i];
+        }
+
+        ExchangeGhostValues_(pm, length.data(), ghost_length.data());
+
+        ghost_row_offset->resize(nghost + 1);
+        (*ghost_row_offset)[0] = 0;
+
+        for(int i = 0; i < nghost; ++i)
+        {
+            (*ghost_row_offset)[i + 1] = (*ghost_row_offset)[i] + ghost_length[i];
+        }
+
+        ghost_col->resize((*ghost_row_offset)[nghost]);
+        ghost_val->resize((*ghost_row_offset)[nghost]);
+
+        // Boundary rows in the order they are sent
+        std::vector<int> send_row_offset(pm.send_index_size_ + 1, 0);
+
+        for(int i = 0; i < pm.send_index_size_; ++i)
+        {
+            send_row_offset[i + 1] = send_row_offset[i] + length[pm.boundary_index_[i]];
+        }
+
+        std::vector<IndexType2> send_col(send_row_offset[pm.send_index_size_]);
+        std::vector<ValueType>  send_val(send_row_offset[pm.send_index_size_]);
+
+        for(int i = 0; i < pm.send_index_size_; ++i)
+        {
+            int r = pm.boundary_index_[i];
+
+            std::copy(col.begin() + row_offset[r],
+                      col.begin() + row_offset[r + 1],
+                      send_col.begin() + send_row_offset[i]);
+            std::copy(val.begin() + row_offset[r],
+                      val.begin() + row_offset[r + 1],
+                      send_val.begin() + send_row_offset[i]);
+        }
+
+        // Exchange the rows with each neighbour, empty messages are skipped
+        std::vector<MRequest> req(2 * (pm.nrecv_ + pm.nsend_));
+
+        int nreq = 0;
+
+        for(int n = 0; n < pm.nrecv_; ++n)
+        {
+            int begin = (*ghost_row_offset)[pm.recv_offset_index_[n]];
+            int count = (*ghost_row_offset)[pm.recv_offset_index_[n + 1]] - begin;
+
+            if(count > 0)
+            {
+                communication_async_recv(
+                    ghost_col->data() + begin, count, pm.recvs_[n], 0, &req[nreq++], pm.comm_);
+                communication_async_recv(
+                    ghost_val->data() + begin, count, pm.recvs_[n], 1, &req[nreq++], pm.comm_);
+            }
+        }
+
+        for(int n = 0; n < pm.nsend_; ++n)
+        {
+            int begin = send_row_offset[pm.send_offset_index_[n]];
+            int count = send_row_offset[pm.send_offset_index_[n + 1]] - begin;
+
+            if(count > 0)
+            {
+                communication_async_send(
+                    send_col.data() + begin, count, pm.sends_[n], 0, &req[nreq++], pm.comm_);
+                communication_async_send(
+                    send_val.data() + begin, count, pm.sends_[n], 1, &req[nreq++], pm.comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, req.data());
+        }
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::GalerkinProduct_(const ParallelManager&         pm,
+                                                   const std::vector<int>&        a_row_offset,
+                                                   const std::vector<int>&        a_col,
+                                                   const std::vector<ValueType>&  a_val,
+                                                   const std::vector<int>&        r_row_offset,
+                                                   const std::vector<int>&        r_col,
+                                                   const std::vector<ValueType>&  r_val,
+                                                   const std::vector<int>&        p_row_offset,
+                                                   const std::vector<IndexType2>& p_col,
+                                                   const std::vector<ValueType>&  p_val,
+                                                   std::vector<int>*              c_row_offset,
+                                                   std::vector<IndexType2>*       c_col,
+                                                   std::vector<ValueType>*        c_val)
+    {
+#ifdef SUPPORT_MULTINODE
+        // Rows of A * P of the local unknowns
+        std::vector<int>        ap_row_offset;
+        std::vector<IndexType2> ap_col;
+        std::vector<ValueType>  ap_val;
+
+        multiply_rows(a_row_offset,
+                      a_col,
+                      a_val,
+                      p_row_offset,
+                      p_col,
+                      p_val,
+                      &ap_row_offset,
+                      &ap_col,
+                      &ap_val);
+
+        // The restriction couples to ghost unknowns, such that their rows are required
+        std::vector<int>        apg_row_offset;
+        std::vector<IndexType2> apg_col;
+        std::vector<ValueType>  apg_val;
+
+        ExchangeGhostRows_(
+            pm, ap_row_offset, ap_col, ap_val, &apg_row_offset, &apg_col, &apg_val);
+        append_rows(&ap_row_offset, &ap_col, &ap_val, apg_row_offset, apg_col, apg_val);
+
+        multiply_rows(r_row_offset,
+                      r_col,
+                      r_val,
+                      ap_row_offset,
+                      ap_col,
+                      ap_val,
+                      c_row_offset,
+                      c_col,
+                      c_val);
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalMatrix<ValueType>::SetGlobalRows_(const ParallelManager&         pm_row,
+                                                 const ParallelManager&         pm_col,
+                                                 IndexType2                     col_begin,
+                                                 const IndexType2*              ghost,
+                                                 const std::vector<int>&        row_offset,
+                                                 const std::vector<IndexType2>& col,
+                                                 const std::vector<ValueType>&  val)
+    {
+#ifdef SUPPORT_MULTINODE
+        int nrow   = pm_row.GetLocalSize();
+        int ncol   = pm_col.GetLocalSize();
+        int nghost = pm_col.GetNumReceivers();
+
+        assert(static_cast<int>(row_offset.size()) == nrow + 1);
+
+        // Ghost columns sorted by their global ids
+        std::vector<std::pair<IndexType2, int>> ghost_map(nghost);
+
+        for(int k = 0; k < nghost; ++k)
+        {
+            ghost_map[k] = std::make_pair(ghost[k], k);
+        }
+
+        std::sort(ghost_map.begin(), ghost_map.end());
+
+        int nnz       = row_offset[nrow];
+        int local_nnz = 0;
+
+        for(int j = 0; j < nnz; ++j)
+        {
+            if(col[j] >= col_begin && col[j] < col_begin + ncol)
+            {
+                ++local_nnz;
+            }
+        }
+
+        int ghost_nnz = nnz - local_nnz;
+
+        int*       int_row_offset = NULL;
+        int*       int_col        = NULL;
+        ValueType* int_val        = NULL;
+        int*       gst_row        = NULL;
+        int*       gst_col        = NULL;
+        ValueType* gst_val        = NULL;
+
+        allocate_host(nrow + 1, &int_row_offset);
+        allocate_host(local_nnz, &int_col);
+        allocate_host(local_nnz, &int_val);
+        allocate_host(ghost_nnz, &gst_row);
+        allocate_host(ghost_nnz, &gst_col);
+        allocate_host(ghost_nnz, &gst_val);
+
+        int l = 0;
+        int g = 0;
+
+        int_row_offset[0] = 0;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                if(col[j] >= col_begin && col[j] < col_begin + ncol)
+                {
+                    int_col[l] = static_cast<int>(col[j] - col_begin);
+                    int_val[l] = val[j];
+                    ++l;
+                }
+                else
+                {
+                    std::vector<std::pair<IndexType2, int>>::const_iterator it = std::lower_bound(
+                        ghost_map.begin(), ghost_map.end(), std::make_pair(col[j], 0));
+
+                    if(it == ghost_map.end() || it->first != col[j])
+                    {
+                        LOG_INFO("GlobalMatrix: column " << col[j]
+                                                         << " is not a ghost of the parallel "
+                                                            "manager");
+                        FATAL_ERROR(__FILE__, __LINE__);
+                    }
+
+                    gst_row[g] = i;
+                    gst_col[g] = it->second;
+                    gst_val[g] = val[j];
+                    ++g;
+                }
+            }
+
+            int_row_offset[i + 1] = l;
+        }
+
+        bool isaccel = this->is_accel_();
+
+        this->Clear();
+        this->MoveToHost();
+        this->SetParallelManager(pm_row, pm_col);
+
+        if(local_nnz > 0)
+        {
+            this->matrix_interior_.SetDataPtrCSR(&int_row_offset,
+                                                 &int_col,
+                                                 &int_val,
+                                                 "Interior of " + this->object_name_,
+                                                 local_nnz,
+                                                 nrow,
+                                                 ncol);
+            this->matrix_interior_.Sort();
+        }
+        else
+        {
+            free_host(&int_row_offset);
+        }
+
+        if(ghost_nnz > 0)
+        {
+            this->matrix_ghost_.SetDataPtrCOO(&gst_row,
+                                              &gst_col,
+                                              &gst_val,
+                                              "Ghost of " + this->object_name_,
+                                              ghost_nnz,
+                                              nrow,
+                                              nghost);
+            this->matrix_ghost_.Sort();
+        }
+
+        IndexType2 nnz_local;
+        IndexType2 nnz_ghost;
+
+        communication_allreduce_single_sum(
+            this->matrix_interior_.GetNnz(), &nnz_local, pm_col.comm_);
+        communication_allreduce_single_sum(this->matrix_ghost_.GetNnz(), &nnz_ghost, pm_col.comm_);
+
+        this->nnz_ = nnz_local + nnz_ghost;
+
+        if(isaccel == true)
+        {
+            this->MoveToAccelerator();
+        }
+#else
+        LOG_INFO("Multinode support disabled");
+        FATAL_ERROR(__FILE__, __LINE__);
+#endif
+    }
+
     template class GlobalMatrix<double>;
     template class GlobalMatrix<float>;
 #ifdef SUPPORT_COMPLEX
@@ -28,6 +28,8 @@
 #include "operator.hpp"
 #include "parallel_manager.hpp"
 
+#include <vector>
+
 namespace rocalution
 {
 
@@ -71,6 +73,8 @@ namespace rocalution
         const LocalMatrix<ValueType>& GetInterior() const;
         /** \private */
         const LocalMatrix<ValueType>& GetGhost() const;
+        /** \brief Return the parallel manager */
+        const ParallelManager* GetParallelManager(void) const;
 
         virtual void MoveToAccelerator(void);
         virtual void MoveToHost(void);
@@ -91,6 +95,12 @@ namespace rocalution
 
         /** \brief Set the parallel manager of a global vector */
         void SetParallelManager(const ParallelManager& pm);
+        /** \brief Set the parallel managers of a rectangular global matrix
+      * \details
+      * The rows of the matrix are distributed as \p pm_row, its columns as \p pm_col. The
+      * ghost part and the communication of Apply() follow \p pm_col.
+      */
+        void SetParallelManager(const ParallelManager& pm_row, const ParallelManager& pm_col);
 
         /** \brief Initialize a CSR matrix on the host with externally allocated data */
         void SetDataPtrCSR(int**       local_row_offset,
@@ -173,11 +183,19 @@ namespace rocalution
         void ConvertToDENSE(void);
         /** \brief Convert the matrix to specified matrix ID format */
         void ConvertTo(unsigned int matrix_format);
+        /** \brief Select the fastest SpMV format for the interior matrix and convert to it
+      * \details
+      * See LocalMatrix::AutotuneFormat(). The ghost part remains in COO format.
+      */
+        unsigned int AutotuneFormat(bool benchmark = true);
 
         virtual void Apply(const GlobalVector<ValueType>& in, GlobalVector<ValueType>* out) const;
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+        virtual void Residual(const GlobalVector<ValueType>& b,
+                              const GlobalVector<ValueType>& x,
+                              GlobalVector<ValueType>*       res) const;
 
         /** \brief Read matrix from MTX (Matrix Market Format) file */
         void ReadFileMTX(const std::string filename);
@@ -187,6 +205,35 @@ namespace rocalution
         void ReadFileCSR(const std::string filename);
         /** \brief Write matrix to CSR (ROCALUTION binary format) file */
         void WriteFileCSR(const std::string filename) const;
+        /** \brief Read matrix from a distributed file
+      * \details
+      * The file has to be written by WriteFileDistributed() with the same number of
+      * processes. The parallel manager of the matrix has to be read from the same file by
+      * ParallelManager::ReadFileDistributed() before. Each process only reads its own
+      * block of the file.
+      */
+        void ReadFileDistributed(const std::string filename);
+        /** \brief Write matrix to a distributed file
+      * \details
+      * All processes write concurrently into a single binary file by MPI-IO. The header
+      * of the file holds the byte offset of the block of each process. The block contains
+      * the parallel manager data, the interior part in CSR and the ghost part in COO
+      * format. Values are stored in double precision.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   mat.WriteFileDistributed("mat.bin");
+      *
+      *   ParallelManager pm;
+      *   pm.SetMPICommunicator(&comm);
+      *   pm.ReadFileDistributed("mat.bin");
+      *
+      *   GlobalMatrix<ValueType> A;
+      *   A.SetParallelManager(pm);
+      *   A.ReadFileDistributed("mat.bin");
+      * \endcode
+      */
+        void WriteFileDistributed(const std::string filename) const;
 
         /** \brief Sort the matrix indices */
         void Sort(void);
@@ -225,13 +272,105 @@ namespace rocalution
                              const int*               rG,
                              int                      rGsize) const;
 
+        /** \brief Smoothed aggregation with parallel aggregation across process boundaries
+      * \details
+      * The unknowns are aggregated by strong couplings with coupling strength \p eps. An
+      * aggregate may contain unknowns of a neighbouring process. The tentative
+      * prolongation is smoothed by one damped Jacobi step with relaxation \p relax,
+      * where the ghost rows are exchanged with the neighbours. The coarse operator
+      * \p coarse is the Galerkin product of \p restrict, this matrix and \p prolong. The
+      * parallel manager \p pm of the coarse level is set up from the ghost columns of
+      * \p coarse and \p prolong. The transfer operators are rectangular global matrices.
+      * The setup is performed on the host and requires multinode support.
+      */
+        void AMGSmoothedAggregation(ValueType                eps,
+                                    ValueType                relax,
+                                    ParallelManager*         pm,
+                                    GlobalMatrix<ValueType>* prolong,
+                                    GlobalMatrix<ValueType>* restrict,
+                                    GlobalMatrix<ValueType>* coarse) const;
+        /** \brief Compute the Galerkin product R * A * P
+      * \details
+      * Rebuilds a coarse operator of AMGSmoothedAggregation() with the existing parallel
+      * manager of the columns of \p P, e.g. after the values of \p A have changed.
+      */
+        void TripleMatrixProduct(const GlobalMatrix<ValueType>& R,
+                                 const GlobalMatrix<ValueType>& A,
+                                 const GlobalMatrix<ValueType>& P);
+        /** \brief Gather the rows onto the first \p nprocs processes
+      * \details
+      * The communicator of \p pm is split from the one of this matrix, see
+      * ParallelManager::SetMPICommunicator(), and \p agg holds the gathered rows with
+      * the communication pattern of \p pm. On the remaining processes, \p agg is empty.
+      * The global numbering is preserved. Calling it again with the same \p pm and
+      * \p nprocs keeps the communicator, e.g. after the values have changed. This is
+      * collective, performed on the host and requires multinode support.
+      */
+        void Agglomerate(int nprocs, ParallelManager* pm, GlobalMatrix<ValueType>* agg) const;
+        /** \brief Extract the local rows extended by \p overlap levels of neighbouring rows
+      * \details
+      * The first overlap level are the ghost unknowns of this matrix, each further level
+      * adds the unknowns, which are coupled to the previous one. The rows of the overlap
+      * unknowns are fetched from their owners. \p ext is the square matrix of the local
+      * unknowns followed by the overlap unknowns in ascending global order, couplings to
+      * unknowns outside of the overlap are dropped. \p pm is set up with the overlap
+      * unknowns as ghost unknowns, such that the values of a vector on the overlap can
+      * be received by GlobalVector::UpdateGhostValues(). This is collective and
+      * performed on the host.
+      */
+        void ExtractOverlap(int overlap, ParallelManager* pm, LocalMatrix<ValueType>* ext) const;
+
     protected:
         virtual bool is_host_(void) const;
         virtual bool is_accel_(void) const;
 
     private:
+        // Exchanges the values of the boundary unknowns of pm into the ghost values
+        template <typename DataType>
+        static void ExchangeGhostValues_(const ParallelManager& pm,
+                                         const DataType*        local,
+                                         DataType*              ghost);
+        // Exchanges the rows of the boundary unknowns of pm, the columns are global ids
+        static void ExchangeGhostRows_(const ParallelManager&         pm,
+                                       const std::vector<int>&        row_offset,
+                                       const std::vector<IndexType2>& col,
+                                       const std::vector<ValueType>&  val,
+                                       std::vector<int>*              ghost_row_offset,
+                                       std::vector<IndexType2>*       ghost_col,
+                                       std::vector<ValueType>*        ghost_val);
+        // Rows of R * A * P with global column ids. A and R are given with extended
+        // columns, i.e. local columns followed by the ghost columns of pm. P holds the
+        // rows of the local unknowns followed by the rows of the ghost unknowns of pm.
+        static void GalerkinProduct_(const ParallelManager&         pm,
+                                     const std::vector<int>&        a_row_offset,
+                                     const std::vector<int>&        a_col,
+                                     const std::vector<ValueType>&  a_val,
+                                     const std::vector<int>&        r_row_offset,
+                                     const std::vector<int>&        r_col,
+                                     const std::vector<ValueType>&  r_val,
+                                     const std::vector<int>&        p_row_offset,
+                                     const std::vector<IndexType2>& p_col,
+                                     const std::vector<ValueType>&  p_val,
+                                     std::vector<int>*              c_row_offset,
+                                     std::vector<IndexType2>*       c_col,
+                                     std::vector<ValueType>*        c_val);
+        // Sets the rows of this process from global column ids. The columns of this
+        // process start at col_begin, ghost holds the global ids of the ghost columns
+        // of pm_col.
+        void SetGlobalRows_(const ParallelManager&         pm_row,
+                            const ParallelManager&         pm_col,
+                            IndexType2                     col_begin,
+                            const IndexType2*              ghost,
+                            const std::vector<int>&        row_offset,
+                            const std::vector<IndexType2>& col,
+                            const std::vector<ValueType>&  val);
+
         IndexType2 nnz_;
 
+        // Parallel manager of the rows of a rectangular matrix, NULL if the rows are
+        // distributed as the columns
+        const ParallelManager* pm_row_;
+
         LocalMatrix<ValueType> matrix_interior_;
         LocalMatrix<ValueType> matrix_ghost_;
 
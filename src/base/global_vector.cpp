@@ -25,6 +25,7 @@
 #include "../utils/allocate_free.hpp"
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
+#include "../utils/math_functions.hpp"
 #include "local_vector.hpp"
 
 #ifdef SUPPORT_MULTINODE
@@ -37,10 +38,67 @@
 #include <limits>
 #include <math.h>
 #include <sstream>
+#include <typeinfo>
+#include <vector>
 
 namespace rocalution
 {
 
+#ifdef SUPPORT_MULTINODE
+    static const char* _global_vector_file_id = "#rocALUTION distributed vector";
+
+    // Values of distributed files are stored in double precision, integers as they are
+    template <typename ValueType>
+    static void write_file_values(MFile* file, long long offset, const ValueType* val, int n)
+    {
+        if(typeid(ValueType) == typeid(double) || typeid(ValueType) == typeid(int))
+        {
+            communication_file_write_at(file, offset, val, sizeof(ValueType) * n);
+        }
+        else if(typeid(ValueType) == typeid(float))
+        {
+            std::vector<double> tmp(n);
+
+            for(int i = 0; i < n; ++i)
+            {
+                tmp[i] = rocalution_double(val[i]);
+            }
+
+            communication_file_write_at(file, offset, tmp.data(), sizeof(double) * n);
+        }
+        else
+        {
+            LOG_INFO("WriteFileDistributed: complex values are not supported");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    template <typename ValueType>
+    static void read_file_values(MFile* file, long long offset, ValueType* val, int n)
+    {
+        if(typeid(ValueType) == typeid(double) || typeid(ValueType) == typeid(int))
+        {
+            communication_file_read_at(file, offset, val, sizeof(ValueType) * n);
+        }
+        else if(typeid(ValueType) == typeid(float))
+        {
+            std::vector<double> tmp(n);
+
+            communication_file_read_at(file, offset, tmp.data(), sizeof(double) * n);
+
+            for(int i = 0; i < n; ++i)
+            {
+                val[i] = static_cast<ValueType>(tmp[i]);
+            }
+        }
+        else
+        {
+            LOG_INFO("ReadFileDistributed: complex values are not supported");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+#endif
+
     template <typename ValueType>
     GlobalVector<ValueType>::GlobalVector()
     {
@@ -52,14 +110,7 @@ namespace rocalution
 #endif
 
         this->object_name_ = "";
-
-        this->recv_boundary_ = NULL;
-        this->send_boundary_ = NULL;
-
-#ifdef SUPPORT_MULTINODE
-        this->recv_event_ = NULL;
-        this->send_event_ = NULL;
-#endif
+        this->pm_          = NULL;
     }
 
     template <typename ValueType>
@@ -72,14 +123,6 @@ namespace rocalution
         this->object_name_ = "";
 
         this->pm_ = &pm;
-
-        this->recv_boundary_ = NULL;
-        this->send_boundary_ = NULL;
-
-#ifdef SUPPORT_MULTINODE
-        this->recv_event_ = new MRequest[pm.nrecv_];
-        this->send_event_ = new MRequest[pm.nsend_];
-#endif
     }
 
     template <typename ValueType>
@@ -88,20 +131,6 @@ namespace rocalution
         log_debug(this, "GlobalVector::~GlobalVector()");
 
         this->Clear();
-
-#ifdef SUPPORT_MULTINODE
-        if(this->recv_event_ != NULL)
-        {
-            delete[] this->recv_event_;
-            this->recv_event_ = NULL;
-        }
-
-        if(this->send_event_ != NULL)
-        {
-            delete[] this->send_event_;
-            this->send_event_ = NULL;
-        }
-#endif
     }
 
     template <typename ValueType>
@@ -111,16 +140,6 @@ namespace rocalution
 
         this->vector_interior_.Clear();
         this->vector_ghost_.Clear();
-
-        if(this->recv_boundary_ != NULL)
-        {
-            free_host(&this->recv_boundary_);
-        }
-
-        if(this->send_boundary_ != NULL)
-        {
-            free_host(&this->send_boundary_);
-        }
     }
 
     template <typename ValueType>
@@ -128,7 +147,8 @@ namespace rocalution
     {
         log_debug(this, "GlobalVector::SetParallelManager()", (const void*&)pm);
 
-        assert(pm.Status() == true);
+        // Processes outside of an agglomerated communicator keep an empty vector
+        assert(pm.Status() == true || (pm.parent_ != NULL && pm.IsActive() == false));
 
         this->pm_ = &pm;
     }
@@ -187,29 +207,16 @@ namespace rocalution
         std::string interior_name = "Interior of " + name;
         std::string ghost_name    = "Ghost of " + name;
 
-#ifdef SUPPORT_MULTINODE
-        if(this->recv_event_ == NULL)
-        {
-            this->recv_event_ = new MRequest[this->pm_->nrecv_];
-        }
-
-        if(this->send_event_ == NULL)
-        {
-            this->send_event_ = new MRequest[this->pm_->nsend_];
-        }
-#endif
-
         this->object_name_ = name;
 
         this->vector_interior_.Allocate(interior_name, this->pm_->GetLocalSize());
         this->vector_ghost_.Allocate(ghost_name, this->pm_->GetNumReceivers());
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
-
-        // Allocate send and receive buffer
-        allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
-        allocate_host(this->pm_->GetNumSenders(), &this->send_boundary_);
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
     }
 
     template <typename ValueType>
@@ -252,29 +259,16 @@ namespace rocalution
         std::string interior_name = "Interior of " + name;
         std::string ghost_name    = "Ghost of " + name;
 
-#ifdef SUPPORT_MULTINODE
-        if(this->recv_event_ == NULL)
-        {
-            this->recv_event_ = new MRequest[this->pm_->nrecv_];
-        }
-
-        if(this->send_event_ == NULL)
-        {
-            this->send_event_ = new MRequest[this->pm_->nsend_];
-        }
-#endif
-
         this->object_name_ = name;
 
         this->vector_interior_.SetDataPtr(ptr, interior_name, this->pm_->local_size_);
         this->vector_ghost_.Allocate(ghost_name, this->pm_->GetNumReceivers());
 
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
-
-        // Allocate send and receive buffer
-        allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
-        allocate_host(this->pm_->GetNumSenders(), &this->send_boundary_);
+        if(this->pm_->GetNumSenders() > 0)
+        {
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
+        }
     }
 
     template <typename ValueType>
@@ -286,10 +280,6 @@ namespace rocalution
         assert(this->vector_interior_.GetSize() > 0);
 
         this->vector_interior_.LeaveDataPtr(ptr);
-
-        free_host(&this->recv_boundary_);
-        free_host(&this->send_boundary_);
-
         this->vector_ghost_.Clear();
     }
 
@@ -319,8 +309,7 @@ namespace rocalution
 
         assert(this != &src);
         assert(this->pm_ == src.pm_);
-        assert(this->recv_boundary_ != NULL);
-        assert(this->send_boundary_ != NULL);
+        assert(this->GetLocalSize() == src.GetLocalSize());
 
         this->vector_interior_.CopyFrom(src.vector_interior_);
     }
@@ -448,29 +437,16 @@ namespace rocalution
 
         this->vector_interior_.ReadFileASCII(path + name);
 
-#ifdef SUPPORT_MULTINODE
-        if(this->recv_event_ == NULL)
-        {
-            this->recv_event_ = new MRequest[this->pm_->nrecv_];
-        }
+        this->object_name_ = filename;
 
-        if(this->send_event_ == NULL)
+        if(this->pm_->GetNumSenders() > 0)
         {
-            this->send_event_ = new MRequest[this->pm_->nsend_];
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
         }
-#endif
-
-        this->object_name_ = filename;
-
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
 
         // Allocate ghost vector
         this->vector_ghost_.Allocate("ghost", this->pm_->GetNumReceivers());
-
-        // Allocate send and receive buffer
-        allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
-        allocate_host(this->pm_->GetNumSenders(), &this->send_boundary_);
     }
 
     template <typename ValueType>
@@ -544,29 +520,16 @@ namespace rocalution
 
         this->vector_interior_.ReadFileBinary(path + name);
 
-#ifdef SUPPORT_MULTINODE
-        if(this->recv_event_ == NULL)
-        {
-            this->recv_event_ = new MRequest[this->pm_->nrecv_];
-        }
+        this->object_name_ = filename;
 
-        if(this->send_event_ == NULL)
+        if(this->pm_->GetNumSenders() > 0)
         {
-            this->send_event_ = new MRequest[this->pm_->nsend_];
+            this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
+                                                 this->pm_->boundary_index_);
         }
-#endif
-
-        this->object_name_ = filename;
-
-        this->vector_interior_.SetIndexArray(this->pm_->GetNumSenders(),
-                                             this->pm_->boundary_index_);
 
         // Allocate ghost vector
         this->vector_ghost_.Allocate("ghost", this->pm_->GetNumReceivers());
-
-        // Allocate send and receive buffer
-        allocate_host(this->pm_->GetNumReceivers(), &this->recv_boundary_);
-        allocate_host(this->pm_->GetNumSenders(), &this->send_boundary_);
     }
 
     template <typename ValueType>
@@ -605,6 +568,79 @@ namespace rocalution
         this->vector_interior_.WriteFileBinary(name);
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::ReadFileDistributed(const std::string filename)
+    {
+        log_debug(this, "GlobalVector::ReadFileDistributed()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; reading...");
+
+#ifdef SUPPORT_MULTINODE
+        MFile     file;
+        long long offset
+            = this->pm_->OpenFileDistributed_(filename, _global_vector_file_id, false, 0, &file);
+
+        long long info[2];
+        communication_file_read_at(&file, offset, info, sizeof(info));
+        offset += sizeof(info);
+
+        if(info[0] != this->pm_->GetGlobalSize() || info[1] != this->pm_->GetLocalSize())
+        {
+            LOG_INFO("ReadFileDistributed: filename=" << filename
+                                                      << "; parallel manager does not match");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int        size = this->pm_->GetLocalSize();
+        ValueType* data = NULL;
+
+        allocate_host(size, &data);
+        read_file_values(&file, offset, data, size);
+
+        communication_file_close(&file);
+
+        this->SetDataPtr(&data, filename, this->pm_->GetGlobalSize());
+#endif
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; done");
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::WriteFileDistributed(const std::string filename) const
+    {
+        log_debug(this, "GlobalVector::WriteFileDistributed()", filename);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->Status() == true);
+
+        LOG_INFO("WriteFileDistributed: filename=" << filename << "; writing...");
+
+#ifdef SUPPORT_MULTINODE
+        int                    size = this->vector_interior_.GetSize();
+        std::vector<ValueType> data(size);
+
+        this->vector_interior_.CopyToData(data.data());
+
+        long long info[2] = {this->pm_->GetGlobalSize(), size};
+        long long bytes   = (typeid(ValueType) == typeid(int)) ? sizeof(int) : sizeof(double);
+
+        MFile     file;
+        long long offset = this->pm_->OpenFileDistributed_(
+            filename, _global_vector_file_id, true, sizeof(info) + bytes * size, &file);
+
+        communication_file_write_at(&file, offset, info, sizeof(info));
+        offset += sizeof(info);
+        write_file_values(&file, offset, data.data(), size);
+
+        communication_file_close(&file);
+#endif
+
+        LOG_INFO("WriteFileDistributed: filename=" << filename << "; done");
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::AddScale(const GlobalVector<ValueType>& x, ValueType alpha)
     {
@@ -692,6 +728,40 @@ namespace rocalution
         return global;
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotBegin(const GlobalVector<ValueType>& x,
+                                           DotFuture<ValueType>*          dot) const
+    {
+        log_debug(this, "GlobalVector::DotBegin()", (const void*&)x, dot);
+
+        assert(dot != NULL);
+
+        ValueType local = this->vector_interior_.Dot(x.vector_interior_);
+
+#ifdef SUPPORT_MULTINODE
+        dot->Start_(local, this->pm_->comm_);
+#else
+        dot->Start_(local, NULL);
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::DotNonConjBegin(const GlobalVector<ValueType>& x,
+                                                  DotFuture<ValueType>*          dot) const
+    {
+        log_debug(this, "GlobalVector::DotNonConjBegin()", (const void*&)x, dot);
+
+        assert(dot != NULL);
+
+        ValueType local = this->vector_interior_.DotNonConj(x.vector_interior_);
+
+#ifdef SUPPORT_MULTINODE
+        dot->Start_(local, this->pm_->comm_);
+#else
+        dot->Start_(local, NULL);
+#endif
+    }
+
     template <typename ValueType>
     ValueType GlobalVector<ValueType>::Norm(void) const
     {
@@ -765,48 +835,19 @@ namespace rocalution
         log_debug(this, "GlobalVector::UpdateGhostValuesAsync_()", "#*# begin", (const void*&)in);
 
 #ifdef SUPPORT_MULTINODE
-        int tag = 0;
-
-        // async recv boundary from neighbors
-        for(int i = 0; i < this->pm_->nrecv_; ++i)
-        {
-            // nnz that we receive from process i
-            int boundary_nnz
-                = this->pm_->recv_offset_index_[i + 1] - this->pm_->recv_offset_index_[i];
-
-            // if this has ghost values that belong to process i
-            if(boundary_nnz > 0)
-            {
-                communication_async_recv(this->recv_boundary_ + this->pm_->recv_offset_index_[i],
-                                         boundary_nnz,
-                                         this->pm_->recvs_[i],
-                                         tag,
-                                         &this->recv_event_[i],
-                                         this->pm_->comm_);
-            }
-        }
+        HaloExchange* halo = this->pm_->GetHaloExchange_(sizeof(ValueType));
 
-        // prepare send buffer
-        in.vector_interior_.GetIndexValues(this->send_boundary_);
+        // Post the receives before packing, such that the messages of the neighbors
+        // can arrive meanwhile
+        halo->StartRecv();
 
-        // async send boundary to neighbors
-        for(int i = 0; i < this->pm_->nsend_; ++i)
+        // Pack the boundary values directly into the send buffer
+        if(this->pm_->GetNumSenders() > 0)
         {
-            // nnz that we send to process i
-            int boundary_nnz
-                = this->pm_->send_offset_index_[i + 1] - this->pm_->send_offset_index_[i];
-
-            // if process i has ghost values that belong to this
-            if(boundary_nnz > 0)
-            {
-                communication_async_send(this->send_boundary_ + this->pm_->send_offset_index_[i],
-                                         boundary_nnz,
-                                         this->pm_->sends_[i],
-                                         tag,
-                                         &this->send_event_[i],
-                                         this->pm_->comm_);
-            }
+            in.vector_interior_.GetIndexValues(static_cast<ValueType*>(halo->GetSendBuffer()));
         }
+
+        halo->StartSend();
 #endif
 
         log_debug(this, "GlobalVector::UpdateGhostValuesAsync_()", "#*# end");
@@ -818,17 +859,32 @@ namespace rocalution
         log_debug(this, "GlobalVector::UpdateGhostValuesSync_()", "#*# begin");
 
 #ifdef SUPPORT_MULTINODE
+        HaloExchange* halo = this->pm_->GetHaloExchange_(sizeof(ValueType));
+
         // Sync before updating ghost values
-        communication_syncall(this->pm_->nrecv_, this->recv_event_);
-        communication_syncall(this->pm_->nsend_, this->send_event_);
+        halo->Wait();
 
-        this->vector_ghost_.SetContinuousValues(
-            0, this->pm_->GetNumReceivers(), this->recv_boundary_);
+        if(this->pm_->GetNumReceivers() > 0)
+        {
+            this->vector_ghost_.SetContinuousValues(
+                0,
+                this->pm_->GetNumReceivers(),
+                static_cast<const ValueType*>(halo->GetRecvBuffer()));
+        }
 #endif
 
         log_debug(this, "GlobalVector::UpdateGhostValuesSync_()", "#*# end");
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::UpdateGhostValues(void)
+    {
+        log_debug(this, "GlobalVector::UpdateGhostValues()");
+
+        this->UpdateGhostValuesAsync_(*this);
+        this->UpdateGhostValuesSync_();
+    }
+
     template <typename ValueType>
     void GlobalVector<ValueType>::Power(double power)
     {
@@ -849,6 +905,121 @@ namespace rocalution
     {
     }
 
+    template <typename ValueType>
+    void GlobalVector<ValueType>::Gather(const GlobalVector<ValueType>& in)
+    {
+        log_debug(this, "GlobalVector::Gather()", (const void*&)in);
+
+        assert(this->pm_ != NULL);
+        assert(this->pm_->parent_ == in.pm_);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm = *this->pm_;
+
+        int nrow = in.GetLocalSize();
+        int nsrc = pm.IsActive() ? static_cast<int>(pm.parent_offset_.size()) - 1 : 0;
+
+        std::vector<ValueType> send(nrow);
+        std::vector<ValueType> recv(pm.IsActive() ? pm.local_size_ : 0);
+
+        in.vector_interior_.CopyToData(send.data());
+
+        std::vector<MRequest> req(nsrc + 1);
+
+        int nreq = 0;
+
+        for(int n = 0; n < nsrc; ++n)
+        {
+            int count = pm.parent_offset_[n + 1] - pm.parent_offset_[n];
+
+            if(count > 0)
+            {
+                communication_async_recv(recv.data() + pm.parent_offset_[n],
+                                         count,
+                                         pm.parent_first_ + n,
+                                         0,
+                                         &req[nreq++],
+                                         in.pm_->comm_);
+            }
+        }
+
+        if(nrow > 0)
+        {
+            communication_async_send(
+                send.data(), nrow, pm.parent_dest_, 0, &req[nreq++], in.pm_->comm_);
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, req.data());
+        }
+
+        if(recv.size() > 0)
+        {
+            this->vector_interior_.CopyFromData(recv.data());
+        }
+#endif
+    }
+
+    template <typename ValueType>
+    void GlobalVector<ValueType>::Scatter(const GlobalVector<ValueType>& in)
+    {
+        log_debug(this, "GlobalVector::Scatter()", (const void*&)in);
+
+        assert(in.pm_ != NULL);
+        assert(in.pm_->parent_ == this->pm_);
+
+#ifdef SUPPORT_MULTINODE
+        const ParallelManager& pm = *in.pm_;
+
+        int nrow = this->GetLocalSize();
+        int nsrc = pm.IsActive() ? static_cast<int>(pm.parent_offset_.size()) - 1 : 0;
+
+        std::vector<ValueType> send(pm.IsActive() ? pm.local_size_ : 0);
+        std::vector<ValueType> recv(nrow);
+
+        if(send.size() > 0)
+        {
+            in.vector_interior_.CopyToData(send.data());
+        }
+
+        std::vector<MRequest> req(nsrc + 1);
+
+        int nreq = 0;
+
+        if(nrow > 0)
+        {
+            communication_async_recv(
+                recv.data(), nrow, pm.parent_dest_, 0, &req[nreq++], this->pm_->comm_);
+        }
+
+        for(int n = 0; n < nsrc; ++n)
+        {
+            int count = pm.parent_offset_[n + 1] - pm.parent_offset_[n];
+
+            if(count > 0)
+            {
+                communication_async_send(send.data() + pm.parent_offset_[n],
+                                         count,
+                                         pm.parent_first_ + n,
+                                         0,
+                                         &req[nreq++],
+                                         this->pm_->comm_);
+            }
+        }
+
+        if(nreq > 0)
+        {
+            communication_syncall(nreq, req.data());
+        }
+
+        if(nrow > 0)
+        {
+            this->vector_interior_.CopyFromData(recv.data());
+        }
+#endif
+    }
+
     template <typename ValueType>
     bool GlobalVector<ValueType>::is_host_(void) const
     {
@@ -37,7 +37,6 @@ namespace rocalution
     class LocalMatrix;
     template <typename ValueType>
     class GlobalMatrix;
-    struct MRequest;
 
     /** \ingroup op_vec_module
   * \class GlobalVector
@@ -112,6 +111,18 @@ namespace rocalution
         virtual void WriteFileASCII(const std::string filename) const;
         virtual void ReadFileBinary(const std::string filename);
         virtual void WriteFileBinary(const std::string filename) const;
+        /** \brief Read vector from a distributed file
+      * \details
+      * The file has to be written by WriteFileDistributed() with the same number of
+      * processes and parallel manager. Each process only reads its own block of the file.
+      */
+        void ReadFileDistributed(const std::string filename);
+        /** \brief Write vector to a distributed file
+      * \details
+      * All processes write concurrently into a single binary file by MPI-IO, see
+      * GlobalMatrix::WriteFileDistributed().
+      */
+        void WriteFileDistributed(const std::string filename) const;
 
         virtual void AddScale(const GlobalVector<ValueType>& x, ValueType alpha);
         virtual void ScaleAdd(ValueType alpha, const GlobalVector<ValueType>& x);
@@ -125,6 +136,9 @@ namespace rocalution
         virtual void      Scale(ValueType alpha);
         virtual ValueType Dot(const GlobalVector<ValueType>& x) const;
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
+        virtual void DotBegin(const GlobalVector<ValueType>& x, DotFuture<ValueType>* dot) const;
+        virtual void DotNonConjBegin(const GlobalVector<ValueType>& x,
+                                     DotFuture<ValueType>*          dot) const;
         virtual ValueType Norm(void) const;
         virtual ValueType Reduce(void) const;
         virtual ValueType Asum(void) const;
@@ -141,6 +155,23 @@ namespace rocalution
         /** \brief Prolongation operator based on restriction mapping vector */
         void Prolongation(const GlobalVector<ValueType>& vec_coarse, const LocalVector<int>& map);
 
+        /** \brief Gather \p in onto the agglomerated processes
+      * \details
+      * The parallel manager of this vector has to be agglomerated from the one of \p in,
+      * see ParallelManager::SetMPICommunicator(). This is collective on the parallel
+      * manager of \p in.
+      */
+        void Gather(const GlobalVector<ValueType>& in);
+        /** \brief Scatter the agglomerated vector \p in back, inverse of Gather() */
+        void Scatter(const GlobalVector<ValueType>& in);
+
+        /** \brief Receive the values of the ghost unknowns from their owners
+      * \details
+      * The ghost values are exchanged with the communication pattern of the parallel
+      * manager of this vector, see GetGhost(). This is collective.
+      */
+        void UpdateGhostValues(void);
+
     protected:
         virtual bool is_host_(void) const;
         virtual bool is_accel_(void) const;
@@ -151,12 +182,6 @@ namespace rocalution
         void UpdateGhostValuesSync_(void);
 
     private:
-        MRequest* recv_event_;
-        MRequest* send_event_;
-
-        ValueType* recv_boundary_;
-        ValueType* send_boundary_;
-
         LocalVector<ValueType> vector_interior_;
         LocalVector<ValueType> vector_ghost_;
 
@@ -2932,7 +2932,7 @@ namespace rocalution
     template <typename ValueType>
     bool HIPAcceleratorMatrixCSR<ValueType>::DiagonalMatrixMultL(const BaseVector<ValueType>& diag)
     {
-        assert(diag.GetSize() == this->ncol_);
+        assert(diag.GetSize() == this->nrow_);
 
         const HIPAcceleratorVector<ValueType>* cast_diag
             = dynamic_cast<const HIPAcceleratorVector<ValueType>*>(&diag);
@@ -116,6 +116,7 @@ namespace rocalution
     void HIPAcceleratorVector<ValueType>::LeaveDataPtr(ValueType** ptr)
     {
         assert(this->size_ > 0);
+        assert(this->view_ == false);
 
         hipDeviceSynchronize();
         *ptr       = this->vec_;
@@ -124,15 +125,48 @@ namespace rocalution
         this->size_ = 0;
     }
 
+    template <typename ValueType>
+    void HIPAcceleratorVector<ValueType>::SetView(BaseVector<ValueType>& src, int offset, int size)
+    {
+        HIPAcceleratorVector<ValueType>* cast_src
+            = dynamic_cast<HIPAcceleratorVector<ValueType>*>(&src);
+
+        assert(cast_src != NULL);
+        assert(cast_src != this);
+        assert(offset >= 0);
+        assert(size >= 0);
+        assert(offset + size <= cast_src->size_);
+
+        this->Clear();
+
+        if(size > 0)
+        {
+            this->vec_  = cast_src->vec_ + offset;
+            this->size_ = size;
+            this->view_ = true;
+        }
+    }
+
     template <typename ValueType>
     void HIPAcceleratorVector<ValueType>::Clear(void)
     {
         if(this->size_ > 0)
         {
-            free_hip(&this->vec_);
+            // Views do not own their data
+            if(this->view_ == true)
+            {
+                this->vec_ = NULL;
+            }
+            else
+            {
+                free_hip(&this->vec_);
+            }
+
             this->size_ = 0;
         }
 
+        this->view_ = false;
+
         if(this->index_size_ > 0)
         {
             free_hip(&this->index_buffer_);
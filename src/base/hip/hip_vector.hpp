@@ -47,6 +47,7 @@ namespace rocalution
         virtual void Allocate(int n);
         virtual void SetDataPtr(ValueType** ptr, int size);
         virtual void LeaveDataPtr(ValueType** ptr);
+        virtual void SetView(BaseVector<ValueType>& src, int offset, int size);
         virtual void Clear(void);
         virtual void Zeros(void);
         virtual void Ones(void);
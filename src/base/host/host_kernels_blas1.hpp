@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_KERNELS_BLAS1_HPP_
+#define ROCALUTION_HOST_HOST_KERNELS_BLAS1_HPP_
+
+#include <complex>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Element-wise kernels are compiled for AVX-512, AVX2 and the baseline target. The
+// variant is selected at load time according to the CPU. Contraction into FMA is
+// disabled for the including sources (see CMakeLists.txt), such that all variants
+// round exactly like the baseline.
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 6) && defined(__linux__) \
+    && defined(__x86_64__)
+#define HOST_SIMD_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define HOST_SIMD_CLONES
+#endif
+
+namespace rocalution
+{
+
+    // Product without the inf/nan handling of std::complex, such that it vectorizes
+    template <typename ValueType>
+    inline ValueType host_mul(ValueType a, ValueType b)
+    {
+        return a * b;
+    }
+
+    template <typename T>
+    inline std::complex<T> host_mul(std::complex<T> a, std::complex<T> b)
+    {
+        return std::complex<T>(a.real() * b.real() - a.imag() * b.imag(),
+                               a.real() * b.imag() + a.imag() * b.real());
+    }
+
+    // Splits [0, n) into one contiguous range per thread and calls f(begin, end)
+    template <typename Functor>
+    inline void host_parallel_range(int n, const Functor& f)
+    {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int tid = 0;
+            int nt  = 1;
+#ifdef _OPENMP
+            tid = omp_get_thread_num();
+            nt  = omp_get_num_threads();
+#endif
+
+            int begin = static_cast<int>((static_cast<long long>(n) * tid) / nt);
+            int end   = static_cast<int>((static_cast<long long>(n) * (tid + 1)) / nt);
+
+            if(begin < end)
+            {
+                f(begin, end);
+            }
+        }
+    }
+
+    // y = y + alpha * x
+    template <typename ValueType>
+    HOST_SIMD_CLONES void host_addscale(int n, ValueType alpha, const ValueType* x, ValueType* y)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] = y[i] + host_mul(alpha, x[i]);
+        }
+    }
+
+    // y = alpha * y + x
+    template <typename ValueType>
+    HOST_SIMD_CLONES void host_scaleadd(int n, ValueType alpha, const ValueType* x, ValueType* y)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] = host_mul(alpha, y[i]) + x[i];
+        }
+    }
+
+    // y = alpha * y + beta * x
+    template <typename ValueType>
+    HOST_SIMD_CLONES void host_scaleaddscale(
+        int n, ValueType alpha, const ValueType* x, ValueType beta, ValueType* y)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] = host_mul(alpha, y[i]) + host_mul(beta, x[i]);
+        }
+    }
+
+    // y = alpha * y + beta * x + gamma * z
+    template <typename ValueType>
+    HOST_SIMD_CLONES void host_scaleadd2(int              n,
+                                         ValueType        alpha,
+                                         const ValueType* x,
+                                         ValueType        beta,
+                                         const ValueType* z,
+                                         ValueType        gamma,
+                                         ValueType*       y)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] = host_mul(alpha, y[i]) + host_mul(beta, x[i]) + host_mul(gamma, z[i]);
+        }
+    }
+
+    // y = alpha * y
+    template <typename ValueType>
+    HOST_SIMD_CLONES void host_scale(int n, ValueType alpha, ValueType* y)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            y[i] = host_mul(alpha, y[i]);
+        }
+    }
+
+    // out = x * y (element-wise)
+    template <typename ValueType>
+    HOST_SIMD_CLONES void
+        host_pointwisemult(int n, const ValueType* x, const ValueType* y, ValueType* out)
+    {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            out[i] = host_mul(y[i], x[i]);
+        }
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_KERNELS_BLAS1_HPP_
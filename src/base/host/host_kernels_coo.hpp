@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_KERNELS_COO_HPP_
+#define ROCALUTION_HOST_HOST_KERNELS_COO_HPP_
+
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Returns true if the COO entries are sorted by row
+    template <typename IndexType>
+    bool host_coo_row_sorted(IndexType nnz, const IndexType* row)
+    {
+        bool sorted = true;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : sorted)
+#endif
+        for(IndexType i = 1; i < nnz; ++i)
+        {
+            sorted = sorted && (row[i - 1] <= row[i]);
+        }
+
+        return sorted;
+    }
+
+    // COO SpMV for entries in any order, out = out + scalar * A * in
+    template <typename ValueType, typename IndexType>
+    void host_coo_spmv_unsorted(IndexType        nnz,
+                                const IndexType* row,
+                                const IndexType* col,
+                                const ValueType* val,
+                                ValueType        scalar,
+                                const ValueType* in,
+                                ValueType*       out)
+    {
+        for(IndexType i = 0; i < nnz; ++i)
+        {
+            out[row[i]] += scalar * val[i] * in[col[i]];
+        }
+    }
+
+    // COO SpMV, out = out + scalar * A * in
+    // The nnz are split into equally sized chunks, one per thread. Each thread writes all
+    // rows that are completely contained in its chunk and keeps the partial sums of its
+    // first and last row (carry-out). The carry-outs are added afterwards in thread order,
+    // such that the result does not depend on the scheduling. Requires row-sorted COO.
+    template <typename ValueType, typename IndexType>
+    void host_coo_spmv(IndexType        nnz,
+                       const IndexType* row,
+                       const IndexType* col,
+                       const ValueType* val,
+                       ValueType        scalar,
+                       const ValueType* in,
+                       ValueType*       out)
+    {
+        int nthreads = 1;
+#ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+#endif
+
+        std::vector<IndexType> first_row(nthreads, -1);
+        std::vector<IndexType> last_row(nthreads, -1);
+        std::vector<ValueType> first_val(nthreads, static_cast<ValueType>(0));
+        std::vector<ValueType> last_val(nthreads, static_cast<ValueType>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int tid = 0;
+            int nt  = 1;
+#ifdef _OPENMP
+            tid = omp_get_thread_num();
+            nt  = omp_get_num_threads();
+#endif
+
+            IndexType begin = static_cast<IndexType>((static_cast<long long>(nnz) * tid) / nt);
+            IndexType end
+                = static_cast<IndexType>((static_cast<long long>(nnz) * (tid + 1)) / nt);
+
+            if(begin < end)
+            {
+                IndexType cur   = row[begin];
+                ValueType sum   = static_cast<ValueType>(0);
+                bool      first = true;
+
+                for(IndexType i = begin; i < end; ++i)
+                {
+                    if(row[i] != cur)
+                    {
+                        if(first == true)
+                        {
+                            // first row might be shared with the previous chunk
+                            first_row[tid] = cur;
+                            first_val[tid] = sum;
+                            first          = false;
+                        }
+                        else
+                        {
+                            out[cur] += scalar * sum;
+                        }
+
+                        cur = row[i];
+                        sum = static_cast<ValueType>(0);
+                    }
+
+                    sum += val[i] * in[col[i]];
+                }
+
+                // last row might be shared with the next chunk
+                last_row[tid] = cur;
+                last_val[tid] = sum;
+            }
+        }
+
+        // carry-out fix-up
+        for(int i = 0; i < nthreads; ++i)
+        {
+            if(first_row[i] != -1)
+            {
+                out[first_row[i]] += scalar * first_val[i];
+            }
+
+            if(last_row[i] != -1)
+            {
+                out[last_row[i]] += scalar * last_val[i];
+            }
+        }
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_KERNELS_COO_HPP_
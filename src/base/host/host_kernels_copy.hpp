@@ -0,0 +1,280 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_KERNELS_COPY_HPP_
+#define ROCALUTION_HOST_HOST_KERNELS_COPY_HPP_
+
+#include "host_kernels_blas1.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__)
+#define HOST_PREFETCH_READ(addr) __builtin_prefetch((addr), 0, 0)
+#define HOST_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1, 0)
+#else
+#define HOST_PREFETCH_READ(addr)
+#define HOST_PREFETCH_WRITE(addr)
+#endif
+
+namespace rocalution
+{
+
+    // Number of elements the permutation kernels prefetch ahead
+    static const int HOST_PREFETCH_DISTANCE = 16;
+
+    // Size of the per-thread staging buffer of the streaming kernels in bytes
+    static const int HOST_STREAM_CHUNK = 4096;
+
+    // Size of the last level cache in bytes
+    inline size_t host_llc_size(void)
+    {
+        long llc = -1;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+        llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        return (llc > 0) ? static_cast<size_t>(llc) : (32 << 20);
+    }
+
+    // Destinations of at least this many bytes are written with non-temporal stores. They
+    // do not fit into the last level cache, such that write-allocating them only costs
+    // memory bandwidth.
+    inline size_t host_stream_threshold(void)
+    {
+        static const size_t threshold = std::max(host_llc_size(), static_cast<size_t>(4 << 20));
+
+        return threshold;
+    }
+
+    // Copies size bytes with non-temporal stores, the unaligned head and tail of dst are
+    // copied through the cache. A store fence is required before dst is read by another
+    // thread.
+    inline void host_stream_store(const void* src, void* dst, size_t size)
+    {
+#if defined(__SSE2__)
+        const char* in  = static_cast<const char*>(src);
+        char*       out = static_cast<char*>(dst);
+
+        size_t head = (16 - (reinterpret_cast<uintptr_t>(out) & 15)) & 15;
+
+        if(head > size)
+        {
+            head = size;
+        }
+
+        memcpy(out, in, head);
+
+        in += head;
+        out += head;
+        size -= head;
+
+        size_t body = size & ~static_cast<size_t>(63);
+
+        for(size_t i = 0; i < body; i += 64)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 16));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 32));
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 48));
+
+            _mm_stream_si128(reinterpret_cast<__m128i*>(out + i), a);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(out + i + 16), b);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(out + i + 32), c);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(out + i + 48), d);
+        }
+
+        memcpy(out + body, in + body, size - body);
+#else
+        memcpy(dst, src, size);
+#endif
+    }
+
+    inline void host_stream_fence(void)
+    {
+#if defined(__SSE2__)
+        _mm_sfence();
+#endif
+    }
+
+    // Number of elements of type T between ptr and the previous cache line boundary
+    template <typename T>
+    inline int host_misalignment(const T* ptr)
+    {
+        return static_cast<int>((reinterpret_cast<uintptr_t>(ptr) & 63) / sizeof(T));
+    }
+
+    // Returns true if n elements of type T should be written with non-temporal stores
+    template <typename T>
+    inline bool host_use_streaming(int n)
+    {
+#if defined(__SSE2__)
+        return static_cast<size_t>(n) * sizeof(T) >= host_stream_threshold();
+#else
+        return false;
+#endif
+    }
+
+    // Returns true if a sample of perm moves entries further than a few pages, such that
+    // the hardware prefetcher cannot follow the indirect accesses
+    inline bool host_permutation_is_scattered(int n, const int* perm)
+    {
+        const int nsample = 64;
+        const int dist    = 4096;
+
+        int far = 0;
+
+        for(int k = 0; k < nsample; ++k)
+        {
+            int i = static_cast<int>((static_cast<long long>(n) * k) / nsample);
+            int d = perm[i] - i;
+
+            if(d > dist || d < -dist)
+            {
+                ++far;
+            }
+        }
+
+        return far >= nsample / 4;
+    }
+
+    // dst = src
+    template <typename T>
+    void host_copy(int n, const T* src, T* dst)
+    {
+        if(host_use_streaming<T>(n))
+        {
+            host_parallel_range(n, [&](int begin, int end) {
+                host_stream_store(src + begin, dst + begin, sizeof(T) * (end - begin));
+                host_stream_fence();
+            });
+
+            return;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            dst[i] = src[i];
+        }
+    }
+
+    // dst[i] = src[perm[i]]
+    // Scattered permutations of large arrays prefetch the source entries and stage the
+    // destination in a small buffer, which is then streamed
+    template <typename T>
+    void host_gather(int n, const int* perm, const T* src, T* dst)
+    {
+        if(host_use_streaming<T>(n) && host_permutation_is_scattered(n, perm))
+        {
+            host_parallel_range(n, [&](int begin, int end) {
+                const int chunk = HOST_STREAM_CHUNK / static_cast<int>(sizeof(T));
+                T         buffer[HOST_STREAM_CHUNK / sizeof(T)];
+
+                // The first chunk is shortened such that all further chunks start on a
+                // cache line boundary
+                int cap = chunk - host_misalignment(dst + begin);
+
+                for(int i = begin; i < end; i += cap, cap = chunk)
+                {
+                    int size = (end - i < cap) ? end - i : cap;
+
+                    int j    = 0;
+                    int stop = end - HOST_PREFETCH_DISTANCE - i;
+
+                    for(; j < size && j < stop; ++j)
+                    {
+                        HOST_PREFETCH_READ(src + perm[i + j + HOST_PREFETCH_DISTANCE]);
+                        buffer[j] = src[perm[i + j]];
+                    }
+
+                    for(; j < size; ++j)
+                    {
+                        buffer[j] = src[perm[i + j]];
+                    }
+
+                    host_stream_store(buffer, dst + i, sizeof(T) * size);
+                }
+
+                host_stream_fence();
+            });
+
+            return;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            dst[i] = src[perm[i]];
+        }
+    }
+
+    // dst[perm[i]] = src[i]
+    // Scattered non-temporal stores would defeat write combining, instead the destination
+    // entries of scattered permutations are prefetched for writing
+    template <typename T>
+    void host_scatter(int n, const int* perm, const T* src, T* dst)
+    {
+        if(host_use_streaming<T>(n) && host_permutation_is_scattered(n, perm))
+        {
+            host_parallel_range(n, [&](int begin, int end) {
+                int i    = begin;
+                int stop = end - HOST_PREFETCH_DISTANCE;
+
+                for(; i < stop; ++i)
+                {
+                    HOST_PREFETCH_WRITE(dst + perm[i + HOST_PREFETCH_DISTANCE]);
+                    dst[perm[i]] = src[i];
+                }
+
+                for(; i < end; ++i)
+                {
+                    dst[perm[i]] = src[i];
+                }
+            });
+
+            return;
+        }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < n; ++i)
+        {
+            dst[perm[i]] = src[i];
+        }
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_KERNELS_COPY_HPP_
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_KERNELS_DIA_HPP_
+#define ROCALUTION_HOST_HOST_KERNELS_DIA_HPP_
+
+#include "../matrix_formats_ind.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // DIA SpMV, out = A * in (add == false) or out = out + scalar * A * in (add == true)
+    // The rows are split into tiles that are processed in parallel. Within a tile, the
+    // diagonals are streamed one after the other into a tile sized accumulator. The valid
+    // row range of each diagonal is precomputed and clipped against the tile (boundary
+    // peeling), such that the inner loop has unit stride and no branches. Each row
+    // accumulates its diagonals in ascending order, as the row-wise kernel did.
+    template <typename ValueType, typename IndexType>
+    void host_dia_spmv(IndexType        nrow,
+                       IndexType        num_diag,
+                       const IndexType* offset,
+                       const ValueType* val,
+                       ValueType        scalar,
+                       const ValueType* in,
+                       ValueType*       out,
+                       bool             add)
+    {
+        // Number of rows per tile
+        const int tile = 1024;
+
+        // Valid row range [start, end) of each diagonal
+        std::vector<IndexType> start(num_diag);
+        std::vector<IndexType> end(num_diag);
+
+        for(IndexType j = 0; j < num_diag; ++j)
+        {
+            start[j] = std::max(static_cast<IndexType>(0), -offset[j]);
+            end[j]   = std::min(nrow, nrow - offset[j]);
+        }
+
+        IndexType ntiles = (nrow + tile - 1) / tile;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for(IndexType t = 0; t < ntiles; ++t)
+        {
+            ValueType sum[tile];
+
+            IndexType row_begin = t * tile;
+            IndexType row_end   = std::min(row_begin + static_cast<IndexType>(tile), nrow);
+            IndexType tile_size = row_end - row_begin;
+
+            for(IndexType i = 0; i < tile_size; ++i)
+            {
+                sum[i] = static_cast<ValueType>(0);
+            }
+
+            for(IndexType j = 0; j < num_diag; ++j)
+            {
+                IndexType first = std::max(start[j], row_begin);
+                IndexType last  = std::min(end[j], row_end);
+
+                IndexType        off = offset[j];
+                const ValueType* v   = val + DIA_IND(0, j, nrow, num_diag);
+
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(IndexType i = first; i < last; ++i)
+                {
+                    sum[i - row_begin] += v[i] * in[i + off];
+                }
+            }
+
+            if(add == true)
+            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(IndexType i = 0; i < tile_size; ++i)
+                {
+                    out[row_begin + i] += scalar * sum[i];
+                }
+            }
+            else
+            {
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                for(IndexType i = 0; i < tile_size; ++i)
+                {
+                    out[row_begin + i] = sum[i];
+                }
+            }
+        }
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_KERNELS_DIA_HPP_
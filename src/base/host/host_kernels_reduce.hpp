@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_HOST_HOST_KERNELS_REDUCE_HPP_
+#define ROCALUTION_HOST_HOST_KERNELS_REDUCE_HPP_
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Sum of f(i) for i in [begin, end), using four independent accumulators
+    template <typename T, typename Functor>
+    inline T host_block_sum(int begin, int end, const Functor& f)
+    {
+        T sum0 = static_cast<T>(0);
+        T sum1 = static_cast<T>(0);
+        T sum2 = static_cast<T>(0);
+        T sum3 = static_cast<T>(0);
+
+        int i = begin;
+
+        for(; i + 3 < end; i += 4)
+        {
+            sum0 += f(i);
+            sum1 += f(i + 1);
+            sum2 += f(i + 2);
+            sum3 += f(i + 3);
+        }
+
+        for(; i < end; ++i)
+        {
+            sum0 += f(i);
+        }
+
+        return (sum0 + sum1) + (sum2 + sum3);
+    }
+
+    // Pairwise sum of the n values in data
+    template <typename T>
+    T host_pairwise_sum(const T* data, int n)
+    {
+        if(n <= 2)
+        {
+            return (n == 0) ? static_cast<T>(0) : ((n == 1) ? data[0] : data[0] + data[1]);
+        }
+
+        int half = n / 2;
+
+        return host_pairwise_sum(data, half) + host_pairwise_sum(data + half, n - half);
+    }
+
+    // Sum of f(i) for i in [0, n)
+    // The range is split into fixed size blocks, which are summed with unrolled multiple
+    // accumulators. In the default mode, each thread adds the sums of its blocks into one
+    // partial sum and the partial sums are added in thread order. In reproducible mode,
+    // every block sum is kept and the block sums are combined pairwise, such that the
+    // result does not depend on the number of threads.
+    template <typename T, typename Functor>
+    T host_reduce(int n, const Functor& f, bool reproducible)
+    {
+        const int block = 2048;
+
+        int nblocks = (n + block - 1) / block;
+
+        if(nblocks <= 1)
+        {
+            return host_block_sum<T>(0, n, f);
+        }
+
+        if(reproducible == true)
+        {
+            std::vector<T> partial(nblocks);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for(int b = 0; b < nblocks; ++b)
+            {
+                partial[b] = host_block_sum<T>(b * block, std::min(n, (b + 1) * block), f);
+            }
+
+            return host_pairwise_sum(partial.data(), nblocks);
+        }
+
+        int nthreads = 1;
+#ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+#endif
+
+        std::vector<T> partial(nthreads, static_cast<T>(0));
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(nthreads)
+#endif
+        {
+            int tid = 0;
+#ifdef _OPENMP
+            tid = omp_get_thread_num();
+#endif
+
+            T sum = static_cast<T>(0);
+
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+            for(int b = 0; b < nblocks; ++b)
+            {
+                sum += host_block_sum<T>(b * block, std::min(n, (b + 1) * block), f);
+            }
+
+            partial[tid] = sum;
+        }
+
+        T sum = static_cast<T>(0);
+
+        for(int i = 0; i < nthreads; ++i)
+        {
+            sum += partial[i];
+        }
+
+        return sum;
+    }
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_KERNELS_REDUCE_HPP_
@@ -33,6 +33,7 @@
 #include "../../utils/log.hpp"
 #include "host_conversion.hpp"
 #include "host_io.hpp"
+#include "host_kernels_coo.hpp"
 #include "host_matrix_csr.hpp"
 #include "host_vector.hpp"
 
@@ -65,6 +66,9 @@ namespace rocalution
         this->mat_.row = NULL;
         this->mat_.col = NULL;
         this->mat_.val = NULL;
+
+        this->row_sorted_ = false;
+
         this->set_backend(local_backend);
     }
 
@@ -94,6 +98,8 @@ namespace rocalution
             this->ncol_ = 0;
             this->nnz_  = 0;
         }
+
+        this->row_sorted_ = false;
     }
 
     template <typename ValueType>
@@ -144,6 +150,10 @@ namespace rocalution
         this->mat_.row = *row;
         this->mat_.col = *col;
         this->mat_.val = *val;
+
+        _set_omp_backend_threads(this->local_backend_, this->nnz_);
+
+        this->row_sorted_ = host_coo_row_sorted(this->nnz_, this->mat_.row);
     }
 
     template <typename ValueType>
@@ -165,6 +175,8 @@ namespace rocalution
         this->nrow_ = 0;
         this->ncol_ = 0;
         this->nnz_  = 0;
+
+        this->row_sorted_ = false;
     }
 
     template <typename ValueType>
@@ -200,6 +212,8 @@ namespace rocalution
             {
                 this->mat_.val[j] = val[j];
             }
+
+            this->row_sorted_ = host_coo_row_sorted(this->nnz_, this->mat_.row);
         }
     }
 
@@ -284,6 +298,8 @@ namespace rocalution
                     this->mat_.val[j] = cast_mat->mat_.val[j];
                 }
             }
+
+            this->row_sorted_ = cast_mat->row_sorted_;
         }
         else
         {
@@ -334,6 +350,9 @@ namespace rocalution
                 this->ncol_ = cast_mat->ncol_;
                 this->nnz_  = cast_mat->nnz_;
 
+                // CSR rows are converted in order
+                this->row_sorted_ = true;
+
                 return true;
             }
         }
@@ -411,10 +430,26 @@ namespace rocalution
             cast_out->vec_[i] = static_cast<ValueType>(0);
         }
 
-        for(int i = 0; i < this->nnz_; ++i)
+        // Entries of the same row can only be summed up in parallel if they are contiguous
+        if(this->row_sorted_ == true)
         {
-            cast_out->vec_[this->mat_.row[i]]
-                += this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
+            host_coo_spmv(this->nnz_,
+                          this->mat_.row,
+                          this->mat_.col,
+                          this->mat_.val,
+                          static_cast<ValueType>(1),
+                          cast_in->vec_,
+                          cast_out->vec_);
+        }
+        else
+        {
+            host_coo_spmv_unsorted(this->nnz_,
+                                   this->mat_.row,
+                                   this->mat_.col,
+                                   this->mat_.val,
+                                   static_cast<ValueType>(1),
+                                   cast_in->vec_,
+                                   cast_out->vec_);
         }
     }
 
@@ -436,10 +471,27 @@ namespace rocalution
             assert(cast_in != NULL);
             assert(cast_out != NULL);
 
-            for(int i = 0; i < this->nnz_; ++i)
+            _set_omp_backend_threads(this->local_backend_, this->nnz_);
+
+            if(this->row_sorted_ == true)
             {
-                cast_out->vec_[this->mat_.row[i]]
-                    += scalar * this->mat_.val[i] * cast_in->vec_[this->mat_.col[i]];
+                host_coo_spmv(this->nnz_,
+                              this->mat_.row,
+                              this->mat_.col,
+                              this->mat_.val,
+                              scalar,
+                              cast_in->vec_,
+                              cast_out->vec_);
+            }
+            else
+            {
+                host_coo_spmv_unsorted(this->nnz_,
+                                       this->mat_.row,
+                                       this->mat_.col,
+                                       this->mat_.val,
+                                       scalar,
+                                       cast_in->vec_,
+                                       cast_out->vec_);
             }
         }
     }
@@ -493,6 +545,8 @@ namespace rocalution
             free_host(&row);
             free_host(&col);
             free_host(&val);
+
+            this->row_sorted_ = true;
         }
 
         return true;
@@ -522,6 +576,9 @@ namespace rocalution
             this->mat_.col[i] = cast_perm->vec_[src.mat_.col[i]];
         }
 
+        // The permuted rows are not in order anymore
+        this->row_sorted_ = false;
+
         return true;
     }
 
@@ -564,6 +621,8 @@ namespace rocalution
 
         free_host(&pb);
 
+        this->row_sorted_ = false;
+
         return true;
     }
 
@@ -82,6 +82,9 @@ namespace rocalution
     private:
         MatrixCOO<ValueType, int> mat_;
 
+        // Entries are sorted by row, required by the parallel SpMV
+        bool row_sorted_;
+
         friend class BaseVector<ValueType>;
         friend class HostVector<ValueType>;
         friend class HostMatrixCSR<ValueType>;
@@ -28,6 +28,7 @@
 #include "../../utils/math_functions.hpp"
 #include "../matrix_formats_ind.hpp"
 #include "host_conversion.hpp"
+#include "host_kernels_copy.hpp"
 #include "host_matrix_bcsr.hpp"
 #include "host_matrix_coo.hpp"
 #include "host_matrix_dense.hpp"
@@ -41,10 +42,12 @@
 #include <algorithm>
 #include <complex>
 #include <fstream>
+#include <functional>
 #include <limits>
 #include <map>
 #include <math.h>
 #include <string.h>
+#include <thread>
 #include <typeindex>
 #include <typeinfo>
 #include <vector>
@@ -351,6 +354,36 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::CopyPatternToCSR(int* row_offsets, int* col) const
+    {
+        if(this->nnz_ > 0)
+        {
+            assert(this->nrow_ > 0);
+            assert(this->ncol_ > 0);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int i = 0; i < this->nrow_ + 1; ++i)
+            {
+                row_offsets[i] = this->mat_.row_offset[i];
+            }
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int j = 0; j < this->nnz_; ++j)
+            {
+                col[j] = this->mat_.col[j];
+            }
+        }
+
+        return true;
+    }
+
     template <typename ValueType>
     void HostMatrixCSR<ValueType>::CopyFrom(const BaseMatrix<ValueType>& mat)
     {
@@ -825,6 +858,199 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::Residual(const BaseVector<ValueType>& b,
+                                            const BaseVector<ValueType>& x,
+                                            BaseVector<ValueType>*       res) const
+    {
+        assert(b.GetSize() == this->nrow_);
+        assert(x.GetSize() == this->ncol_);
+        assert(res->GetSize() == this->nrow_);
+
+        const HostVector<ValueType>* cast_b   = dynamic_cast<const HostVector<ValueType>*>(&b);
+        const HostVector<ValueType>* cast_x   = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_res = dynamic_cast<HostVector<ValueType>*>(res);
+
+        assert(cast_b != NULL);
+        assert(cast_x != NULL);
+        assert(cast_res != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            ValueType sum     = static_cast<ValueType>(0);
+            int       row_beg = this->mat_.row_offset[ai];
+            int       row_end = this->mat_.row_offset[ai + 1];
+
+            for(int aj = row_beg; aj < row_end; ++aj)
+            {
+                sum += this->mat_.val[aj] * cast_x->vec_[this->mat_.col[aj]];
+            }
+
+            cast_res->vec_[ai] = cast_b->vec_[ai] - sum;
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ResidualRestrict(const BaseMatrix<ValueType>& restriction,
+                                                    const BaseVector<ValueType>& b,
+                                                    const BaseVector<ValueType>& x,
+                                                    BaseVector<ValueType>*       coarse,
+                                                    bool                         unique_cols) const
+    {
+        const HostMatrixCSR<ValueType>* cast_rest
+            = dynamic_cast<const HostMatrixCSR<ValueType>*>(&restriction);
+
+        if(cast_rest == NULL)
+        {
+            return false;
+        }
+
+        // Each residual entry is evaluated once per entry of the restriction, only
+        // restrictions with at most one entry per fine row (aggregation) pay off
+        if(cast_rest->nnz_ > cast_rest->ncol_)
+        {
+            return false;
+        }
+
+        assert(b.GetSize() == this->nrow_);
+        assert(x.GetSize() == this->ncol_);
+        assert(cast_rest->ncol_ == this->nrow_);
+        assert(coarse->GetSize() == cast_rest->nrow_);
+
+        // Count the entries of each fine row, unless the caller did it once in advance
+        if(unique_cols == false)
+        {
+            int* count = NULL;
+            allocate_host(cast_rest->ncol_, &count);
+            set_to_zero_host(cast_rest->ncol_, count);
+
+            bool multiple = false;
+
+            _set_omp_backend_threads(this->local_backend_, cast_rest->nnz_);
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(|| : multiple)
+#endif
+            for(int j = 0; j < cast_rest->nnz_; ++j)
+            {
+                int c;
+
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+                c = count[cast_rest->mat_.col[j]]++;
+
+                multiple = multiple || (c > 0);
+            }
+
+            free_host(&count);
+
+            if(multiple == true)
+            {
+                return false;
+            }
+        }
+
+        const HostVector<ValueType>* cast_b      = dynamic_cast<const HostVector<ValueType>*>(&b);
+        const HostVector<ValueType>* cast_x      = dynamic_cast<const HostVector<ValueType>*>(&x);
+        HostVector<ValueType>*       cast_coarse = dynamic_cast<HostVector<ValueType>*>(coarse);
+
+        assert(cast_b != NULL);
+        assert(cast_x != NULL);
+        assert(cast_coarse != NULL);
+
+        _set_omp_backend_threads(this->local_backend_, cast_rest->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ci = 0; ci < cast_rest->nrow_; ++ci)
+        {
+            ValueType sum = static_cast<ValueType>(0);
+
+            for(int cj = cast_rest->mat_.row_offset[ci]; cj < cast_rest->mat_.row_offset[ci + 1];
+                ++cj)
+            {
+                int       ai = cast_rest->mat_.col[cj];
+                ValueType r  = static_cast<ValueType>(0);
+
+                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                {
+                    r += this->mat_.val[aj] * cast_x->vec_[this->mat_.col[aj]];
+                }
+
+                sum += cast_rest->mat_.val[cj] * (cast_b->vec_[ai] - r);
+            }
+
+            cast_coarse->vec_[ci] = sum;
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ApplyAddSubMatrix(int                          row_offset,
+                                                     int                          col_offset,
+                                                     int                          row_size,
+                                                     int                          col_size,
+                                                     const BaseVector<ValueType>& in,
+                                                     ValueType                    scalar,
+                                                     BaseVector<ValueType>*       out) const
+    {
+        assert(row_offset >= 0);
+        assert(col_offset >= 0);
+        assert(row_offset + row_size <= this->nrow_);
+        assert(col_offset + col_size <= this->ncol_);
+        assert(in.GetSize() == col_size);
+        assert(out->GetSize() == row_size);
+
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
+
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
+
+        int col_end = col_offset + col_size;
+
+        _set_omp_backend_threads(this->local_backend_, row_size);
+
+        // Columns outside of the range are skipped on the fly, the entries are accumulated
+        // like in ApplyAdd() of the extracted sub-matrix
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < row_size; ++i)
+        {
+            int ai = row_offset + i;
+
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col = this->mat_.col[aj];
+
+                if(col >= col_offset && col < col_end)
+                {
+                    cast_out->vec_[i]
+                        += scalar * this->mat_.val[aj] * cast_in->vec_[col - col_offset];
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::SupportsApplyAddSubMatrix(void) const
+    {
+        return true;
+    }
+
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::ExtractDiagonal(BaseVector<ValueType>* vec_diag) const
     {
@@ -1502,215 +1728,533 @@ namespace rocalution
         return true;
     }
 
-    // Algorithm for ILU factorization is based on
-    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ILU0Factorize(void)
+    bool HostMatrixCSR<ValueType>::SSORSolve(ValueType                    omega,
+                                             int                          nblocks,
+                                             const BaseVector<ValueType>& in,
+                                             BaseVector<ValueType>*       out) const
     {
+        assert(nblocks > 0);
+        assert(in.GetSize() >= 0);
+        assert(out->GetSize() >= 0);
         assert(this->nrow_ == this->ncol_);
-        assert(this->nnz_ > 0);
+        assert(in.GetSize() == this->ncol_);
+        assert(out->GetSize() == this->nrow_);
 
-        // pointer of upper part of each row
-        int* diag_offset = NULL;
-        int* nnz_entries = NULL;
+        const HostVector<ValueType>* cast_in  = dynamic_cast<const HostVector<ValueType>*>(&in);
+        HostVector<ValueType>*       cast_out = dynamic_cast<HostVector<ValueType>*>(out);
 
-        allocate_host(this->nrow_, &diag_offset);
-        allocate_host(this->nrow_, &nnz_entries);
+        assert(cast_in != NULL);
+        assert(cast_out != NULL);
 
-        for(int i = 0; i < this->nrow_; ++i)
-        {
-            nnz_entries[i] = 0;
-        }
+        ValueType two = static_cast<ValueType>(2);
 
-        // ai = 0 to N loop over all rows
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+        // Each block only uses the couplings within its own rows
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < nblocks; ++b)
         {
-            // ai-th row entries
-            int row_start = this->mat_.row_offset[ai];
-            int row_end   = this->mat_.row_offset[ai + 1];
-            int j;
+            int first = static_cast<int>(static_cast<long long>(b) * this->nrow_ / nblocks);
+            int last  = static_cast<int>(static_cast<long long>(b + 1) * this->nrow_ / nblocks);
 
-            // nnz position of ai-th row in mat_.val array
-            for(j = row_start; j < row_end; ++j)
+            // Forward sweep, (D / omega + L) out = in
+            for(int ai = first; ai < last; ++ai)
             {
-                nnz_entries[this->mat_.col[j]] = j;
-            }
+                ValueType sum  = cast_in->vec_[ai];
+                ValueType diag = static_cast<ValueType>(0);
 
-            // loop over ai-th row nnz entries
-            for(j = row_start; j < row_end; ++j)
-            {
-                // if nnz entry is in lower matrix
-                if(this->mat_.col[j] < ai)
+                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
                 {
-                    int col_j  = this->mat_.col[j];
-                    int diag_j = diag_offset[col_j];
+                    int col_aj = this->mat_.col[aj];
 
-                    if(this->mat_.val[diag_j] != static_cast<ValueType>(0))
+                    if(col_aj >= first && col_aj < ai)
                     {
-                        // multiplication factor
-                        this->mat_.val[j] = this->mat_.val[j] / this->mat_.val[diag_j];
-
-                        // loop over upper offset pointer and do linear combination for nnz entry
-                        for(int k = diag_j + 1; k < this->mat_.row_offset[col_j + 1]; ++k)
-                        {
-                            // if nnz at this position do linear combination
-                            if(nnz_entries[this->mat_.col[k]] != 0)
-                            {
-                                this->mat_.val[nnz_entries[this->mat_.col[k]]]
-                                    -= this->mat_.val[j] * this->mat_.val[k];
-                            }
-                        }
+                        sum -= this->mat_.val[aj] * cast_out->vec_[col_aj];
+                    }
+                    else if(col_aj == ai)
+                    {
+                        diag = this->mat_.val[aj];
                     }
                 }
-                else
-                {
-                    break;
-                }
-            }
 
-            // set diagonal pointer to diagonal element
-            diag_offset[ai] = j;
+                assert(diag != static_cast<ValueType>(0));
 
-            // clear nnz entries
-            for(j = row_start; j < row_end; ++j)
+                cast_out->vec_[ai] = omega * sum / diag;
+            }
+
+            // Backward sweep, (D / omega + U) out = (2 - omega) / omega D out
+            for(int ai = last - 1; ai >= first; --ai)
             {
-                nnz_entries[this->mat_.col[j]] = 0;
+                ValueType sum  = static_cast<ValueType>(0);
+                ValueType diag = static_cast<ValueType>(0);
+
+                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+                {
+                    int col_aj = this->mat_.col[aj];
+
+                    if(col_aj > ai && col_aj < last)
+                    {
+                        sum += this->mat_.val[aj] * cast_out->vec_[col_aj];
+                    }
+                    else if(col_aj == ai)
+                    {
+                        diag = this->mat_.val[aj];
+                    }
+                }
+
+                cast_out->vec_[ai] = (two - omega) * cast_out->vec_[ai] - omega * sum / diag;
             }
         }
 
-        free_host(&diag_offset);
-        free_host(&nnz_entries);
-
         return true;
     }
 
-    // Algorithm for ILUT factorization is based on
-    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
     template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ILUTFactorize(double t, int maxrow)
+    bool HostMatrixCSR<ValueType>::ComponentAveragingSplit(int                    nblocks,
+                                                           BaseMatrix<ValueType>* split,
+                                                           BaseMatrix<ValueType>* average) const
     {
-        assert(this->nrow_ == this->ncol_);
-        assert(this->nnz_ > 0);
+        assert(nblocks > 0);
+        assert(split != NULL);
+        assert(average != NULL);
 
-        int nrow = this->nrow_;
-        int ncol = this->ncol_;
+        HostMatrixCSR<ValueType>* cast_split = dynamic_cast<HostMatrixCSR<ValueType>*>(split);
+        HostMatrixCSR<ValueType>* cast_avg   = dynamic_cast<HostMatrixCSR<ValueType>*>(average);
 
-        int*       row_offset  = NULL;
-        int*       diag_offset = NULL;
-        int*       nnz_entries = NULL;
-        bool*      nnz_pos     = (bool*)malloc(nrow * sizeof(bool));
-        ValueType* w           = NULL;
+        assert(cast_split != NULL);
+        assert(cast_avg != NULL);
 
-        allocate_host(nrow + 1, &row_offset);
-        allocate_host(nrow, &diag_offset);
-        allocate_host(nrow, &nnz_entries);
-        allocate_host(nrow, &w);
+        // Sorted columns of each block
+        std::vector<std::vector<int>> block_col(nblocks);
 
-        for(int i = 0; i < nrow; ++i)
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < nblocks; ++b)
         {
-            w[i]           = 0.0;
-            nnz_entries[i] = -1;
-            nnz_pos[i]     = false;
-            diag_offset[i] = 0;
-        }
+            int first = static_cast<int>(static_cast<long long>(b) * this->nrow_ / nblocks);
+            int last  = static_cast<int>(static_cast<long long>(b + 1) * this->nrow_ / nblocks);
 
-        // pre-allocate 1.5x nnz arrays for preconditioner matrix
-        int        nnzA       = this->nnz_;
-        int        alloc_size = int(nnzA * 1.5);
-        int*       col        = (int*)malloc(alloc_size * sizeof(int));
-        ValueType* val        = (ValueType*)malloc(alloc_size * sizeof(ValueType));
+            block_col[b].assign(this->mat_.col + this->mat_.row_offset[first],
+                                this->mat_.col + this->mat_.row_offset[last]);
 
-        // initialize row_offset
-        row_offset[0] = 0;
-        int nnz       = 0;
+            std::sort(block_col[b].begin(), block_col[b].end());
+            block_col[b].erase(std::unique(block_col[b].begin(), block_col[b].end()),
+                               block_col[b].end());
+        }
 
-        // loop over all rows
-        for(int ai = 0; ai < this->nrow_; ++ai)
+        // The columns of block b are numbered from block_offset[b] on
+        std::vector<int> block_offset(nblocks + 1);
+
+        block_offset[0] = 0;
+        for(int b = 0; b < nblocks; ++b)
         {
-            row_offset[ai + 1] = row_offset[ai];
+            block_offset[b + 1] = block_offset[b] + static_cast<int>(block_col[b].size());
+        }
 
-            int    row_begin = this->mat_.row_offset[ai];
-            int    row_end   = this->mat_.row_offset[ai + 1];
-            double row_norm  = 0.0;
+        int ncol = block_offset[nblocks];
 
-            // fill working array with ai-th row
-            int m = 0;
-            for(int aj = row_begin; aj < row_end; ++aj)
-            {
-                int idx        = this->mat_.col[aj];
-                w[idx]         = this->mat_.val[aj];
-                nnz_entries[m] = idx;
-                nnz_pos[idx]   = true;
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
 
-                row_norm += std::abs(this->mat_.val[aj]);
-                ++m;
-            }
+        allocate_host(this->nrow_ + 1, &row_offset);
+        allocate_host(this->nnz_, &col);
+        allocate_host(this->nnz_, &val);
 
-            // threshold for dropping strategy
-            double threshold = t * row_norm / (row_end - row_begin);
+        row_offset[0] = 0;
 
-            for(int k = 0; k < nrow; ++k)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < nblocks; ++b)
+        {
+            int first = static_cast<int>(static_cast<long long>(b) * this->nrow_ / nblocks);
+            int last  = static_cast<int>(static_cast<long long>(b + 1) * this->nrow_ / nblocks);
+
+            for(int ai = first; ai < last; ++ai)
+            {
+                row_offset[ai + 1] = this->mat_.row_offset[ai + 1];
+            }
+
+            for(int aj = this->mat_.row_offset[first]; aj < this->mat_.row_offset[last]; ++aj)
+            {
+                val[aj] = this->mat_.val[aj];
+                col[aj] = block_offset[b]
+                          + static_cast<int>(std::lower_bound(block_col[b].begin(),
+                                                              block_col[b].end(),
+                                                              this->mat_.col[aj])
+                                             - block_col[b].begin());
+            }
+        }
+
+        cast_split->Clear();
+        cast_split->SetDataPtrCSR(&row_offset, &col, &val, this->nnz_, this->nrow_, ncol);
+
+        row_offset = NULL;
+        col        = NULL;
+        val        = NULL;
+
+        // Row i of the averaging matrix holds 1 / m_i for each of the m_i blocks with
+        // column i
+        allocate_host(this->ncol_ + 1, &row_offset);
+        allocate_host(ncol, &col);
+        allocate_host(ncol, &val);
+
+        set_to_zero_host(this->ncol_ + 1, row_offset);
+
+        for(int b = 0; b < nblocks; ++b)
+        {
+            for(size_t k = 0; k < block_col[b].size(); ++k)
+            {
+                ++row_offset[block_col[b][k] + 1];
+            }
+        }
+
+        for(int i = 0; i < this->ncol_; ++i)
+        {
+            row_offset[i + 1] += row_offset[i];
+        }
+
+        std::vector<int> pos(row_offset, row_offset + this->ncol_);
+
+        for(int b = 0; b < nblocks; ++b)
+        {
+            for(size_t k = 0; k < block_col[b].size(); ++k)
+            {
+                int i  = block_col[b][k];
+                int aj = pos[i]++;
+
+                col[aj] = block_offset[b] + static_cast<int>(k);
+                val[aj] = static_cast<ValueType>(1)
+                          / static_cast<ValueType>(row_offset[i + 1] - row_offset[i]);
+            }
+        }
+
+        cast_avg->Clear();
+        cast_avg->SetDataPtrCSR(&row_offset, &col, &val, ncol, this->ncol_, ncol);
+
+        return true;
+    }
+
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::KaczmarzSweep(ValueType                    omega,
+                                                 int                          nblocks,
+                                                 const BaseVector<ValueType>& rhs,
+                                                 BaseVector<ValueType>*       x) const
+    {
+        assert(nblocks > 0);
+        assert(rhs.GetSize() >= 0);
+        assert(x->GetSize() >= 0);
+        assert(rhs.GetSize() == this->nrow_);
+        assert(x->GetSize() == this->ncol_);
+
+        const HostVector<ValueType>* cast_rhs = dynamic_cast<const HostVector<ValueType>*>(&rhs);
+        HostVector<ValueType>*       cast_x   = dynamic_cast<HostVector<ValueType>*>(x);
+
+        assert(cast_rhs != NULL);
+        assert(cast_x != NULL);
+
+        // Project x onto the hyperplane of row ai
+        auto project = [this, omega, cast_rhs, cast_x](int ai) {
+            ValueType res  = cast_rhs->vec_[ai];
+            ValueType norm = static_cast<ValueType>(0);
+
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                res -= this->mat_.val[aj] * cast_x->vec_[this->mat_.col[aj]];
+                norm += rocalution_conj(this->mat_.val[aj]) * this->mat_.val[aj];
+            }
+
+            if(norm != static_cast<ValueType>(0))
             {
-                if(nnz_entries[k] == -1)
+                res *= omega / norm;
+
+                for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1];
+                    ++aj)
                 {
-                    break;
+                    cast_x->vec_[this->mat_.col[aj]] += res * rocalution_conj(this->mat_.val[aj]);
                 }
+            }
+        };
 
-                int aj = nnz_entries[k];
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-                // get smallest column index
-                int sidx = k;
-                for(int j = k + 1; j < nrow; ++j)
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int b = 0; b < nblocks; ++b)
+        {
+            int first = static_cast<int>(static_cast<long long>(b) * this->nrow_ / nblocks);
+            int last  = static_cast<int>(static_cast<long long>(b + 1) * this->nrow_ / nblocks);
+
+            for(int ai = first; ai < last; ++ai)
+            {
+                project(ai);
+            }
+
+            for(int ai = last - 1; ai >= first; --ai)
+            {
+                project(ai);
+            }
+        }
+
+        return true;
+    }
+
+    // Algorithm for ILU factorization is based on
+    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ILU0Factorize(void)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        // pointer of upper part of each row
+        int* diag_offset = NULL;
+        int* nnz_entries = NULL;
+
+        allocate_host(this->nrow_, &diag_offset);
+        allocate_host(this->nrow_, &nnz_entries);
+
+        for(int i = 0; i < this->nrow_; ++i)
+        {
+            nnz_entries[i] = 0;
+        }
+
+        // ai = 0 to N loop over all rows
+        for(int ai = 0; ai < this->nrow_; ++ai)
+        {
+            // ai-th row entries
+            int row_start = this->mat_.row_offset[ai];
+            int row_end   = this->mat_.row_offset[ai + 1];
+            int j;
+
+            // nnz position of ai-th row in mat_.val array
+            for(j = row_start; j < row_end; ++j)
+            {
+                nnz_entries[this->mat_.col[j]] = j;
+            }
+
+            // loop over ai-th row nnz entries
+            for(j = row_start; j < row_end; ++j)
+            {
+                // if nnz entry is in lower matrix
+                if(this->mat_.col[j] < ai)
                 {
-                    if(nnz_entries[j] == -1)
-                    {
-                        break;
-                    }
+                    int col_j  = this->mat_.col[j];
+                    int diag_j = diag_offset[col_j];
 
-                    if(nnz_entries[j] < aj)
+                    if(this->mat_.val[diag_j] != static_cast<ValueType>(0))
                     {
-                        sidx = j;
-                        aj   = nnz_entries[j];
+                        // multiplication factor
+                        this->mat_.val[j] = this->mat_.val[j] / this->mat_.val[diag_j];
+
+                        // loop over upper offset pointer and do linear combination for nnz entry
+                        for(int k = diag_j + 1; k < this->mat_.row_offset[col_j + 1]; ++k)
+                        {
+                            // if nnz at this position do linear combination
+                            if(nnz_entries[this->mat_.col[k]] != 0)
+                            {
+                                this->mat_.val[nnz_entries[this->mat_.col[k]]]
+                                    -= this->mat_.val[j] * this->mat_.val[k];
+                            }
+                        }
                     }
                 }
+                else
+                {
+                    break;
+                }
+            }
+
+            // set diagonal pointer to diagonal element
+            diag_offset[ai] = j;
+
+            // clear nnz entries
+            for(j = row_start; j < row_end; ++j)
+            {
+                nnz_entries[this->mat_.col[j]] = 0;
+            }
+        }
+
+        free_host(&diag_offset);
+        free_host(&nnz_entries);
+
+        return true;
+    }
 
-                aj = nnz_entries[k];
+    // Algorithm for ILUT factorization is based on
+    // Y. Saad, Iterative methods for sparse linear systems, 2nd edition, SIAM
+    //
+    // The rows are distributed dynamically and in ascending order among the threads.
+    // Each row only waits for the rows it is eliminated with, such that independent
+    // rows are factorized concurrently. Since every row is computed from the final
+    // values of its predecessors, the factorization does not depend on the number of
+    // threads.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ILUTFactorize(double t, int maxrow)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        int nrow = this->nrow_;
+        int ncol = this->ncol_;
+
+        // Factorized rows, each row is stored in the workspace of the thread that
+        // computed it
+        int*  row_nnz  = NULL;
+        int*  row_diag = NULL;
+        char* done     = NULL;
+
+        std::vector<int*>       row_col(nrow, NULL);
+        std::vector<ValueType*> row_val(nrow, NULL);
+
+        allocate_host(nrow, &row_nnz);
+        allocate_host(nrow, &row_diag);
+        allocate_host(nrow, &done);
+
+        set_to_zero_host(nrow, done);
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+        int nthreads = omp_get_max_threads();
+
+        // Workspace blocks of each thread, a block is never resized
+        int max_row_nnz = std::min(2 * maxrow + 1, ncol);
+        int block_size  = std::max(max_row_nnz, int(this->nnz_ * 1.5) / nthreads);
+
+        std::vector<std::vector<int*>>       block_col(nthreads);
+        std::vector<std::vector<ValueType*>> block_val(nthreads);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            int tid = omp_get_thread_num();
+
+            // Sparse accumulator of this thread
+            ValueType* w           = NULL;
+            int*       nnz_entries = NULL;
+            char*      nnz_pos     = NULL;
 
-                // swap column index
-                if(k != sidx)
+            allocate_host(nrow, &w);
+            allocate_host(nrow, &nnz_entries);
+            allocate_host(nrow, &nnz_pos);
+
+            set_to_zero_host(nrow, w);
+            set_to_zero_host(nrow, nnz_pos);
+
+            // Lower part column indices, processed in ascending order
+            std::vector<int> lower;
+
+            int*       free_col  = NULL;
+            ValueType* free_val  = NULL;
+            int        free_size = 0;
+
+            // Rows wait for the rows they depend on, so they are handed out in increasing
+            // order. Dynamic schedules are nonmonotonic by default since OpenMP 5.0.
+#if defined(_OPENMP) && _OPENMP >= 201511
+#pragma omp for schedule(monotonic : dynamic, 1)
+#elif defined(_OPENMP)
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int ai = 0; ai < nrow; ++ai)
+            {
+                int    row_begin = this->mat_.row_offset[ai];
+                int    row_end   = this->mat_.row_offset[ai + 1];
+                double row_norm  = 0.0;
+
+                lower.clear();
+
+                // fill working array with ai-th row
+                int m = 0;
+                for(int aj = row_begin; aj < row_end; ++aj)
                 {
-                    nnz_entries[k]    = nnz_entries[sidx];
-                    nnz_entries[sidx] = aj;
-                    aj                = nnz_entries[k];
+                    int idx        = this->mat_.col[aj];
+                    w[idx]         = this->mat_.val[aj];
+                    nnz_entries[m] = idx;
+                    nnz_pos[idx]   = 1;
+
+                    if(idx < ai)
+                    {
+                        lower.push_back(idx);
+                    }
+
+                    row_norm += std::abs(this->mat_.val[aj]);
+                    ++m;
                 }
 
+                std::make_heap(lower.begin(), lower.end(), std::greater<int>());
+
+                // threshold for dropping strategy
+                double threshold = t * row_norm / (row_end - row_begin);
+
                 // lower matrix part
-                if(aj < ai)
+                while(lower.empty() == false)
                 {
+                    std::pop_heap(lower.begin(), lower.end(), std::greater<int>());
+
+                    int aj = lower.back();
+                    lower.pop_back();
+
+                    // wait until the aj-th row has been factorized
+                    char ready = 0;
+                    while(ready == 0)
+                    {
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                        ready = done[aj];
+
+                        if(ready == 0)
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+#ifdef _OPENMP
+#pragma omp flush
+#endif
+
+                    const int*       col  = row_col[aj];
+                    const ValueType* val  = row_val[aj];
+                    int              diag = row_diag[aj];
+
                     // if zero diagonal entry do nothing
-                    if(val[diag_offset[aj]] == static_cast<ValueType>(0))
+                    if(diag < 0 || val[diag] == static_cast<ValueType>(0))
                     {
                         LOG_INFO("(ILUT) zero row");
                         continue;
                     }
 
-                    w[aj] /= val[diag_offset[aj]];
+                    w[aj] /= val[diag];
 
                     // do linear combination with previous row
-                    for(int l = diag_offset[aj] + 1; l < row_offset[aj + 1]; ++l)
+                    for(int l = diag + 1; l < row_nnz[aj]; ++l)
                     {
                         int       idx    = col[l];
                         ValueType fillin = w[aj] * val[l];
 
                         // drop off strategy for fill in
-                        if(nnz_pos[idx] == false)
+                        if(nnz_pos[idx] == 0)
                         {
                             if(std::abs(fillin) >= threshold)
                             {
                                 nnz_entries[m] = idx;
-                                nnz_pos[idx]   = true;
+                                nnz_pos[idx]   = 1;
                                 w[idx] -= fillin;
                                 ++m;
+
+                                if(idx < ai)
+                                {
+                                    lower.push_back(idx);
+                                    std::push_heap(lower.begin(), lower.end(), std::greater<int>());
+                                }
                             }
                         }
                         else
@@ -1719,156 +2263,531 @@ namespace rocalution
                         }
                     }
                 }
+
+                std::sort(nnz_entries, nnz_entries + m);
+
+                // number of entries of the ai-th row of the preconditioner matrix
+                int num_lower = 0;
+                int num_upper = 0;
+                int num_diag  = 0;
+
+                for(int k = 0; k < m; ++k)
+                {
+                    if(nnz_entries[k] < ai)
+                    {
+                        ++num_lower;
+                    }
+                    else if(nnz_entries[k] > ai)
+                    {
+                        ++num_upper;
+                    }
+                    else
+                    {
+                        num_diag = 1;
+                    }
+                }
+
+                num_lower = std::min(num_lower, maxrow);
+                num_upper = std::min(num_upper, maxrow);
+
+                int row_size = num_lower + num_diag + num_upper;
+
+                // get a new workspace block if needed
+                if(free_size < row_size)
+                {
+                    free_col = NULL;
+                    free_val = NULL;
+
+                    allocate_host(block_size, &free_col);
+                    allocate_host(block_size, &free_val);
+
+                    block_col[tid].push_back(free_col);
+                    block_val[tid].push_back(free_val);
+
+                    free_size = block_size;
+                }
+
+                // fill ai-th row of preconditioner matrix
+                int nnz      = 0;
+                row_diag[ai] = -1;
+
+                for(int k = 0, nl = 0, nu = 0; k < m; ++k)
+                {
+                    int aj = nnz_entries[k];
+
+                    // lower part
+                    if(aj < ai && nl < num_lower)
+                    {
+                        free_col[nnz] = aj;
+                        free_val[nnz] = w[aj];
+                        ++nl;
+                        ++nnz;
+
+                        // upper part
+                    }
+                    else if(aj > ai && nu < num_upper)
+                    {
+                        free_col[nnz] = aj;
+                        free_val[nnz] = w[aj];
+                        ++nu;
+                        ++nnz;
+
+                        // diagonal part
+                    }
+                    else if(aj == ai)
+                    {
+                        free_col[nnz] = aj;
+                        free_val[nnz] = w[aj];
+                        row_diag[ai]  = nnz;
+                        ++nnz;
+                    }
+
+                    // clear working arrays
+                    w[aj]       = static_cast<ValueType>(0);
+                    nnz_pos[aj] = 0;
+                }
+
+                assert(nnz == row_size);
+
+                row_col[ai] = free_col;
+                row_val[ai] = free_val;
+                row_nnz[ai] = nnz;
+
+                free_col += nnz;
+                free_val += nnz;
+                free_size -= nnz;
+
+                // mark ai-th row as factorized
+#ifdef _OPENMP
+#pragma omp flush
+#pragma omp atomic write
+#endif
+                done[ai] = 1;
+            }
+
+            free_host(&w);
+            free_host(&nnz_entries);
+            free_host(&nnz_pos);
+        }
+
+        free_host(&row_diag);
+        free_host(&done);
+
+        // Assemble the preconditioner matrix
+        int* row_offset = NULL;
+        allocate_host(nrow + 1, &row_offset);
+
+        row_offset[0] = 0;
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_offset[i + 1] = row_offset[i] + row_nnz[i];
+        }
+
+        int        nnz = row_offset[nrow];
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            int offset = row_offset[ai];
+
+            for(int aj = 0; aj < row_nnz[ai]; ++aj)
+            {
+                col[offset + aj] = row_col[ai][aj];
+                val[offset + aj] = row_val[ai][aj];
+            }
+        }
+
+        free_host(&row_nnz);
+
+        for(int i = 0; i < nthreads; ++i)
+        {
+            for(size_t j = 0; j < block_col[i].size(); ++j)
+            {
+                free_host(&block_col[i][j]);
+                free_host(&block_val[i][j]);
+            }
+        }
+
+        this->Clear();
+        this->SetDataPtrCSR(&row_offset, &col, &val, nnz, nrow, ncol);
+
+        return true;
+    }
+
+    // Algorithm for IC(0) factorization is a row-oriented (up-looking) Cholesky, where
+    // each entry l_ij is computed by merging the sorted rows i and j of L. Rows that
+    // do not depend on each other are grouped into levels and factorized in parallel.
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ICFactorize(BaseVector<ValueType>* inv_diag)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        assert(inv_diag != NULL);
+        HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
+        assert(cast_diag != NULL);
+
+        cast_diag->Allocate(this->nrow_);
+
+        int nrow = this->nrow_;
+
+        int* level      = NULL;
+        int* level_ptr  = NULL;
+        int* level_rows = NULL;
+
+        allocate_host(nrow, &level);
+        allocate_host(nrow + 1, &level_ptr);
+        allocate_host(nrow, &level_rows);
+
+        set_to_zero_host(nrow + 1, level_ptr);
+
+        // Level of each row, row i depends on all rows j < i with l_ij != 0
+        int nlevel = 0;
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            int lvl = 0;
+
+            for(int aj = this->mat_.row_offset[ai]; aj < this->mat_.row_offset[ai + 1]; ++aj)
+            {
+                int col = this->mat_.col[aj];
+
+                if(col < ai)
+                {
+                    lvl = std::max(lvl, level[col] + 1);
+                }
+            }
+
+            level[ai] = lvl;
+            nlevel    = std::max(nlevel, lvl + 1);
+
+            ++level_ptr[lvl + 1];
+        }
+
+        // Bucket rows by level
+        for(int i = 0; i < nlevel; ++i)
+        {
+            level_ptr[i + 1] += level_ptr[i];
+        }
+
+        for(int ai = 0; ai < nrow; ++ai)
+        {
+            level_rows[level_ptr[level[ai]]++] = ai;
+        }
+
+        for(int i = nlevel; i > 0; --i)
+        {
+            level_ptr[i] = level_ptr[i - 1];
+        }
+
+        level_ptr[0] = 0;
+
+        free_host(&level);
+
+        bool breakdown = false;
+
+        _set_omp_backend_threads(this->local_backend_, nrow);
+
+        // Only run the levels in parallel if there is enough work per level
+#ifdef _OPENMP
+#pragma omp parallel reduction(|| : breakdown) if(nrow / nlevel >= 64)
+#endif
+        for(int lvl = 0; lvl < nlevel; ++lvl)
+        {
+#ifdef _OPENMP
+#pragma omp for
+#endif
+            for(int r = level_ptr[lvl]; r < level_ptr[lvl + 1]; ++r)
+            {
+                int ai        = level_rows[r];
+                int row_begin = this->mat_.row_offset[ai];
+                int row_diag  = this->mat_.row_offset[ai + 1] - 1;
+
+                assert(this->mat_.col[row_diag] == ai);
+
+                // Off-diagonal entries l_ij = (a_ij - sum_k l_ik * l_jk) / l_jj
+                for(int aj = row_begin; aj < row_diag; ++aj)
+                {
+                    int       col   = this->mat_.col[aj];
+                    int       k     = row_begin;
+                    int       l     = this->mat_.row_offset[col];
+                    int       ldiag = this->mat_.row_offset[col + 1] - 1;
+                    ValueType sum   = this->mat_.val[aj];
+
+                    while(k < aj && l < ldiag)
+                    {
+                        int col_k = this->mat_.col[k];
+                        int col_l = this->mat_.col[l];
+
+                        if(col_k < col_l)
+                        {
+                            ++k;
+                        }
+                        else if(col_k > col_l)
+                        {
+                            ++l;
+                        }
+                        else
+                        {
+                            sum -= this->mat_.val[k] * this->mat_.val[l];
+                            ++k;
+                            ++l;
+                        }
+                    }
+
+                    this->mat_.val[aj] = sum / this->mat_.val[ldiag];
+                }
+
+                // Diagonal entry l_ii = sqrt(a_ii - sum_k l_ik^2)
+                ValueType diag = this->mat_.val[row_diag];
+
+                for(int aj = row_begin; aj < row_diag; ++aj)
+                {
+                    diag -= this->mat_.val[aj] * this->mat_.val[aj];
+                }
+
+                if(diag > static_cast<ValueType>(0))
+                {
+                    this->mat_.val[row_diag] = sqrt(diag);
+                    cast_diag->vec_[ai]      = static_cast<ValueType>(1) / this->mat_.val[row_diag];
+                }
+                else
+                {
+                    breakdown = true;
+                }
+            }
+        }
+
+        free_host(&level_ptr);
+        free_host(&level_rows);
+
+        if(breakdown == true)
+        {
+            LOG_INFO("IC breakdown");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        return true;
+    }
+
+    // Algorithm for ICT factorization is a left-looking column Cholesky with linked
+    // lists for the column access, based on
+    // C.-J. Lin, J. J. More, Incomplete Cholesky factorizations with limited memory,
+    // SIAM J. Sci. Comput. 21 (1999)
+    template <typename ValueType>
+    bool HostMatrixCSR<ValueType>::ICTFactorize(double                 t,
+                                                int                    maxrow,
+                                                BaseVector<ValueType>* inv_diag)
+    {
+        assert(this->nrow_ == this->ncol_);
+        assert(this->nnz_ > 0);
+
+        assert(inv_diag != NULL);
+        HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
+        assert(cast_diag != NULL);
+
+        cast_diag->Allocate(this->nrow_);
+
+        int nrow = this->nrow_;
+
+        // Columns of L are stored row-wise (U = L^T), diagonal entry first
+        std::vector<int>       U_row_offset(nrow + 1);
+        std::vector<int>       U_col;
+        std::vector<ValueType> U_val;
+
+        U_col.reserve(this->nnz_);
+        U_val.reserve(this->nnz_);
+
+        // Position of the next entry to be used in each column, and the linked
+        // list of all columns whose next entry is in the current row
+        std::vector<int> first(nrow, -1);
+        std::vector<int> link(nrow, -1);
+        std::vector<int> head(nrow, -1);
+
+        // Working arrays
+        std::vector<ValueType> w(nrow, static_cast<ValueType>(0));
+        std::vector<bool>      nnz_pos(nrow, false);
+        std::vector<int>       nnz_entries;
+        std::vector<int>       keep;
+
+        U_row_offset[0] = 0;
+
+        for(int aj = 0; aj < nrow; ++aj)
+        {
+            int    row_begin = this->mat_.row_offset[aj];
+            int    row_end   = this->mat_.row_offset[aj + 1];
+            double row_norm  = 0.0;
+
+            nnz_entries.clear();
+
+            // Load upper part of aj-th row (equals aj-th column of the lower part)
+            for(int k = row_begin; k < row_end; ++k)
+            {
+                int col = this->mat_.col[k];
+
+                row_norm += std::abs(this->mat_.val[k]);
+
+                if(col >= aj)
+                {
+                    w[col] = this->mat_.val[k];
+
+                    if(nnz_pos[col] == false)
+                    {
+                        nnz_pos[col] = true;
+                        nnz_entries.push_back(col);
+                    }
+                }
             }
 
-            // fill ai-th row of preconditioner matrix
-            for(int k = 0, num_lower = 0, num_upper = 0; k < nrow; ++k)
+            // threshold for dropping strategy
+            double threshold = t * row_norm / (row_end - row_begin);
+
+            // Update with all previous columns that have an entry in row aj
+            int k = head[aj];
+            while(k != -1)
             {
-                int aj = nnz_entries[k];
+                int next = link[k];
+                int pos  = first[k];
 
-                if(aj == -1)
-                {
-                    break;
-                }
+                ValueType l_jk = U_val[pos];
 
-                if(nnz_pos[aj] == false)
+                for(int l = pos; l < U_row_offset[k + 1]; ++l)
                 {
-                    break;
+                    int idx = U_col[l];
+
+                    if(nnz_pos[idx] == false)
+                    {
+                        nnz_pos[idx] = true;
+                        nnz_entries.push_back(idx);
+                    }
+
+                    w[idx] -= l_jk * U_val[l];
                 }
 
-                // lower part
-                if(aj < ai && num_lower < maxrow)
+                // Move column k to the list of its next row
+                ++first[k];
+                if(first[k] < U_row_offset[k + 1])
                 {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+                    int row   = U_col[first[k]];
+                    link[k]   = head[row];
+                    head[row] = k;
+                }
 
-                    ++row_offset[ai + 1];
-                    ++num_lower;
-                    ++nnz;
+                k = next;
+            }
 
-                    // upper part
-                }
-                else if(aj > ai && num_upper < maxrow)
-                {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+            ValueType diag = w[aj];
 
-                    ++row_offset[ai + 1];
-                    ++num_upper;
-                    ++nnz;
+            if(!(diag > static_cast<ValueType>(0)))
+            {
+                LOG_INFO("ICT breakdown");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
 
-                    // diagonal part
-                }
-                else if(aj == ai)
-                {
-                    val[nnz] = w[aj];
-                    col[nnz] = aj;
+            diag = sqrt(diag);
 
-                    diag_offset[ai] = row_offset[ai + 1];
+            // Dropping strategy, keep the largest maxrow entries above the threshold
+            keep.clear();
+            for(size_t i = 0; i < nnz_entries.size(); ++i)
+            {
+                int idx = nnz_entries[i];
 
-                    ++row_offset[ai + 1];
-                    ++nnz;
+                if(idx != aj && std::abs(w[idx]) >= threshold)
+                {
+                    keep.push_back(idx);
                 }
-
-                // clear working arrays
-                w[aj]          = static_cast<ValueType>(0);
-                nnz_entries[k] = -1;
-                nnz_pos[aj]    = false;
             }
 
-            // resize preconditioner matrix if needed
-            if(alloc_size < nnz + 2 * maxrow + 1)
+            if(static_cast<int>(keep.size()) > maxrow)
             {
-                alloc_size += int(nnzA * 1.5);
-                col = (int*)realloc(col, alloc_size * sizeof(int));
-                val = (ValueType*)realloc(val, alloc_size * sizeof(ValueType));
+                std::nth_element(keep.begin(),
+                                 keep.begin() + maxrow,
+                                 keep.end(),
+                                 [&w](int a, int b) { return std::abs(w[a]) > std::abs(w[b]); });
+                keep.resize(maxrow);
             }
-        }
 
-        //  col = (int*) realloc(col, nnz*sizeof(int));
-        //  val = (ValueType*) realloc(val, nnz*sizeof(ValueType));
+            std::sort(keep.begin(), keep.end());
 
-        free_host(&w);
-        free_host(&diag_offset);
-        free_host(&nnz_entries);
-        free(nnz_pos);
+            // Store aj-th column of L
+            U_col.push_back(aj);
+            U_val.push_back(diag);
 
-        // pinned memory
-        int*       p_col = NULL;
-        ValueType* p_val = NULL;
+            for(size_t i = 0; i < keep.size(); ++i)
+            {
+                U_col.push_back(keep[i]);
+                U_val.push_back(w[keep[i]] / diag);
+            }
 
-        allocate_host(nnz, &p_col);
-        allocate_host(nnz, &p_val);
+            U_row_offset[aj + 1] = static_cast<int>(U_col.size());
 
-        for(int i = 0; i < nnz; ++i)
-        {
-            p_col[i] = col[i];
-            p_val[i] = val[i];
+            cast_diag->vec_[aj] = static_cast<ValueType>(1) / diag;
+
+            // Insert aj-th column into the list of its first off-diagonal row
+            if(keep.empty() == false)
+            {
+                first[aj]     = U_row_offset[aj] + 1;
+                link[aj]      = head[keep[0]];
+                head[keep[0]] = aj;
+            }
+
+            // clear working arrays
+            for(size_t i = 0; i < nnz_entries.size(); ++i)
+            {
+                w[nnz_entries[i]]       = static_cast<ValueType>(0);
+                nnz_pos[nnz_entries[i]] = false;
+            }
         }
 
-        free(col);
-        free(val);
+        // Transpose into lower triangular CSR, diagonal entry last
+        int nnz = U_row_offset[nrow];
 
-        this->Clear();
-        this->SetDataPtrCSR(&row_offset, &p_col, &p_val, nnz, nrow, ncol);
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
 
-        return true;
-    }
+        allocate_host(nrow + 1, &row_offset);
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
 
-    template <typename ValueType>
-    bool HostMatrixCSR<ValueType>::ICFactorize(BaseVector<ValueType>* inv_diag)
-    {
-        assert(this->nrow_ == this->ncol_);
-        assert(this->nnz_ > 0);
+        set_to_zero_host(nrow + 1, row_offset);
 
-        assert(inv_diag != NULL);
-        HostVector<ValueType>* cast_diag = dynamic_cast<HostVector<ValueType>*>(inv_diag);
-        assert(cast_diag != NULL);
+        for(int i = 0; i < nnz; ++i)
+        {
+            ++row_offset[U_col[i] + 1];
+        }
 
-        cast_diag->Allocate(this->nrow_);
+        for(int i = 0; i < nrow; ++i)
+        {
+            row_offset[i + 1] += row_offset[i];
+        }
 
-        // i=0,..n
-        for(int i = 0; i < this->nrow_; ++i)
+        for(int ai = 0; ai < nrow; ++ai)
         {
-            // j=0,..i
-            for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+            for(int aj = U_row_offset[ai]; aj < U_row_offset[ai + 1]; ++aj)
             {
-                // k=0,..j-1
-                for(int k = this->mat_.row_offset[i]; k < j; ++k)
-                {
-                    // loop through j-th row to find matching k
-                    for(int l = this->mat_.row_offset[this->mat_.col[j]];
-                        l < this->mat_.row_offset[this->mat_.col[j] + 1];
-                        ++l)
-                    {
-                        if(this->mat_.col[l] == this->mat_.col[k])
-                        {
-                            this->mat_.val[j] -= this->mat_.val[k] * this->mat_.val[l];
-                            break;
-                        }
-                    }
-                }
-
-                if(i > this->mat_.col[j])
-                {
-                    // Fill lower part
-                    this->mat_.val[j]
-                        /= this->mat_.val[this->mat_.row_offset[this->mat_.col[j] + 1] - 1];
-                }
-                else if(this->mat_.val[j] > static_cast<ValueType>(0))
-                {
-                    // Fill diagonal part
-                    this->mat_.val[j]  = sqrt(this->mat_.val[j]);
-                    cast_diag->vec_[i] = static_cast<ValueType>(1) / this->mat_.val[j];
-                }
-                else
-                {
-                    LOG_INFO("IC breakdown");
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+                int idx  = row_offset[U_col[aj]]++;
+                col[idx] = ai;
+                val[idx] = U_val[aj];
             }
         }
 
+        for(int i = nrow; i > 0; --i)
+        {
+            row_offset[i] = row_offset[i - 1];
+        }
+
+        row_offset[0] = 0;
+
+        this->Clear();
+        this->SetDataPtrCSR(&row_offset, &col, &val, nnz, nrow, nrow);
+
         return true;
     }
 
@@ -2551,13 +3470,17 @@ namespace rocalution
         int*       row_offset = NULL;
         int*       ind_diag   = NULL;
         int*       levels     = NULL;
+        char*      done       = NULL;
         ValueType* val        = NULL;
 
         allocate_host(cast_mat->nrow_ + 1, &row_offset);
         allocate_host(cast_mat->nrow_, &ind_diag);
         allocate_host(cast_mat->nnz_, &levels);
+        allocate_host(cast_mat->nrow_, &done);
         allocate_host(cast_mat->nnz_, &val);
 
+        set_to_zero_host(cast_mat->nrow_, done);
+
         int inf_level = 99999;
         int nnz       = 0;
 
@@ -2627,65 +3550,118 @@ namespace rocalution
             }
         }
 
-        // ai = 1 to N
-        for(int ai = 1; ai < cast_mat->nrow_; ++ai)
+        // The rows are distributed dynamically and in ascending order among the threads,
+        // each row waits only for the rows it is eliminated with
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
         {
-            // ak = 1 to ai-1
-            for(int ak = cast_mat->mat_.row_offset[ai]; ai > cast_mat->mat_.col[ak]; ++ak)
+            // position of each column in the current row
+            int* nnz_entries = NULL;
+            allocate_host(cast_mat->ncol_, &nnz_entries);
+
+            for(int i = 0; i < cast_mat->ncol_; ++i)
+            {
+                nnz_entries[i] = -1;
+            }
+
+            // Rows wait for the rows they depend on, so they are handed out in increasing
+            // order. Dynamic schedules are nonmonotonic by default since OpenMP 5.0.
+#if defined(_OPENMP) && _OPENMP >= 201511
+#pragma omp for schedule(monotonic : dynamic, 1)
+#elif defined(_OPENMP)
+#pragma omp for schedule(dynamic, 1)
+#endif
+            for(int ai = 0; ai < cast_mat->nrow_; ++ai)
             {
-                if(levels[ak] <= p)
+                int row_begin = cast_mat->mat_.row_offset[ai];
+                int row_end   = cast_mat->mat_.row_offset[ai + 1];
+
+                for(int aj = row_begin; aj < row_end; ++aj)
                 {
-                    val[ak] /= val[ind_diag[cast_mat->mat_.col[ak]]];
+                    nnz_entries[cast_mat->mat_.col[aj]] = aj;
+                }
 
-                    // aj = ak+1 to N
-                    for(int aj = ak + 1; aj < cast_mat->mat_.row_offset[ai + 1]; ++aj)
+                // ak = 1 to ai-1
+                for(int ak = row_begin; ak < row_end && ai > cast_mat->mat_.col[ak]; ++ak)
+                {
+                    if(levels[ak] <= p)
                     {
-                        ValueType val_kj   = static_cast<ValueType>(0);
-                        int       level_kj = inf_level;
+                        int row_k = cast_mat->mat_.col[ak];
 
-                        // find a_k,j
-                        for(int kj = cast_mat->mat_.row_offset[cast_mat->mat_.col[ak]];
-                            kj < cast_mat->mat_.row_offset[cast_mat->mat_.col[ak] + 1];
-                            ++kj)
+                        // wait until the row_k-th row has been factorized
+                        char ready = 0;
+                        while(ready == 0)
                         {
-                            if(cast_mat->mat_.col[aj] == cast_mat->mat_.col[kj])
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+                            ready = done[row_k];
+
+                            if(ready == 0)
                             {
-                                level_kj = levels[kj];
-                                val_kj   = val[kj];
-                                break;
+                                std::this_thread::yield();
                             }
                         }
+#ifdef _OPENMP
+#pragma omp flush
+#endif
 
-                        int lev = level_kj + levels[ak] + 1;
+                        val[ak] /= val[ind_diag[row_k]];
 
-                        if(levels[aj] > lev)
+                        // aj = ak+1 to N, for all a_k,j in the structure of the ai-th row
+                        for(int kj = ind_diag[row_k] + 1; kj < cast_mat->mat_.row_offset[row_k + 1];
+                            ++kj)
                         {
-                            levels[aj] = lev;
-                        }
+                            int aj = nnz_entries[cast_mat->mat_.col[kj]];
+
+                            if(aj != -1)
+                            {
+                                int lev = levels[kj] + levels[ak] + 1;
+
+                                if(levels[aj] > lev)
+                                {
+                                    levels[aj] = lev;
+                                }
 
-                        // a_i,j = a_i,j - a_i,k * a_k,j
-                        val[aj] -= val[ak] * val_kj;
+                                // a_i,j = a_i,j - a_i,k * a_k,j
+                                val[aj] -= val[ak] * val[kj];
+                            }
+                        }
                     }
                 }
-            }
 
-            for(int ak = cast_mat->mat_.row_offset[ai]; ak < cast_mat->mat_.row_offset[ai + 1];
-                ++ak)
-            {
-                if(levels[ak] > p)
-                {
-                    levels[ak] = inf_level;
-                    val[ak]    = static_cast<ValueType>(0);
-                }
-                else
+                int row_nnz = 0;
+
+                for(int ak = row_begin; ak < row_end; ++ak)
                 {
-                    ++row_offset[ai + 1];
+                    nnz_entries[cast_mat->mat_.col[ak]] = -1;
+
+                    if(levels[ak] > p)
+                    {
+                        levels[ak] = inf_level;
+                        val[ak]    = static_cast<ValueType>(0);
+                    }
+                    else
+                    {
+                        ++row_nnz;
+                    }
                 }
+
+                row_offset[ai + 1] = row_nnz;
+
+                // mark ai-th row as factorized
+#ifdef _OPENMP
+#pragma omp flush
+#pragma omp atomic write
+#endif
+                done[ai] = 1;
             }
+
+            free_host(&nnz_entries);
         }
 
-        row_offset[0] = this->mat_.row_offset[0];
-        row_offset[1] = this->mat_.row_offset[1];
+        row_offset[0] = 0;
 
         for(int i = 0; i < cast_mat->nrow_; ++i)
         {
@@ -2696,9 +3672,13 @@ namespace rocalution
 
         this->AllocateCSR(nnz, cast_mat->nrow_, cast_mat->ncol_);
 
-        int jj = 0;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
         for(int i = 0; i < cast_mat->nrow_; ++i)
         {
+            int jj = row_offset[i];
+
             for(int j = cast_mat->mat_.row_offset[i]; j < cast_mat->mat_.row_offset[i + 1]; ++j)
             {
                 if(levels[j] <= p)
@@ -2708,9 +3688,9 @@ namespace rocalution
                     ++jj;
                 }
             }
-        }
 
-        assert(jj == nnz);
+            assert(jj == row_offset[i + 1]);
+        }
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -2724,6 +3704,7 @@ namespace rocalution
         free_host(&ind_diag);
         free_host(&levels);
         free_host(&val);
+        free_host(&done);
 
         return true;
     }
@@ -3066,7 +4047,7 @@ namespace rocalution
     template <typename ValueType>
     bool HostMatrixCSR<ValueType>::DiagonalMatrixMultL(const BaseVector<ValueType>& diag)
     {
-        assert(diag.GetSize() == this->ncol_);
+        assert(diag.GetSize() == this->nrow_);
 
         const HostVector<ValueType>* cast_diag = dynamic_cast<const HostVector<ValueType>*>(&diag);
         assert(cast_diag != NULL);
@@ -3299,11 +4280,25 @@ namespace rocalution
             allocate_host<int>(this->nnz_, &col);
             allocate_host<ValueType>(this->nnz_, &val);
 
+            // Rows of large matrices that are moved far are prefetched for writing
+            int dist = (host_use_streaming<ValueType>(this->nnz_)
+                        && host_permutation_is_scattered(this->nrow_, cast_perm->vec_))
+                           ? HOST_PREFETCH_DISTANCE
+                           : 0;
+
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
             for(int i = 0; i < this->nrow_; ++i)
             {
+                if(dist > 0 && i + dist < this->nrow_)
+                {
+                    int next = perm_nnz[cast_perm->vec_[i + dist]];
+
+                    HOST_PREFETCH_WRITE(col + next);
+                    HOST_PREFETCH_WRITE(val + next);
+                }
+
                 int permIndex = perm_nnz[cast_perm->vec_[i]];
                 int prevIndex = this->mat_.row_offset[i];
 
@@ -4729,60 +5724,245 @@ namespace rocalution
                 int       c = this->mat_.col[j];
                 ValueType v = this->mat_.val[j];
 
-                if(!S_val[j] || connect[c] != 1)
+                if(!S_val[j] || connect[c] != 1)
+                {
+                    continue;
+                }
+
+                if(v > Amin[i] && v < Amax[i])
+                {
+                    continue;
+                }
+
+                cast_prolong->mat_.col[row_head] = cidx[c];
+                cast_prolong->mat_.val[row_head]
+                    = (v < static_cast<ValueType>(0) ? alpha : beta) * v;
+                ++row_head;
+            }
+        }
+
+        free_host(&connect);
+        free_host(&S_row_offset);
+        free_host(&S_col);
+        free_host(&S_val);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < cast_prolong->GetM(); ++i)
+        {
+            for(int j = cast_prolong->mat_.row_offset[i]; j < cast_prolong->mat_.row_offset[i + 1];
+                ++j)
+            {
+                for(int jj = cast_prolong->mat_.row_offset[i];
+                    jj < cast_prolong->mat_.row_offset[i + 1] - 1;
+                    ++jj)
+                {
+                    if(cast_prolong->mat_.col[jj] > cast_prolong->mat_.col[jj + 1])
+                    {
+                        // swap elements
+                        int       ind = cast_prolong->mat_.col[jj];
+                        ValueType val = cast_prolong->mat_.val[jj];
+
+                        cast_prolong->mat_.col[jj] = cast_prolong->mat_.col[jj + 1];
+                        cast_prolong->mat_.val[jj] = cast_prolong->mat_.val[jj + 1];
+
+                        cast_prolong->mat_.col[jj + 1] = ind;
+                        cast_prolong->mat_.val[jj + 1] = val;
+                    }
+                }
+            }
+        }
+
+        cast_restrict->CopyFrom(*cast_prolong);
+        cast_restrict->Transpose();
+
+        return true;
+    }
+
+    // Returns the strongest coupled neighbor of i among the nodes in [begin, end) that are in
+    // the given state, or -1. As in the sequential algorithms, tail_min and tail_max are the
+    // extreme offdiagonal entries from the first such neighbor onwards.
+    template <typename ValueType>
+    static int pairwise_candidate(int              i,
+                                  int              begin,
+                                  int              end,
+                                  const int*       row_offset,
+                                  const int*       col,
+                                  const ValueType* val,
+                                  bool             neg,
+                                  const int*       state,
+                                  int              free_state,
+                                  ValueType&       min_a_ij,
+                                  ValueType&       tail_min,
+                                  ValueType&       tail_max)
+    {
+        int min_j = -1;
+
+        for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+        {
+            int col_j = col[j];
+
+            if(col_j == i)
+            {
+                continue;
+            }
+
+            ValueType val_j = (neg == true) ? -val[j] : val[j];
+
+            if(min_j != -1)
+            {
+                tail_min = (val_j < tail_min) ? val_j : tail_min;
+                tail_max = (val_j > tail_max) ? val_j : tail_max;
+            }
+
+            if(col_j < begin || col_j >= end || state[col_j] != free_state)
+            {
+                continue;
+            }
+
+            if(min_j == -1)
+            {
+                tail_min = val_j;
+                tail_max = val_j;
+            }
+
+            if(min_j == -1 || val_j < min_a_ij)
+            {
+                min_a_ij = val_j;
+                min_j    = col_j;
+            }
+        }
+
+        return min_j;
+    }
+
+    // Matches the free nodes (state 0) of the graph. The rows are split into one block per
+    // thread, and each block is matched greedily in natural order, as the sequential
+    // algorithm does, considering couplings inside the block only. Remaining singletons are
+    // then paired across block boundaries. A pair is accepted if its coupling is below
+    // betam times the largest (initial) or smallest (further aggregation) offdiagonal entry
+    // from the first free neighbor onwards. On return, the formerly free nodes are in state 1
+    // and mate[i] holds the partner of each of them, or -1. The result depends on the number
+    // of blocks only; a single block reproduces the sequential algorithm.
+    template <typename ValueType>
+    static void pairwise_matching(int              n,
+                                  int              nblocks,
+                                  const int*       row_offset,
+                                  const int*       col,
+                                  const ValueType* val,
+                                  const int*       neg,
+                                  ValueType        betam,
+                                  bool             initial,
+                                  int*             state,
+                                  int*             mate)
+    {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int b = 0; b < nblocks; ++b)
+        {
+            int begin = static_cast<int>((static_cast<long long>(n) * b) / nblocks);
+            int end   = static_cast<int>((static_cast<long long>(n) * (b + 1)) / nblocks);
+
+            for(int i = begin; i < end; ++i)
+            {
+                if(state[i] != 0)
+                {
+                    continue;
+                }
+
+                ValueType min_a_ij;
+                ValueType tail_min;
+                ValueType tail_max;
+                int       j = pairwise_candidate(i,
+                                           begin,
+                                           end,
+                                           row_offset,
+                                           col,
+                                           val,
+                                           neg[i] != 0,
+                                           state,
+                                           0,
+                                           min_a_ij,
+                                           tail_min,
+                                           tail_max);
+
+                if(j != -1 && min_a_ij < betam * (initial == true ? tail_max : tail_min))
+                {
+                    mate[i]  = j;
+                    mate[j]  = i;
+                    state[i] = 1;
+                    state[j] = 1;
+                }
+                else
+                {
+                    // Singleton, for now
+                    mate[i]  = -1;
+                    state[i] = 2;
+                }
+            }
+        }
+
+        // Pair singletons across block boundaries
+        for(int b = 0; b < nblocks; ++b)
+        {
+            int begin = static_cast<int>((static_cast<long long>(n) * b) / nblocks);
+            int end   = static_cast<int>((static_cast<long long>(n) * (b + 1)) / nblocks);
+
+            for(int i = begin; i < end; ++i)
+            {
+                if(state[i] != 2)
                 {
                     continue;
                 }
 
-                if(v > Amin[i] && v < Amax[i])
+                state[i] = 1;
+
+                // Singletons below begin have been visited already
+                ValueType min_a_ij;
+                ValueType tail_min;
+                ValueType tail_max;
+                int       j = pairwise_candidate(i,
+                                           end,
+                                           n,
+                                           row_offset,
+                                           col,
+                                           val,
+                                           neg[i] != 0,
+                                           state,
+                                           2,
+                                           min_a_ij,
+                                           tail_min,
+                                           tail_max);
+
+                if(j != -1 && min_a_ij < betam * (initial == true ? tail_max : tail_min))
                 {
-                    continue;
+                    mate[i]  = j;
+                    mate[j]  = i;
+                    state[j] = 1;
                 }
-
-                cast_prolong->mat_.col[row_head] = cidx[c];
-                cast_prolong->mat_.val[row_head]
-                    = (v < static_cast<ValueType>(0) ? alpha : beta) * v;
-                ++row_head;
             }
         }
+    }
 
-        free_host(&connect);
-        free_host(&S_row_offset);
-        free_host(&S_col);
-        free_host(&S_val);
+    // Numbers the aggregates of a matching by their smallest member, root[c] holds the
+    // smallest member of aggregate c
+    static int pairwise_numbering(int n, const int* state, const int* mate, int* number, int* root)
+    {
+        int nc = 0;
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < cast_prolong->GetM(); ++i)
+        for(int i = 0; i < n; ++i)
         {
-            for(int j = cast_prolong->mat_.row_offset[i]; j < cast_prolong->mat_.row_offset[i + 1];
-                ++j)
+            if(state[i] == 1 && (mate[i] == -1 || i < mate[i]))
             {
-                for(int jj = cast_prolong->mat_.row_offset[i];
-                    jj < cast_prolong->mat_.row_offset[i + 1] - 1;
-                    ++jj)
-                {
-                    if(cast_prolong->mat_.col[jj] > cast_prolong->mat_.col[jj + 1])
-                    {
-                        // swap elements
-                        int       ind = cast_prolong->mat_.col[jj];
-                        ValueType val = cast_prolong->mat_.val[jj];
-
-                        cast_prolong->mat_.col[jj] = cast_prolong->mat_.col[jj + 1];
-                        cast_prolong->mat_.val[jj] = cast_prolong->mat_.val[jj + 1];
-
-                        cast_prolong->mat_.col[jj + 1] = ind;
-                        cast_prolong->mat_.val[jj + 1] = val;
-                    }
-                }
+                number[i] = nc;
+                root[nc]  = i;
+                ++nc;
             }
         }
 
-        cast_restrict->CopyFrom(*cast_prolong);
-        cast_restrict->Transpose();
-
-        return true;
+        return nc;
     }
 
     template <typename ValueType>
@@ -4810,7 +5990,12 @@ namespace rocalution
         int* ind_diag = NULL;
         allocate_host(this->nrow_, &ind_diag);
 
+        _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
         // Build U
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : Usize)
+#endif
         for(int i = 0; i < this->nrow_; ++i)
         {
             ValueType sum = static_cast<ValueType>(0);
@@ -4849,6 +6034,80 @@ namespace rocalution
         nc              = 0;
         ValueType betam = -beta;
 
+        // Parallel matching, if the nodes are visited in natural order
+        if(ordering == 0 && this->local_backend_.OpenMP_threads > 1)
+        {
+            int* state = NULL;
+            int* mate  = NULL;
+            int* neg   = NULL;
+            int* root  = NULL;
+
+            allocate_host(this->nrow_, &state);
+            allocate_host(this->nrow_, &mate);
+            allocate_host(this->nrow_, &neg);
+            allocate_host(this->nrow_, &root);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                state[i] = (cast_G->vec_[i] == -2) ? 0 : 1;
+                mate[i]  = -1;
+                neg[i]   = (this->mat_.val[ind_diag[i]] < static_cast<ValueType>(0)) ? 1 : 0;
+            }
+
+            pairwise_matching(this->nrow_,
+                              this->local_backend_.OpenMP_threads,
+                              this->mat_.row_offset,
+                              this->mat_.col,
+                              this->mat_.val,
+                              neg,
+                              betam,
+                              true,
+                              state,
+                              mate);
+
+            // Only nodes outside of U have been matched
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                state[i] = (cast_G->vec_[i] == -2) ? 1 : 0;
+            }
+
+            nc = pairwise_numbering(this->nrow_, state, mate, cast_G->vec_, root);
+
+            // Fill G and rG
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int k = 0; k < nc; ++k)
+            {
+                int i = root[k];
+                int j = mate[i];
+
+                (*rG)[k] = i;
+
+                if(j != -1)
+                {
+                    cast_G->vec_[j]   = k;
+                    (*rG)[rGsize + k] = j;
+                }
+            }
+
+            free_host(&state);
+            free_host(&mate);
+            free_host(&neg);
+            free_host(&root);
+            free_host(&ind_diag);
+
+            return true;
+        }
+
         // Ordering
         HostVector<int> perm(this->local_backend_);
 
@@ -5263,6 +6522,96 @@ namespace rocalution
         nc              = 0;
         ValueType betam = -beta;
 
+        // Parallel matching, if the nodes are visited in natural order
+        if(ordering == 0 && this->local_backend_.OpenMP_threads > 1)
+        {
+            int* mate   = NULL;
+            int* neg    = NULL;
+            int* root   = NULL;
+            int* number = NULL;
+
+            allocate_host(this->nrow_, &mate);
+            allocate_host(this->nrow_, &neg);
+            allocate_host(this->nrow_, &root);
+            allocate_host(this->nrow_, &number);
+
+            _set_omp_backend_threads(this->local_backend_, this->nrow_);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int i = 0; i < this->nrow_; ++i)
+            {
+                mate[i] = -1;
+                neg[i]  = 0;
+
+                // Get sign
+                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                {
+                    if(i == this->mat_.col[j])
+                    {
+                        neg[i] = (this->mat_.val[j] < static_cast<ValueType>(0)) ? 1 : 0;
+                        break;
+                    }
+                }
+            }
+
+            pairwise_matching(this->nrow_,
+                              this->local_backend_.OpenMP_threads,
+                              this->mat_.row_offset,
+                              this->mat_.col,
+                              this->mat_.val,
+                              neg,
+                              betam,
+                              false,
+                              U,
+                              mate);
+
+            nc = pairwise_numbering(this->nrow_, U, mate, number, root);
+
+            // Fill G and rG
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for(int k = 0; k < nc; ++k)
+            {
+                int i = root[k];
+                int j = mate[i];
+
+                for(int r = 0; r < Gsize / 2; ++r)
+                {
+                    rGc[r * rGsizec + k] = (*rG)[r * rGsize + i];
+
+                    if((*rG)[r * rGsize + i] >= 0)
+                    {
+                        cast_G->vec_[(*rG)[r * rGsize + i]] = k;
+                    }
+
+                    if(j != -1)
+                    {
+                        rGc[(r + Gsize / 2) * rGsizec + k] = (*rG)[r * rGsize + j];
+
+                        if((*rG)[r * rGsize + j] >= 0)
+                        {
+                            cast_G->vec_[(*rG)[r * rGsize + j]] = k;
+                        }
+                    }
+                }
+            }
+
+            free_host(&mate);
+            free_host(&neg);
+            free_host(&root);
+            free_host(&number);
+            free_host(&U);
+            free_host(rG);
+
+            (*rG)  = rGc;
+            rGsize = rGsizec;
+
+            return true;
+        }
+
         // Ordering
         HostVector<int> perm(this->local_backend_);
 
@@ -5690,183 +7039,227 @@ namespace rocalution
         assert(cast_Ac != NULL);
         assert(cast_G != NULL);
 
-        // Allocate
-        cast_Ac->Clear();
-
-        int*       row_offset = NULL;
-        int*       col        = NULL;
-        ValueType* val        = NULL;
-
-        allocate_host(nrow + 1, &row_offset);
-        allocate_host(this->nnz_, &col);
-        allocate_host(this->nnz_, &val);
-
         // Create P_ij: if i in G_j -> 1, else 0
         // (Ac)_kl = sum i in G_k (sum j in G_l (a_ij))) with k,l=1,...,nrow
+        // The coarse rows are assembled in parallel in two passes. Entries appear in the
+        // order of their first occurrence and are summed in the order of the fine entries,
+        // independent of the number of threads.
 
-        int* reverse_col = NULL;
-        int* Gl          = NULL;
-        int* erase       = NULL;
+        int* row_offset = NULL;
+        allocate_host(nrow + 1, &row_offset);
 
         int size = (nrow > ncol) ? nrow : ncol;
 
-        allocate_host(size, &reverse_col);
-        allocate_host(size, &Gl);
-        allocate_host(size, &erase);
+        _set_omp_backend_threads(this->local_backend_, nrow);
 
-        for(int i = 0; i < size; ++i)
+        // Count the entries of each coarse row
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
         {
-            reverse_col[i] = -1;
-        }
+            // Last coarse row that has touched column l
+            int* mark = NULL;
+            allocate_host(size, &mark);
 
-        set_to_zero_host(size, Gl);
+            for(int l = 0; l < size; ++l)
+            {
+                mark[l] = -1;
+            }
 
-        row_offset[0] = 0;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            for(int k = 0; k < nrow; ++k)
+            {
+                int row_nnz = 0;
+
+                for(int r = 0; r < Gsize; ++r)
+                {
+                    int i = rG[r * rGsize + k];
+
+                    if(i < 0)
+                    {
+                        continue;
+                    }
+
+                    for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                    {
+                        int l = cast_G->vec_[this->mat_.col[j]];
+
+                        if(l >= 0 && mark[l] != k)
+                        {
+                            mark[l] = k;
+                            ++row_nnz;
+                        }
+                    }
+                }
+
+                row_offset[k + 1] = row_nnz;
+            }
+
+            free_host(&mark);
+        }
 
+        // Exclusive sum
+        row_offset[0] = 0;
         for(int k = 0; k < nrow; ++k)
         {
-            row_offset[k + 1] = row_offset[k];
+            row_offset[k + 1] += row_offset[k];
+        }
+
+        int nnz = row_offset[nrow];
+
+        int*       col = NULL;
+        ValueType* val = NULL;
+
+        allocate_host(nnz, &col);
+        allocate_host(nnz, &val);
+
+        // Fill the coarse rows
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            // Last coarse row that has touched column l and position of its entry
+            int* mark        = NULL;
+            int* reverse_col = NULL;
 
-            int m = 0;
+            allocate_host(size, &mark);
+            allocate_host(size, &reverse_col);
 
-            for(int r = 0; r < Gsize; ++r)
+            for(int l = 0; l < size; ++l)
             {
-                int i = rG[r * rGsize + k];
+                mark[l] = -1;
+            }
 
-                if(i < 0)
-                {
-                    continue;
-                }
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1024)
+#endif
+            for(int k = 0; k < nrow; ++k)
+            {
+                int idx = row_offset[k];
 
-                for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
+                for(int r = 0; r < Gsize; ++r)
                 {
-                    int l = cast_G->vec_[this->mat_.col[j]];
+                    int i = rG[r * rGsize + k];
 
-                    if(l < 0)
+                    if(i < 0)
                     {
                         continue;
                     }
 
-                    if(Gl[l] == 0)
+                    for(int j = this->mat_.row_offset[i]; j < this->mat_.row_offset[i + 1]; ++j)
                     {
-                        Gl[l]      = 1;
-                        erase[m++] = l;
+                        int l = cast_G->vec_[this->mat_.col[j]];
 
-                        col[row_offset[k + 1]] = l;
-                        val[row_offset[k + 1]] = this->mat_.val[j];
-                        reverse_col[l]         = row_offset[k + 1];
+                        if(l < 0)
+                        {
+                            continue;
+                        }
 
-                        ++row_offset[k + 1];
-                    }
-                    else
-                    {
-                        val[reverse_col[l]] += this->mat_.val[j];
+                        if(mark[l] != k)
+                        {
+                            mark[l]        = k;
+                            reverse_col[l] = idx;
+
+                            col[idx] = l;
+                            val[idx] = this->mat_.val[j];
+
+                            ++idx;
+                        }
+                        else
+                        {
+                            val[reverse_col[l]] += this->mat_.val[j];
+                        }
                     }
                 }
             }
 
-            for(int j = 0; j < m; ++j)
-            {
-                Gl[erase[j]] = 0;
-            }
+            free_host(&mark);
+            free_host(&reverse_col);
         }
 
-        free_host(&reverse_col);
-        free_host(&Gl);
-        free_host(&erase);
+        // Allocate
+        cast_Ac->Clear();
+        cast_Ac->SetDataPtrCSR(&row_offset, &col, &val, nnz, nrow, nrow);
 
-        int nnz = row_offset[nrow];
+        return true;
+    }
 
-        int*       col_resized = NULL;
-        ValueType* val_resized = NULL;
+    // splitmix64 finalizer
+    static inline unsigned long long hash_mix(unsigned long long x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
 
-        allocate_host(nnz, &col_resized);
-        allocate_host(nnz, &val_resized);
+        return x;
+    }
 
-        // Resize
-        for(int i = 0; i < nnz; ++i)
-        {
-            col_resized[i] = col[i];
-            val_resized[i] = val[i];
-        }
+    // Hash of entry a at position i
+    static inline unsigned long long hash_entry(unsigned long long i, unsigned long long a)
+    {
+        return hash_mix(hash_mix(i + 0x9e3779b97f4a7c15ULL) ^ a);
+    }
 
-        free_host(&col);
-        free_host(&val);
+    // Bit pattern of a value
+    static inline unsigned long long hash_bits(double val)
+    {
+        unsigned long long bits;
+        memcpy(&bits, &val, sizeof(double));
 
-        // Allocate
-        cast_Ac->Clear();
-        cast_Ac->SetDataPtrCSR(&row_offset, &col_resized, &val_resized, nnz, nrow, nrow);
+        return bits;
+    }
 
-        return true;
+    static inline unsigned long long hash_bits(float val)
+    {
+        unsigned int bits;
+        memcpy(&bits, &val, sizeof(float));
+
+        return bits;
     }
 
     template <typename T>
-    int sgn(T val)
+    static inline unsigned long long hash_bits(const std::complex<T>& val)
     {
-        return (T(0) < val) - (val < T(0));
+        return hash_bits(val.real()) ^ hash_mix(hash_bits(val.imag()));
     }
 
+    // The keys are sums of position dependent entry hashes. Since the sum is associative,
+    // the keys are computed in parallel and do not depend on the number of threads.
     template <typename ValueType>
     bool
         HostMatrixCSR<ValueType>::Key(long int& row_key, long int& col_key, long int& val_key) const
     {
-        row_key = 0;
-        col_key = 0;
-        val_key = 0;
-
-        int row_sign = 1;
-        int col_sign = 1;
-        int val_sign = 1;
+        unsigned long long rkey = 0;
+        unsigned long long ckey = 0;
+        unsigned long long vkey = 0;
 
-        int row_tmp = 0x12345678;
-        int col_tmp = 0x23456789;
-        int val_tmp = 0x34567890;
+        _set_omp_backend_threads(this->local_backend_, this->nnz_);
 
-        int row_mask = 0x09876543;
-        int col_mask = 0x98765432;
-        int val_mask = 0x87654321;
-
-        for(int ai = 0; ai < this->nrow_; ++ai)
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : rkey)
+#endif
+        for(int ai = 0; ai < this->nrow_ + 1; ++ai)
         {
-            row_key += row_sign * row_tmp * (row_mask & this->mat_.row_offset[ai]);
-            row_key  = row_key ^ (row_key >> 16);
-            row_sign = sgn(row_tmp - (row_mask & this->mat_.row_offset[ai]));
-            row_tmp  = row_mask & this->mat_.row_offset[ai];
-
-            int row_beg = this->mat_.row_offset[ai];
-            int row_end = this->mat_.row_offset[ai + 1];
-
-            for(int aj = row_beg; aj < row_end; ++aj)
-            {
-                col_key += col_sign * col_tmp * (col_mask | this->mat_.col[aj]);
-                col_key  = col_key ^ (col_key >> 16);
-                col_sign = sgn(row_tmp - (col_mask | this->mat_.col[aj]));
-                col_tmp  = col_mask | this->mat_.col[aj];
-
-                double   double_val = std::abs(this->mat_.val[aj]);
-                long int val        = 0;
-
-                assert(sizeof(long int) == sizeof(double));
-
-                memcpy(&val, &double_val, sizeof(long int));
-
-                val_key += val_sign * val_tmp * (long int)(val_mask | val);
-                val_key = val_key ^ (val_key >> 16);
-
-                if(sgn(this->mat_.val[aj]) > 0)
-                {
-                    val_key = val_key ^ val;
-                }
-                else
-                {
-                    val_key = val_key | val;
-                }
+            rkey += hash_entry(ai, this->mat_.row_offset[ai]);
+        }
 
-                val_sign = sgn(val_tmp - (long int)(val_mask | val));
-                val_tmp  = val_mask | val;
-            }
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+ : ckey, vkey)
+#endif
+        for(int aj = 0; aj < this->nnz_; ++aj)
+        {
+            ckey += hash_entry(aj, this->mat_.col[aj]);
+            vkey += hash_entry(aj, hash_bits(this->mat_.val[aj]));
         }
 
+        row_key = static_cast<long int>(rkey);
+        col_key = static_cast<long int>(ckey);
+        val_key = static_cast<long int>(vkey);
+
         return true;
     }
 
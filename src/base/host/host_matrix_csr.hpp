@@ -110,6 +110,7 @@ namespace rocalution
 
         virtual void CopyFromCSR(const int* row_offsets, const int* col, const ValueType* val);
         virtual void CopyToCSR(int* row_offsets, int* col, ValueType* val) const;
+        virtual bool CopyPatternToCSR(int* row_offsets, int* col) const;
 
         virtual void CopyTo(BaseMatrix<ValueType>* mat) const;
 
@@ -128,6 +129,7 @@ namespace rocalution
             CreateFromMap(const BaseVector<int>& map, int n, int m, BaseMatrix<ValueType>* pro);
 
         virtual bool ICFactorize(BaseVector<ValueType>* inv_diag);
+        virtual bool ICTFactorize(double t, int maxrow, BaseVector<ValueType>* inv_diag);
 
         virtual bool ILU0Factorize(void);
         virtual bool ILUpFactorizeNumeric(int p, const BaseMatrix<ValueType>& mat);
@@ -152,12 +154,40 @@ namespace rocalution
         virtual void UAnalyseClear(void);
         virtual bool USolve(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
 
+        virtual bool SSORSolve(ValueType                    omega,
+                               int                          nblocks,
+                               const BaseVector<ValueType>& in,
+                               BaseVector<ValueType>*       out) const;
+        virtual bool ComponentAveragingSplit(int                    nblocks,
+                                             BaseMatrix<ValueType>* split,
+                                             BaseMatrix<ValueType>* average) const;
+        virtual bool KaczmarzSweep(ValueType                    omega,
+                                   int                          nblocks,
+                                   const BaseVector<ValueType>& rhs,
+                                   BaseVector<ValueType>*       x) const;
+
         virtual bool Gershgorin(ValueType& lambda_min, ValueType& lambda_max) const;
 
         virtual void Apply(const BaseVector<ValueType>& in, BaseVector<ValueType>* out) const;
         virtual void ApplyAdd(const BaseVector<ValueType>& in,
                               ValueType                    scalar,
                               BaseVector<ValueType>*       out) const;
+        virtual bool Residual(const BaseVector<ValueType>& b,
+                              const BaseVector<ValueType>& x,
+                              BaseVector<ValueType>*       res) const;
+        virtual bool ResidualRestrict(const BaseMatrix<ValueType>& restriction,
+                                      const BaseVector<ValueType>& b,
+                                      const BaseVector<ValueType>& x,
+                                      BaseVector<ValueType>*       coarse,
+                                      bool                         unique_cols) const;
+        virtual bool ApplyAddSubMatrix(int                          row_offset,
+                                       int                          col_offset,
+                                       int                          row_size,
+                                       int                          col_size,
+                                       const BaseVector<ValueType>& in,
+                                       ValueType                    scalar,
+                                       BaseVector<ValueType>*       out) const;
+        virtual bool SupportsApplyAddSubMatrix(void) const;
 
         virtual bool Compress(double drop_off);
         virtual bool Transpose(void);
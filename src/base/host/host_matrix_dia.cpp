@@ -27,6 +27,7 @@
 #include "../../utils/log.hpp"
 #include "../matrix_formats_ind.hpp"
 #include "host_conversion.hpp"
+#include "host_kernels_dia.hpp"
 #include "host_matrix_csr.hpp"
 #include "host_vector.hpp"
 
@@ -292,44 +293,14 @@ namespace rocalution
 
             _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->nrow_; ++i)
-            {
-                ValueType sum = static_cast<ValueType>(0);
-
-                for(int j = 0; j < this->mat_.num_diag; ++j)
-                {
-                    int start    = 0;
-                    int end      = this->nrow_;
-                    int v_offset = 0;
-                    int offset   = this->mat_.offset[j];
-
-                    if(offset < 0)
-                    {
-                        start -= offset;
-                        v_offset = -start;
-                    }
-                    else
-                    {
-                        end -= offset;
-                        v_offset = offset;
-                    }
-
-                    if((i >= start) && (i < end))
-                    {
-                        sum += this->mat_.val[DIA_IND(i, j, this->nrow_, this->mat_.num_diag)]
-                               * cast_in->vec_[i + v_offset];
-                    }
-                    else if(i >= end)
-                    {
-                        break;
-                    }
-                }
-
-                cast_out->vec_[i] = sum;
-            }
+            host_dia_spmv(this->nrow_,
+                          this->mat_.num_diag,
+                          this->mat_.offset,
+                          this->mat_.val,
+                          static_cast<ValueType>(1),
+                          cast_in->vec_,
+                          cast_out->vec_,
+                          false);
         }
     }
 
@@ -353,42 +324,14 @@ namespace rocalution
 
             _set_omp_backend_threads(this->local_backend_, this->nrow_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->nrow_; ++i)
-            {
-                for(int j = 0; j < this->mat_.num_diag; ++j)
-                {
-                    int start    = 0;
-                    int end      = this->nrow_;
-                    int v_offset = 0;
-                    int offset   = this->mat_.offset[j];
-
-                    if(offset < 0)
-                    {
-                        start -= offset;
-                        v_offset = -start;
-                    }
-                    else
-                    {
-                        end -= offset;
-                        v_offset = offset;
-                    }
-
-                    if((i >= start) && (i < end))
-                    {
-                        cast_out->vec_[i]
-                            += scalar
-                               * this->mat_.val[DIA_IND(i, j, this->nrow_, this->mat_.num_diag)]
-                               * cast_in->vec_[i + v_offset];
-                    }
-                    else if(i >= end)
-                    {
-                        break;
-                    }
-                }
-            }
+            host_dia_spmv(this->nrow_,
+                          this->mat_.num_diag,
+                          this->mat_.offset,
+                          this->mat_.val,
+                          scalar,
+                          cast_in->vec_,
+                          cast_out->vec_,
+                          true);
         }
     }
 
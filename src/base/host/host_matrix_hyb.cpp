@@ -27,6 +27,7 @@
 #include "../../utils/log.hpp"
 #include "../matrix_formats_ind.hpp"
 #include "host_conversion.hpp"
+#include "host_kernels_coo.hpp"
 #include "host_matrix_csr.hpp"
 #include "host_vector.hpp"
 
@@ -325,14 +326,16 @@ namespace rocalution
                 }
             }
 
-            // COO
+            // COO, the part is split off the CSR rows in order and thus sorted by row
             if(this->coo_nnz_ > 0)
             {
-                for(int i = 0; i < this->coo_nnz_; ++i)
-                {
-                    cast_out->vec_[this->mat_.COO.row[i]]
-                        += this->mat_.COO.val[i] * cast_in->vec_[this->mat_.COO.col[i]];
-                }
+                host_coo_spmv(this->coo_nnz_,
+                              this->mat_.COO.row,
+                              this->mat_.COO.col,
+                              this->mat_.COO.val,
+                              static_cast<ValueType>(1),
+                              cast_in->vec_,
+                              cast_out->vec_);
             }
         }
     }
@@ -381,11 +384,13 @@ namespace rocalution
             // COO
             if(this->coo_nnz_ > 0)
             {
-                for(int i = 0; i < this->coo_nnz_; ++i)
-                {
-                    cast_out->vec_[this->mat_.COO.row[i]]
-                        += scalar * this->mat_.COO.val[i] * cast_in->vec_[this->mat_.COO.col[i]];
-                }
+                host_coo_spmv(this->coo_nnz_,
+                              this->mat_.COO.row,
+                              this->mat_.COO.col,
+                              this->mat_.COO.val,
+                              scalar,
+                              cast_in->vec_,
+                              cast_out->vec_);
             }
         }
     }
@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "host_tasks.hpp"
+#include "../../utils/def.hpp"
+#include "../backend_manager.hpp"
+
+#include <assert.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Thread budget of the host task the calling thread belongs to, or what is left to a
+    // thread that launched host tasks
+    static thread_local int host_task_threads = 0;
+
+    HostTaskGroup::HostTaskGroup()
+    {
+        this->caller_threads_ = 0;
+        this->task_threads_   = 0;
+    }
+
+    HostTaskGroup::~HostTaskGroup()
+    {
+        this->Wait();
+    }
+
+    void HostTaskGroup::Launch(std::function<void(void)> task, int threads)
+    {
+        assert(task);
+
+        if(threads < 1)
+        {
+            threads = 1;
+        }
+
+        if(this->tasks_.empty() == true)
+        {
+            this->caller_threads_ = host_task_threads;
+            this->task_threads_   = 0;
+        }
+
+        // The calling thread keeps the remaining budget, at least one thread
+        int total = (this->caller_threads_ > 0) ? this->caller_threads_
+                                                : _get_backend_descriptor()->OpenMP_threads;
+
+        this->task_threads_ += threads;
+        host_task_threads = (total - this->task_threads_ > 1) ? total - this->task_threads_ : 1;
+
+        this->tasks_.push_back(std::thread([task, threads](void) {
+            // The thread budget only applies to the parallel regions of this task. The host
+            // kernels reset the number of threads from the backend descriptor, which is
+            // limited to the budget in _set_omp_backend_threads()
+            host_task_threads = threads;
+#ifdef _OPENMP
+            omp_set_num_threads(threads);
+#endif
+            task();
+        }));
+    }
+
+    void HostTaskGroup::Wait(void)
+    {
+        if(this->tasks_.empty() == true)
+        {
+            return;
+        }
+
+        for(size_t i = 0; i < this->tasks_.size(); ++i)
+        {
+            this->tasks_[i].join();
+        }
+
+        this->tasks_.clear();
+
+        // The calling thread gets its budget back
+        host_task_threads = this->caller_threads_;
+    }
+
+    bool HostTaskGroup::Pending(void) const
+    {
+        return !this->tasks_.empty();
+    }
+
+    int _get_host_task_threads(void)
+    {
+        return host_task_threads;
+    }
+
+} // namespace rocalution
@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#ifndef ROCALUTION_HOST_HOST_TASKS_HPP_
+#define ROCALUTION_HOST_HOST_TASKS_HPP_
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace rocalution
+{
+
+    // Group of asynchronous tasks on the host. Each task runs in its own thread with a
+    // budget of OpenMP threads, such that independent setup steps can overlap with each
+    // other and with the calling thread. The calling thread gives up the budgets of its
+    // tasks, until Wait() joins the group. Wait() has to be called by the launching thread.
+    class HostTaskGroup
+    {
+    public:
+        HostTaskGroup();
+        ~HostTaskGroup();
+
+        // Launch task with threads OpenMP threads
+        void Launch(std::function<void(void)> task, int threads);
+        // Wait for all launched tasks to finish
+        void Wait(void);
+        // Returns true, if tasks have been launched and not joined yet
+        bool Pending(void) const;
+
+    private:
+        std::vector<std::thread> tasks_;
+
+        // Budget of the launching thread before the first launch
+        int caller_threads_;
+        // Sum of the budgets of the launched tasks
+        int task_threads_;
+    };
+
+    // Returns the OpenMP thread budget of the calling thread, 0 if it is unrestricted
+    int _get_host_task_threads(void);
+
+} // namespace rocalution
+
+#endif // ROCALUTION_HOST_HOST_TASKS_HPP_
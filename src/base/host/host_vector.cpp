@@ -27,6 +27,9 @@
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 #include "../base_vector.hpp"
+#include "host_kernels_blas1.hpp"
+#include "host_kernels_copy.hpp"
+#include "host_kernels_reduce.hpp"
 #include "version.hpp"
 
 #include <complex>
@@ -49,6 +52,12 @@
 namespace rocalution
 {
 
+    // Reductions are bitwise reproducible, see set_omp_reproducible_rocalution()
+    static inline bool reproducible_reductions(void)
+    {
+        return _get_backend_descriptor()->OpenMP_reproducible;
+    }
+
     template <typename ValueType>
     HostVector<ValueType>::HostVector()
     {
@@ -150,6 +159,7 @@ namespace rocalution
     void HostVector<ValueType>::LeaveDataPtr(ValueType** ptr)
     {
         assert(this->size_ > 0);
+        assert(this->view_ == false);
 
         // see free_host function for details
         *ptr       = this->vec_;
@@ -158,6 +168,27 @@ namespace rocalution
         this->size_ = 0;
     }
 
+    template <typename ValueType>
+    void HostVector<ValueType>::SetView(BaseVector<ValueType>& src, int offset, int size)
+    {
+        HostVector<ValueType>* cast_src = dynamic_cast<HostVector<ValueType>*>(&src);
+
+        assert(cast_src != NULL);
+        assert(cast_src != this);
+        assert(offset >= 0);
+        assert(size >= 0);
+        assert(offset + size <= cast_src->size_);
+
+        this->Clear();
+
+        if(size > 0)
+        {
+            this->vec_  = cast_src->vec_ + offset;
+            this->size_ = size;
+            this->view_ = true;
+        }
+    }
+
     template <typename ValueType>
     void HostVector<ValueType>::CopyFromData(const ValueType* data)
     {
@@ -165,13 +196,7 @@ namespace rocalution
         {
             _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                this->vec_[i] = data[i];
-            }
+            host_copy(this->size_, data, this->vec_);
         }
     }
 
@@ -182,13 +207,7 @@ namespace rocalution
         {
             _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-            for(int i = 0; i < this->size_; ++i)
-            {
-                data[i] = this->vec_[i];
-            }
+            host_copy(this->size_, this->vec_, data);
         }
     }
 
@@ -197,10 +216,21 @@ namespace rocalution
     {
         if(this->size_ > 0)
         {
-            free_host(&this->vec_);
+            // Views do not own their data
+            if(this->view_ == true)
+            {
+                this->vec_ = NULL;
+            }
+            else
+            {
+                free_host(&this->vec_);
+            }
+
             this->size_ = 0;
         }
 
+        this->view_ = false;
+
         if(this->index_size_ > 0)
         {
             free_host(&this->index_array_);
@@ -235,13 +265,7 @@ namespace rocalution
 
                 _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-                for(int i = 0; i < this->size_; ++i)
-                {
-                    this->vec_[i] = cast_vec->vec_[i];
-                }
+                host_copy(this->size_, cast_vec->vec_, this->vec_);
 
 #ifdef _OPENMP
 #pragma omp parallel for
@@ -651,15 +675,14 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
+        ValueType*       y = this->vec_;
+        const ValueType* v = cast_x->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = this->vec_[i] + alpha * cast_x->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_addscale(end - begin, alpha, v + begin, y + begin);
+        });
     }
 
     template <typename ValueType>
@@ -670,15 +693,14 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
+        ValueType*       y = this->vec_;
+        const ValueType* v = cast_x->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = alpha * this->vec_[i] + cast_x->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_scaleadd(end - begin, alpha, v + begin, y + begin);
+        });
     }
 
     template <typename ValueType>
@@ -691,15 +713,14 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
+        ValueType*       y = this->vec_;
+        const ValueType* v = cast_x->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = alpha * this->vec_[i] + beta * cast_x->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_scaleaddscale(end - begin, alpha, v + begin, beta, y + begin);
+        });
     }
 
     template <typename ValueType>
@@ -719,16 +740,14 @@ namespace rocalution
         assert(src_offset + size <= cast_x->size_);
         assert(dst_offset + size <= this->size_);
 
+        ValueType*       y = this->vec_ + dst_offset;
+        const ValueType* v = cast_x->vec_ + src_offset;
+
         _set_omp_backend_threads(this->local_backend_, size);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < size; ++i)
-        {
-            this->vec_[i + dst_offset]
-                = alpha * this->vec_[i + dst_offset] + beta * cast_x->vec_[i + src_offset];
-        }
+        host_parallel_range(size, [=](int begin, int end) {
+            host_scaleaddscale(end - begin, alpha, v + begin, beta, y + begin);
+        });
     }
 
     template <typename ValueType>
@@ -746,30 +765,26 @@ namespace rocalution
         assert(this->size_ == cast_x->size_);
         assert(this->size_ == cast_y->size_);
 
+        ValueType*       out = this->vec_;
+        const ValueType* v   = cast_x->vec_;
+        const ValueType* w   = cast_y->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i]
-                = alpha * this->vec_[i] + beta * cast_x->vec_[i] + gamma * cast_y->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_scaleadd2(end - begin, alpha, v + begin, beta, w + begin, gamma, out + begin);
+        });
     }
 
     template <typename ValueType>
     void HostVector<ValueType>::Scale(ValueType alpha)
     {
+        ValueType* y = this->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] *= alpha;
-        }
+        host_parallel_range(this->size_,
+                            [=](int begin, int end) { host_scale(end - begin, alpha, y + begin); });
     }
 
     template <typename ValueType>
@@ -780,19 +795,13 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        ValueType dot = static_cast<ValueType>(0);
+        const ValueType* v = this->vec_;
+        const ValueType* w = cast_x->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot += this->vec_[i] * cast_x->vec_[i];
-        }
-
-        return dot;
+        return host_reduce<ValueType>(
+            this->size_, [v, w](int i) { return v[i] * w[i]; }, reproducible_reductions());
     }
 
     template <>
@@ -805,23 +814,18 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        float dot_real = 0.0f;
-        float dot_imag = 0.0f;
+        const std::complex<float>* v = this->vec_;
+        const std::complex<float>* w = cast_x->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        + this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        - this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
-
-        return std::complex<float>(dot_real, dot_imag);
+        return host_reduce<std::complex<float>>(
+            this->size_,
+            [v, w](int i) {
+                return std::complex<float>(v[i].real() * w[i].real() + v[i].imag() * w[i].imag(),
+                                           v[i].real() * w[i].imag() - v[i].imag() * w[i].real());
+            },
+            reproducible_reductions());
     }
 
     template <>
@@ -834,23 +838,18 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        double dot_real = 0.0;
-        double dot_imag = 0.0;
+        const std::complex<double>* v = this->vec_;
+        const std::complex<double>* w = cast_x->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        + this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        - this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
-
-        return std::complex<double>(dot_real, dot_imag);
+        return host_reduce<std::complex<double>>(
+            this->size_,
+            [v, w](int i) {
+                return std::complex<double>(v[i].real() * w[i].real() + v[i].imag() * w[i].imag(),
+                                            v[i].real() * w[i].imag() - v[i].imag() * w[i].real());
+            },
+            reproducible_reductions());
     }
 
     template <typename ValueType>
@@ -869,23 +868,18 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        float dot_real = 0.0f;
-        float dot_imag = 0.0f;
+        const std::complex<float>* v = this->vec_;
+        const std::complex<float>* w = cast_x->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        - this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        + this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
-
-        return std::complex<float>(dot_real, dot_imag);
+        return host_reduce<std::complex<float>>(
+            this->size_,
+            [v, w](int i) {
+                return std::complex<float>(v[i].real() * w[i].real() - v[i].imag() * w[i].imag(),
+                                           v[i].real() * w[i].imag() + v[i].imag() * w[i].real());
+            },
+            reproducible_reductions());
     }
 
     template <>
@@ -898,81 +892,59 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
-        double dot_real = 0.0;
-        double dot_imag = 0.0;
+        const std::complex<double>* v = this->vec_;
+        const std::complex<double>* w = cast_x->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : dot_real, dot_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            dot_real += this->vec_[i].real() * cast_x->vec_[i].real()
-                        - this->vec_[i].imag() * cast_x->vec_[i].imag();
-            dot_imag += this->vec_[i].real() * cast_x->vec_[i].imag()
-                        + this->vec_[i].imag() * cast_x->vec_[i].real();
-        }
-
-        return std::complex<double>(dot_real, dot_imag);
+        return host_reduce<std::complex<double>>(
+            this->size_,
+            [v, w](int i) {
+                return std::complex<double>(v[i].real() * w[i].real() - v[i].imag() * w[i].imag(),
+                                            v[i].real() * w[i].imag() + v[i].imag() * w[i].real());
+            },
+            reproducible_reductions());
     }
 
     template <typename ValueType>
     ValueType HostVector<ValueType>::Asum(void) const
     {
-        ValueType asum = static_cast<ValueType>(0);
+        const ValueType* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum += std::abs(this->vec_[i]);
-        }
-
-        return asum;
+        return host_reduce<ValueType>(
+            this->size_, [v](int i) { return std::abs(v[i]); }, reproducible_reductions());
     }
 
     template <>
     std::complex<float> HostVector<std::complex<float>>::Asum(void) const
     {
-        float asum_real = 0.0f;
-        float asum_imag = 0.0f;
+        const std::complex<float>* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum_real, asum_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum_real += std::abs(this->vec_[i].real());
-            asum_imag += std::abs(this->vec_[i].imag());
-        }
-
-        return std::complex<float>(asum_real, asum_imag);
+        return host_reduce<std::complex<float>>(
+            this->size_,
+            [v](int i) {
+                return std::complex<float>(std::abs(v[i].real()), std::abs(v[i].imag()));
+            },
+            reproducible_reductions());
     }
 
     template <>
     std::complex<double> HostVector<std::complex<double>>::Asum(void) const
     {
-        double asum_real = 0.0;
-        double asum_imag = 0.0;
+        const std::complex<double>* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : asum_real, asum_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            asum_real += std::abs(this->vec_[i].real());
-            asum_imag += std::abs(this->vec_[i].imag());
-        }
-
-        return std::complex<double>(asum_real, asum_imag);
+        return host_reduce<std::complex<double>>(
+            this->size_,
+            [v](int i) {
+                return std::complex<double>(std::abs(v[i].real()), std::abs(v[i].imag()));
+            },
+            reproducible_reductions());
     }
 
     template <typename ValueType>
@@ -984,20 +956,35 @@ namespace rocalution
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-        for(int i = 0; i < this->size_; ++i)
         {
-            ValueType val = std::abs(this->vec_[i]);
-            if(val > value)
+            int       thread_index = 0;
+            ValueType thread_value = static_cast<ValueType>(0);
+
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+            for(int i = 0; i < this->size_; ++i)
+            {
+                ValueType val = std::abs(this->vec_[i]);
+
+                if(val > thread_value)
+                {
+                    thread_value = val;
+                    thread_index = i;
+                }
+            }
+
 #ifdef _OPENMP
 #pragma omp critical
 #endif
             {
-                if(val > value)
+                // Keep the first index of the maximum, independent of the scheduling
+                if((thread_value > value) || ((thread_value == value) && (thread_index < index)))
                 {
-                    value = val;
-                    index = i;
+                    value = thread_value;
+                    index = thread_index;
                 }
             }
         }
@@ -1008,17 +995,12 @@ namespace rocalution
     template <typename ValueType>
     ValueType HostVector<ValueType>::Norm(void) const
     {
-        ValueType norm2 = static_cast<ValueType>(0);
+        const ValueType* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i] * this->vec_[i];
-        }
+        ValueType norm2 = host_reduce<ValueType>(
+            this->size_, [v](int i) { return v[i] * v[i]; }, reproducible_reductions());
 
         return sqrt(norm2);
     }
@@ -1026,20 +1008,16 @@ namespace rocalution
     template <>
     std::complex<float> HostVector<std::complex<float>>::Norm(void) const
     {
-        float norm2 = 0.0f;
+        const std::complex<float>* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i].real() * this->vec_[i].real()
-                     + this->vec_[i].imag() * this->vec_[i].imag();
-        }
+        float norm2 = host_reduce<float>(
+            this->size_,
+            [v](int i) { return v[i].real() * v[i].real() + v[i].imag() * v[i].imag(); },
+            reproducible_reductions());
 
-        std::complex<float> res(sqrt(norm2), 0.0f);
+        std::complex<float> res(sqrt(norm2), static_cast<float>(0));
 
         return res;
     }
@@ -1047,20 +1025,16 @@ namespace rocalution
     template <>
     std::complex<double> HostVector<std::complex<double>>::Norm(void) const
     {
-        double norm2 = 0.0;
+        const std::complex<double>* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : norm2)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            norm2 += this->vec_[i].real() * this->vec_[i].real()
-                     + this->vec_[i].imag() * this->vec_[i].imag();
-        }
+        double norm2 = host_reduce<double>(
+            this->size_,
+            [v](int i) { return v[i].real() * v[i].real() + v[i].imag() * v[i].imag(); },
+            reproducible_reductions());
 
-        std::complex<double> res(sqrt(norm2), 0.0);
+        std::complex<double> res(sqrt(norm2), static_cast<double>(0));
 
         return res;
     }
@@ -1075,59 +1049,12 @@ namespace rocalution
     template <typename ValueType>
     ValueType HostVector<ValueType>::Reduce(void) const
     {
-        ValueType reduce = static_cast<ValueType>(0);
+        const ValueType* v = this->vec_;
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce += this->vec_[i];
-        }
-
-        return reduce;
-    }
-
-    template <>
-    std::complex<float> HostVector<std::complex<float>>::Reduce(void) const
-    {
-        float reduce_real = 0.0f;
-        float reduce_imag = 0.0f;
-
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce_real, reduce_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce_real += this->vec_[i].real();
-            reduce_imag += this->vec_[i].imag();
-        }
-
-        return std::complex<float>(reduce_real, reduce_imag);
-    }
-
-    template <>
-    std::complex<double> HostVector<std::complex<double>>::Reduce(void) const
-    {
-        double reduce_real = 0.0;
-        double reduce_imag = 0.0;
-
-        _set_omp_backend_threads(this->local_backend_, this->size_);
-
-#ifdef _OPENMP
-#pragma omp parallel for reduction(+ : reduce_real, reduce_imag)
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            reduce_real += this->vec_[i].real();
-            reduce_imag += this->vec_[i].imag();
-        }
-
-        return std::complex<double>(reduce_real, reduce_imag);
+        return host_reduce<ValueType>(
+            this->size_, [v](int i) { return v[i]; }, reproducible_reductions());
     }
 
     template <typename ValueType>
@@ -1138,15 +1065,14 @@ namespace rocalution
         assert(cast_x != NULL);
         assert(this->size_ == cast_x->size_);
 
+        ValueType*       y = this->vec_;
+        const ValueType* v = cast_x->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = this->vec_[i] * cast_x->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_pointwisemult(end - begin, v + begin, y + begin, y + begin);
+        });
     }
 
     template <typename ValueType>
@@ -1161,15 +1087,15 @@ namespace rocalution
         assert(this->size_ == cast_x->size_);
         assert(this->size_ == cast_y->size_);
 
+        ValueType*       out = this->vec_;
+        const ValueType* v   = cast_x->vec_;
+        const ValueType* w   = cast_y->vec_;
+
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = cast_y->vec_[i] * cast_x->vec_[i];
-        }
+        host_parallel_range(this->size_, [=](int begin, int end) {
+            host_pointwisemult(end - begin, v + begin, w + begin, out + begin);
+        });
     }
 
     template <typename ValueType>
@@ -1191,13 +1117,7 @@ namespace rocalution
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < size; ++i)
-        {
-            this->vec_[i + dst_offset] = cast_src->vec_[i + src_offset];
-        }
+        host_copy(size, cast_src->vec_ + src_offset, this->vec_ + dst_offset);
     }
 
     template <typename ValueType>
@@ -1266,13 +1186,7 @@ namespace rocalution
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[cast_perm->vec_[i]] = cast_vec->vec_[i];
-        }
+        host_scatter(this->size_, cast_perm->vec_, cast_vec->vec_, this->vec_);
     }
 
     template <typename ValueType>
@@ -1291,13 +1205,7 @@ namespace rocalution
 
         _set_omp_backend_threads(this->local_backend_, this->size_);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-        for(int i = 0; i < this->size_; ++i)
-        {
-            this->vec_[i] = cast_vec->vec_[cast_perm->vec_[i]];
-        }
+        host_gather(this->size_, cast_perm->vec_, cast_vec->vec_, this->vec_);
     }
 
     template <typename ValueType>
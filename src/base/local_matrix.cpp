@@ -26,6 +26,8 @@
 #include "../utils/def.hpp"
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
+#include "../utils/pattern_cache.hpp"
+#include "../utils/time_functions.hpp"
 #include "backend_manager.hpp"
 #include "base_matrix.hpp"
 #include "base_vector.hpp"
@@ -35,9 +37,11 @@
 #include "local_vector.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <complex>
 #include <sstream>
 #include <string.h>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -46,6 +50,66 @@
 namespace rocalution
 {
 
+    // Key of the sparsity pattern, made of the matrix sizes and the row and column keys
+    template <typename ValueType>
+    static std::vector<long int> pattern_key(const LocalMatrix<ValueType>& mat)
+    {
+        long int row_key;
+        long int col_key;
+        long int val_key;
+
+        mat.Key(row_key, col_key, val_key);
+
+        return std::vector<long int>{mat.GetM(), mat.GetN(), mat.GetNnz(), row_key, col_key};
+    }
+
+    // Row offsets followed by the column indices of a host CSR matrix, which tell patterns
+    // with the same pattern key apart. The values are not read
+    template <typename ValueType>
+    static std::vector<int> pattern_of(const BaseMatrix<ValueType>& mat)
+    {
+        int nrow = mat.GetM();
+        int nnz  = mat.GetNnz();
+
+        std::vector<int> pattern(nrow + 1 + nnz);
+
+        if(mat.CopyPatternToCSR(pattern.data(), pattern.data() + nrow + 1) == false)
+        {
+            LOG_INFO("Reading the sparsity pattern failed");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        return pattern;
+    }
+
+    // Multicoloring of a sparsity pattern
+    struct ColoringData
+    {
+        int              num_colors;
+        std::vector<int> size_colors;
+        std::vector<int> permutation;
+    };
+
+    // Sparsity pattern in CSR format
+    struct PatternData
+    {
+        std::vector<int> row_offset;
+        std::vector<int> col;
+    };
+
+    // Format decisions, ILU(p) level patterns and colorings of previously seen sparsity
+    // patterns. They are shared by all value types and cleared by stop_rocalution()
+    static PatternCache<unsigned int> format_cache(32 * 1024 * 1024);
+    static PatternCache<PatternData>  level_pattern_cache(64 * 1024 * 1024);
+    static PatternCache<ColoringData> coloring_cache(64 * 1024 * 1024);
+
+    void _rocalution_clear_pattern_caches(void)
+    {
+        format_cache.Clear();
+        level_pattern_cache.Clear();
+        coloring_cache.Clear();
+    }
+
     template <typename ValueType>
     LocalMatrix<ValueType>::LocalMatrix()
     {
@@ -1653,6 +1717,282 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    unsigned int LocalMatrix<ValueType>::AutotuneFormat(bool benchmark)
+    {
+        log_debug(this, "LocalMatrix::AutotuneFormat()", benchmark);
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() == 0)
+        {
+            return this->GetFormat();
+        }
+
+        int nrow = this->GetM();
+        int ncol = this->GetN();
+        int nnz  = this->GetNnz();
+
+        // Structure analysis is performed on the host CSR pattern, the matrix is only
+        // copied if it is not in host CSR format already
+        LocalMatrix<ValueType>        mat_host;
+        const LocalMatrix<ValueType>* mat_csr = this;
+
+        if((this->is_host_() == false) || (this->GetFormat() != CSR))
+        {
+            mat_host.ConvertTo(this->GetFormat());
+            mat_host.CopyFrom(*this);
+            mat_host.ConvertToCSR();
+
+            mat_csr = &mat_host;
+        }
+
+        std::vector<int> pattern = pattern_of(*mat_csr->matrix_);
+
+        // Previous decisions, keyed by the sparsity pattern
+        std::vector<long int> key;
+
+        if(format_cache.Fits(pattern.size()) == true)
+        {
+            key = pattern_key(*mat_csr);
+
+            key.push_back(benchmark);
+            key.push_back(this->is_accel_());
+            key.push_back(sizeof(ValueType));
+        }
+
+        mat_host.Clear();
+
+        unsigned int cached_format;
+
+        if((key.empty() == false) && (format_cache.Find(key, pattern, &cached_format) == true))
+        {
+            LOG_VERBOSE_INFO(3,
+                             "*** info: LocalMatrix::AutotuneFormat() using cached format "
+                                 << _matrix_format_names[cached_format]);
+
+            this->ConvertTo(cached_format);
+
+            return this->GetFormat();
+        }
+
+        const int* row_offset = pattern.data();
+        const int* col        = pattern.data() + nrow + 1;
+
+        // Row length statistics
+        int    max_row = 0;
+        double sum_sq  = 0.0;
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            int row_nnz = row_offset[i + 1] - row_offset[i];
+
+            max_row = std::max(max_row, row_nnz);
+            sum_sq += static_cast<double>(row_nnz) * row_nnz;
+        }
+
+        double mean_row = static_cast<double>(nnz) / nrow;
+        double var_row  = std::max(sum_sq / nrow - mean_row * mean_row, 0.0);
+        double cv_row   = std::sqrt(var_row) / mean_row;
+
+        // Number of occupied diagonals
+        int               num_diag = 0;
+        std::vector<bool> diag(nrow + ncol, false);
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+            {
+                int idx = col[j] - i + nrow;
+
+                if(diag[idx] == false)
+                {
+                    diag[idx] = true;
+                    ++num_diag;
+                }
+            }
+        }
+
+        // Largest block dimension with little fill-in
+        int block_dim = 1;
+
+        for(int b = 2; b <= 4; ++b)
+        {
+            if((nrow % b != 0) || (ncol % b != 0))
+            {
+                continue;
+            }
+
+            int              nblocks = 0;
+            std::vector<int> block_row(ncol / b, -1);
+
+            for(int i = 0; i < nrow; ++i)
+            {
+                for(int j = row_offset[i]; j < row_offset[i + 1]; ++j)
+                {
+                    int bj = col[j] / b;
+
+                    if(block_row[bj] != i / b)
+                    {
+                        block_row[bj] = i / b;
+                        ++nblocks;
+                    }
+                }
+            }
+
+            if(nblocks * b * b <= 1.25 * nnz)
+            {
+                block_dim = b;
+            }
+        }
+
+        double dia_fill = static_cast<double>(num_diag) * nrow / nnz;
+        double ell_fill = static_cast<double>(max_row) * nrow / nnz;
+        double density  = static_cast<double>(nnz) / nrow / ncol;
+
+        LOG_VERBOSE_INFO(3,
+                         "*** info: LocalMatrix::AutotuneFormat() max row nnz="
+                             << max_row << " mean row nnz=" << mean_row
+                             << " row nnz variation=" << cv_row << " diagonals=" << num_diag
+                             << " block dim=" << block_dim);
+
+        // Candidate formats
+        // BCSR is not a candidate, since there is no host conversion to BCSR
+        std::vector<unsigned int> candidates;
+
+        candidates.push_back(CSR);
+
+        if(nrow == ncol)
+        {
+            candidates.push_back(MCSR);
+        }
+
+        if((nrow == ncol) && (dia_fill <= 3.0))
+        {
+            candidates.push_back(DIA);
+        }
+
+        if(ell_fill <= 3.0)
+        {
+            candidates.push_back(ELL);
+        }
+
+        if(ell_fill > 1.5)
+        {
+            candidates.push_back(HYB);
+        }
+
+        if(max_row > 8 * mean_row)
+        {
+            candidates.push_back(COO);
+        }
+
+        if((density >= 0.1) && (static_cast<double>(nrow) * ncol <= 16777216.0))
+        {
+            candidates.push_back(DENSE);
+        }
+
+        unsigned int format = CSR;
+
+        if(benchmark == true)
+        {
+            LocalVector<ValueType> x;
+            LocalVector<ValueType> y;
+
+            x.CloneBackend(*this);
+            y.CloneBackend(*this);
+
+            x.Allocate("x", ncol);
+            y.Allocate("y", nrow);
+
+            x.Ones();
+
+            int    reps      = std::max(1, std::min(10, 50000000 / nnz));
+            double best_time = 0.0;
+
+            for(unsigned int k = 0; k < candidates.size(); ++k)
+            {
+                LocalMatrix<ValueType> mat;
+                mat.CloneFrom(*this);
+                mat.ConvertTo(candidates[k]);
+
+                // Skip formats the conversion fell back from
+                if(mat.GetFormat() != candidates[k])
+                {
+                    continue;
+                }
+
+                // Warm up
+                mat.Apply(x, &y);
+
+                double time = rocalution_time();
+
+                for(int r = 0; r < reps; ++r)
+                {
+                    mat.Apply(x, &y);
+                }
+
+                time = (rocalution_time() - time) / reps;
+
+                LOG_VERBOSE_INFO(4,
+                                 "*** info: LocalMatrix::AutotuneFormat() "
+                                     << _matrix_format_names[candidates[k]] << " SpMV " << time
+                                     << " usec");
+
+                if((k == 0) || (time < best_time))
+                {
+                    best_time = time;
+                    format    = candidates[k];
+                }
+            }
+        }
+        else
+        {
+            bool is_candidate[8] = {false};
+
+            for(unsigned int k = 0; k < candidates.size(); ++k)
+            {
+                is_candidate[candidates[k]] = true;
+            }
+
+            if((is_candidate[DIA] == true) && (dia_fill <= 1.5))
+            {
+                format = DIA;
+            }
+            else if((is_candidate[DENSE] == true) && (density >= 0.5))
+            {
+                format = DENSE;
+            }
+            else if(this->is_accel_() == true)
+            {
+                // Padded formats pay off on accelerators
+                if((is_candidate[ELL] == true) && (ell_fill <= 1.5))
+                {
+                    format = ELL;
+                }
+                else if((is_candidate[HYB] == true) && (cv_row > 1.0))
+                {
+                    format = HYB;
+                }
+            }
+        }
+
+        if(key.empty() == false)
+        {
+            format_cache.Insert(key, pattern, format, sizeof(format));
+        }
+
+        LOG_VERBOSE_INFO(3,
+                         "*** info: LocalMatrix::AutotuneFormat() selected "
+                             << _matrix_format_names[format]);
+
+        this->ConvertTo(format);
+
+        return this->GetFormat();
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::Apply(const LocalVector<ValueType>& in,
                                        LocalVector<ValueType>*       out) const
@@ -1707,16 +2047,14 @@ namespace rocalution
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    void LocalMatrix<ValueType>::Residual(const LocalVector<ValueType>& b,
+                                          const LocalVector<ValueType>& x,
+                                          LocalVector<ValueType>*       res) const
     {
-        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
-
-        assert(vec_diag != NULL);
+        log_debug(this, "LocalMatrix::Residual()", (const void*&)b, (const void*&)x, res);
 
-        assert(
-            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
-            || ((this->matrix_ == this->matrix_accel_)
-                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+        assert(res != NULL);
+        assert(&x != res);
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -1724,64 +2062,275 @@ namespace rocalution
 
         if(this->GetNnz() > 0)
         {
-            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
-            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+            assert(b.GetSize() == this->GetM());
+            assert(x.GetSize() == this->GetN());
+            assert(res->GetSize() == this->GetM());
 
-            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+            assert(((this->matrix_ == this->matrix_host_) && (b.vector_ == b.vector_host_)
+                    && (x.vector_ == x.vector_host_) && (res->vector_ == res->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_) && (b.vector_ == b.vector_accel_)
+                       && (x.vector_ == x.vector_accel_)
+                       && (res->vector_ == res->vector_accel_)));
 
-            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            if(this->matrix_->Residual(*b.vector_, *x.vector_, res->vector_) == false)
             {
-                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
-                this->Info();
-                FATAL_ERROR(__FILE__, __LINE__);
+                this->matrix_->Apply(*x.vector_, res->vector_);
+                res->ScaleAdd(static_cast<ValueType>(-1), b);
             }
+        }
+        else
+        {
+            res->CopyFrom(b);
+        }
+    }
 
-            if(err == false)
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ResidualRestrict(const LocalMatrix<ValueType>& restriction,
+                                                  const LocalVector<ValueType>& b,
+                                                  const LocalVector<ValueType>& x,
+                                                  LocalVector<ValueType>*       res,
+                                                  LocalVector<ValueType>*       coarse,
+                                                  bool                          unique_cols) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ResidualRestrict()",
+                  (const void*&)restriction,
+                  (const void*&)b,
+                  (const void*&)x,
+                  res,
+                  coarse,
+                  unique_cols);
+
+        assert(res != NULL);
+        assert(coarse != NULL);
+        assert(restriction.GetN() == this->GetM());
+
+        if(this->GetNnz() > 0 && restriction.GetNnz() > 0)
+        {
+            assert(coarse->GetSize() == restriction.GetM());
+
+            assert(((this->matrix_ == this->matrix_host_)
+                    && (restriction.matrix_ == restriction.matrix_host_)
+                    && (coarse->vector_ == coarse->vector_host_))
+                   || ((this->matrix_ == this->matrix_accel_)
+                       && (restriction.matrix_ == restriction.matrix_accel_)
+                       && (coarse->vector_ == coarse->vector_accel_)));
+
+            if(this->matrix_->ResidualRestrict(
+                   *restriction.matrix_, *b.vector_, *x.vector_, coarse->vector_, unique_cols)
+               == true)
             {
-                LocalMatrix<ValueType> mat_host;
-                mat_host.ConvertTo(this->GetFormat());
-                mat_host.CopyFrom(*this);
+                return;
+            }
+        }
 
-                vec_diag->MoveToHost();
+        this->Residual(b, x, res);
+        restriction.Apply(*res, coarse);
+    }
 
-                mat_host.ConvertToCSR();
+    template <typename ValueType>
+    bool LocalMatrix<ValueType>::HasUniqueColumns(void) const
+    {
+        log_debug(this, "LocalMatrix::HasUniqueColumns()");
 
-                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
-                {
-                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
-                    this->Info();
-                    FATAL_ERROR(__FILE__, __LINE__);
-                }
+        if(this->GetFormat() != CSR)
+        {
+            return false;
+        }
 
-                if(this->GetFormat() != CSR)
-                {
-                    LOG_VERBOSE_INFO(
-                        2,
-                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
-                }
+        if(this->GetNnz() > this->GetN())
+        {
+            return false;
+        }
 
-                if(this->is_accel_() == true)
-                {
-                    LOG_VERBOSE_INFO(
-                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+        int nrow = this->GetM();
+        int nnz  = this->GetNnz();
 
-                    vec_diag->MoveToAccelerator();
-                }
+        std::vector<int>       pattern(nrow + 1 + nnz);
+        std::vector<ValueType> val(nnz);
+        std::vector<bool>      used(this->GetN(), false);
+
+        this->CopyToCSR(pattern.data(), pattern.data() + nrow + 1, val.data());
+
+        for(int j = 0; j < nnz; ++j)
+        {
+            int col = pattern[nrow + 1 + j];
+
+            if(used[col] == true)
+            {
+                return false;
             }
+
+            used[col] = true;
         }
+
+        return true;
     }
 
     template <typename ValueType>
-    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    void LocalMatrix<ValueType>::ApplySubMatrix(int                           row_offset,
+                                                int                           col_offset,
+                                                int                           row_size,
+                                                int                           col_size,
+                                                const LocalVector<ValueType>& in,
+                                                LocalVector<ValueType>*       out) const
     {
-        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
+        log_debug(this,
+                  "LocalMatrix::ApplySubMatrix()",
+                  row_offset,
+                  col_offset,
+                  row_size,
+                  col_size,
+                  (const void*&)in,
+                  out);
 
-        assert(vec_inv_diag != NULL);
+        assert(out != NULL);
 
-        assert(((this->matrix_ == this->matrix_host_)
-                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
-               || ((this->matrix_ == this->matrix_accel_)
-                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
+        out->Zeros();
+
+        this->ApplyAddSubMatrix(
+            row_offset, col_offset, row_size, col_size, in, static_cast<ValueType>(1), out);
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ApplyAddSubMatrix(int                           row_offset,
+                                                   int                           col_offset,
+                                                   int                           row_size,
+                                                   int                           col_size,
+                                                   const LocalVector<ValueType>& in,
+                                                   ValueType                     scalar,
+                                                   LocalVector<ValueType>*       out) const
+    {
+        log_debug(this,
+                  "LocalMatrix::ApplyAddSubMatrix()",
+                  row_offset,
+                  col_offset,
+                  row_size,
+                  col_size,
+                  (const void*&)in,
+                  scalar,
+                  out);
+
+        assert(out != NULL);
+        assert(&in != out);
+        assert(row_offset >= 0);
+        assert(col_offset >= 0);
+        assert(static_cast<IndexType2>(row_offset + row_size) <= this->GetM());
+        assert(static_cast<IndexType2>(col_offset + col_size) <= this->GetN());
+        assert(in.GetSize() == col_size);
+        assert(out->GetSize() == row_size);
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0 && row_size > 0 && col_size > 0)
+        {
+            if(this->matrix_->ApplyAddSubMatrix(
+                   row_offset, col_offset, row_size, col_size, *in.vector_, scalar, out->vector_)
+               == false)
+            {
+                // Fall back to the extracted sub-matrix
+                LocalMatrix<ValueType> sub;
+                sub.CloneBackend(*this);
+
+                this->ExtractSubMatrix(row_offset, col_offset, row_size, col_size, &sub);
+                sub.ApplyAdd(in, scalar, out);
+
+                LOG_VERBOSE_INFO(2,
+                                 "*** warning: LocalMatrix::ApplyAddSubMatrix() is performed on "
+                                 "the extracted sub-matrix");
+            }
+        }
+    }
+
+    template <typename ValueType>
+    bool LocalMatrix<ValueType>::SupportsApplySubMatrix(void) const
+    {
+        return this->matrix_->SupportsApplyAddSubMatrix();
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractDiagonal(LocalVector<ValueType>* vec_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractDiagonal()", vec_diag);
+
+        assert(vec_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (vec_diag->vector_ == vec_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (vec_diag->vector_ == vec_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            std::string vec_diag_name = "Diagonal elements of " + this->object_name_;
+            vec_diag->Allocate(vec_diag_name, std::min(this->GetLocalM(), this->GetLocalN()));
+
+            bool err = this->matrix_->ExtractDiagonal(vec_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat());
+                mat_host.CopyFrom(*this);
+
+                vec_diag->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ExtractDiagonal(vec_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ExtractDiagonal() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2,
+                        "*** warning: LocalMatrix::ExtractDiagonal() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ExtractDiagonal() is performed on the host");
+
+                    vec_diag->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ExtractInverseDiagonal(LocalVector<ValueType>* vec_inv_diag) const
+    {
+        log_debug(this, "LocalMatrix::ExtractInverseDiagonal()", vec_inv_diag);
+
+        assert(vec_inv_diag != NULL);
+
+        assert(((this->matrix_ == this->matrix_host_)
+                && (vec_inv_diag->vector_ == vec_inv_diag->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (vec_inv_diag->vector_ == vec_inv_diag->vector_accel_)));
 
 #ifdef DEBUG_MODE
         this->Check();
@@ -2621,6 +3170,231 @@ namespace rocalution
         }
     }
 
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::SSORSolve(ValueType                     omega,
+                                           int                           nblocks,
+                                           const LocalVector<ValueType>& in,
+                                           LocalVector<ValueType>*       out) const
+    {
+        log_debug(this, "LocalMatrix::SSORSolve()", omega, nblocks, (const void*&)in, out);
+
+        assert(nblocks > 0);
+        assert(out != NULL);
+        assert(in.GetSize() == this->GetN());
+        assert(out->GetSize() == this->GetM());
+
+        assert(((this->matrix_ == this->matrix_host_) && (in.vector_ == in.vector_host_)
+                && (out->vector_ == out->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (in.vector_ == in.vector_accel_)
+                   && (out->vector_ == out->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->SSORSolve(omega, nblocks, *in.vector_, out->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::SSORSolve() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat());
+                mat_host.CopyFrom(*this);
+
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(in);
+
+                out->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->SSORSolve(omega, nblocks, *vec_host.vector_, out->vector_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::SSORSolve() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::SSORSolve() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::SSORSolve() is performed on the host");
+
+                    out->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ComponentAveragingSplit(int                     nblocks,
+                                                         LocalMatrix<ValueType>* split,
+                                                         LocalMatrix<ValueType>* average) const
+    {
+        log_debug(this, "LocalMatrix::ComponentAveragingSplit()", nblocks, split, average);
+
+        assert(nblocks > 0);
+        assert(split != NULL);
+        assert(average != NULL);
+        assert(this != split);
+        assert(this != average);
+
+        assert(((this->matrix_ == this->matrix_host_) && (split->matrix_ == split->matrix_host_)
+                && (average->matrix_ == average->matrix_host_))
+               || ((this->matrix_ == this->matrix_accel_)
+                   && (split->matrix_ == split->matrix_accel_)
+                   && (average->matrix_ == average->matrix_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err
+                = this->matrix_->ComponentAveragingSplit(nblocks, split->matrix_, average->matrix_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ComponentAveragingSplit() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat());
+                mat_host.CopyFrom(*this);
+
+                split->MoveToHost();
+                average->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->ComponentAveragingSplit(
+                       nblocks, split->matrix_, average->matrix_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ComponentAveragingSplit() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ComponentAveragingSplit() is "
+                                     "performed in CSR format");
+
+                    split->ConvertTo(this->GetFormat());
+                    average->ConvertTo(this->GetFormat());
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(2,
+                                     "*** warning: LocalMatrix::ComponentAveragingSplit() is "
+                                     "performed on the host");
+
+                    split->MoveToAccelerator();
+                    average->MoveToAccelerator();
+                }
+            }
+        }
+
+#ifdef DEBUG_MODE
+        split->Check();
+        average->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::KaczmarzSweep(ValueType                     omega,
+                                               int                           nblocks,
+                                               const LocalVector<ValueType>& rhs,
+                                               LocalVector<ValueType>*       x) const
+    {
+        log_debug(this, "LocalMatrix::KaczmarzSweep()", omega, nblocks, (const void*&)rhs, x);
+
+        assert(nblocks > 0);
+        assert(x != NULL);
+        assert(rhs.GetSize() == this->GetM());
+        assert(x->GetSize() == this->GetN());
+
+        assert(((this->matrix_ == this->matrix_host_) && (rhs.vector_ == rhs.vector_host_)
+                && (x->vector_ == x->vector_host_))
+               || ((this->matrix_ == this->matrix_accel_) && (rhs.vector_ == rhs.vector_accel_)
+                   && (x->vector_ == x->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->KaczmarzSweep(omega, nblocks, *rhs.vector_, x->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::KaczmarzSweep() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                LocalMatrix<ValueType> mat_host;
+                mat_host.ConvertTo(this->GetFormat());
+                mat_host.CopyFrom(*this);
+
+                LocalVector<ValueType> vec_host;
+                vec_host.CopyFrom(rhs);
+
+                x->MoveToHost();
+
+                mat_host.ConvertToCSR();
+
+                if(mat_host.matrix_->KaczmarzSweep(omega, nblocks, *vec_host.vector_, x->vector_)
+                   == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::KaczmarzSweep() failed");
+                    mat_host.Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(this->GetFormat() != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::KaczmarzSweep() is performed in CSR format");
+                }
+
+                if(this->is_accel_() == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::KaczmarzSweep() is performed on the host");
+
+                    x->MoveToAccelerator();
+                }
+            }
+        }
+    }
+
     template <typename ValueType>
     void LocalMatrix<ValueType>::ILU0Factorize(void)
     {
@@ -2767,8 +3541,59 @@ namespace rocalution
                 if(level == true)
                 {
                     LocalMatrix structure;
-                    structure.CloneFrom(*this);
-                    structure.SymbolicPower(p + 1);
+
+                    // The level pattern only depends on the sparsity pattern and p and is
+                    // reused, only its row offsets and columns are used by the factorization
+                    std::vector<long int> key;
+                    std::vector<int>      this_pattern;
+                    PatternData           pattern;
+
+                    if((this->is_host_() == true) && (this->GetFormat() == CSR)
+                       && (level_pattern_cache.Fits(this->GetM() + 1 + this->GetNnz()) == true))
+                    {
+                        key = pattern_key(*this);
+                        key.push_back(p);
+
+                        this_pattern = pattern_of(*this->matrix_);
+                    }
+
+                    if((key.empty() == false)
+                       && (level_pattern_cache.Find(key, this_pattern, &pattern) == true))
+                    {
+                        LOG_VERBOSE_INFO(
+                            4, "*** info: LocalMatrix::ILUpFactorize() reusing level pattern");
+
+                        int nnz = static_cast<int>(pattern.col.size());
+
+                        std::vector<ValueType> val(nnz, static_cast<ValueType>(0));
+
+                        structure.AllocateCSR(
+                            "ILU(p) level pattern", nnz, this->GetM(), this->GetN());
+                        structure.CopyFromCSR(
+                            pattern.row_offset.data(), pattern.col.data(), val.data());
+                    }
+                    else
+                    {
+                        structure.CloneFrom(*this);
+                        structure.SymbolicPower(p + 1);
+
+                        if(key.empty() == false)
+                        {
+                            pattern.row_offset.resize(structure.GetM() + 1);
+                            pattern.col.resize(structure.GetNnz());
+
+                            std::vector<ValueType> val(structure.GetNnz());
+
+                            structure.CopyToCSR(
+                                pattern.row_offset.data(), pattern.col.data(), val.data());
+
+                            level_pattern_cache.Insert(
+                                key,
+                                this_pattern,
+                                pattern,
+                                (pattern.row_offset.size() + pattern.col.size()) * sizeof(int));
+                        }
+                    }
 
                     bool err = this->matrix_->ILUpFactorizeNumeric(p, *structure.matrix_);
 
@@ -2944,6 +3769,80 @@ namespace rocalution
             }
         }
 
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+    }
+
+    template <typename ValueType>
+    void LocalMatrix<ValueType>::ICTFactorize(double                  t,
+                                              int                     maxrow,
+                                              LocalVector<ValueType>* inv_diag)
+    {
+        log_debug(this, "LocalMatrix::ICTFactorize()", t, maxrow, inv_diag);
+
+        assert(maxrow > 0);
+        assert(t > 0.0);
+
+        assert(inv_diag != NULL);
+
+        assert(
+            ((this->matrix_ == this->matrix_host_) && (inv_diag->vector_ == inv_diag->vector_host_))
+            || ((this->matrix_ == this->matrix_accel_)
+                && (inv_diag->vector_ == inv_diag->vector_accel_)));
+
+#ifdef DEBUG_MODE
+        this->Check();
+#endif
+
+        if(this->GetNnz() > 0)
+        {
+            bool err = this->matrix_->ICTFactorize(t, maxrow, inv_diag->vector_);
+
+            if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
+            {
+                LOG_INFO("Computation of LocalMatrix::ICTFactorize() failed");
+                this->Info();
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(err == false)
+            {
+                // Move to host
+                bool is_accel = this->is_accel_();
+                this->MoveToHost();
+                inv_diag->MoveToHost();
+
+                // Convert to CSR
+                unsigned int format = this->GetFormat();
+                this->ConvertToCSR();
+
+                if(this->matrix_->ICTFactorize(t, maxrow, inv_diag->vector_) == false)
+                {
+                    LOG_INFO("Computation of LocalMatrix::ICTFactorize() failed");
+                    this->Info();
+                    FATAL_ERROR(__FILE__, __LINE__);
+                }
+
+                if(format != CSR)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ICTFactorize() is performed in CSR format");
+
+                    this->ConvertTo(format);
+                }
+
+                if(is_accel == true)
+                {
+                    LOG_VERBOSE_INFO(
+                        2, "*** warning: LocalMatrix::ICTFactorize() is performed on the host");
+
+                    this->MoveToAccelerator();
+                    inv_diag->MoveToAccelerator();
+                }
+            }
+        }
+
 #ifdef DEBUG_MODE
         this->Check();
 #endif
@@ -2975,6 +3874,36 @@ namespace rocalution
             permutation->Allocate(vec_perm_name, 0);
             permutation->CloneBackend(*this);
 
+            // Colorings only depend on the sparsity pattern and are reused
+            std::vector<long int> key;
+            std::vector<int>      pattern;
+
+            if((this->is_host_() == true) && (this->GetFormat() == CSR)
+               && (coloring_cache.Fits(this->GetM() + 1 + this->GetNnz()) == true))
+            {
+                key     = pattern_key(*this);
+                pattern = pattern_of(*this->matrix_);
+
+                ColoringData coloring;
+
+                if(coloring_cache.Find(key, pattern, &coloring) == true)
+                {
+                    LOG_VERBOSE_INFO(4, "*** info: LocalMatrix::MultiColoring() reusing coloring");
+
+                    num_colors = coloring.num_colors;
+
+                    allocate_host(num_colors, size_colors);
+                    std::copy(coloring.size_colors.begin(),
+                              coloring.size_colors.end(),
+                              *size_colors);
+
+                    permutation->Allocate(vec_perm_name, this->GetM());
+                    permutation->CopyFromData(coloring.permutation.data());
+
+                    return;
+                }
+            }
+
             bool err = this->matrix_->MultiColoring(num_colors, size_colors, permutation->vector_);
 
             if((err == false) && (this->is_host_() == true) && (this->GetFormat() == CSR))
@@ -3018,6 +3947,23 @@ namespace rocalution
                     permutation->MoveToAccelerator();
                 }
             }
+
+            if(key.empty() == false)
+            {
+                ColoringData coloring;
+
+                coloring.num_colors = num_colors;
+                coloring.size_colors.assign(*size_colors, *size_colors + num_colors);
+                coloring.permutation.resize(this->GetM());
+
+                permutation->CopyToData(coloring.permutation.data());
+
+                coloring_cache.Insert(
+                    key,
+                    pattern,
+                    coloring,
+                    (1 + coloring.size_colors.size() + coloring.permutation.size()) * sizeof(int));
+            }
         }
     }
 
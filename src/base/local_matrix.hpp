@@ -320,6 +320,9 @@ namespace rocalution
       * \details
       * The Multi-Coloring algorithm builds a permutation (coloring of the matrix) in a
       * way such that no two adjacent nodes in the sparse matrix have the same color.
+      * Colorings of host CSR matrices are cached by their sparsity pattern (see Key()),
+      * such that repeated calls on the same pattern reuse the previous coloring until
+      * stop_rocalution().
       *
       * @param[out]
       * num_colors  number of colors
@@ -407,6 +410,10 @@ namespace rocalution
 
         /** \brief Perform IC(0) factorization */
         void ICFactorize(LocalVector<ValueType>* inv_diag);
+        /** \brief Perform IC(t,m) factorization based on threshold and maximum number of
+      * elements per row; the matrix is replaced by its lower triangular factor
+      */
+        void ICTFactorize(double t, int maxrow, LocalVector<ValueType>* inv_diag);
 
         /** \brief Analyse the structure (level-scheduling) */
         void LLAnalyse(void);
@@ -447,6 +454,35 @@ namespace rocalution
       */
         void USolve(const LocalVector<ValueType>& in, LocalVector<ValueType>* out) const;
 
+        /** \brief Solve M out = in with the block SSOR matrix M
+      * \details
+      * M is the SSOR matrix with relaxation parameter \p omega of the diagonal blocks
+      * of \p nblocks consecutive row blocks. The blocks are processed in parallel.
+      */
+        void SSORSolve(ValueType                     omega,
+                       int                           nblocks,
+                       const LocalVector<ValueType>& in,
+                       LocalVector<ValueType>*       out) const;
+        /** \brief Split the row blocks for component averaging
+      * \details
+      * The columns of each of the \p nblocks consecutive row blocks are renumbered,
+      * such that the blocks of \p split have disjoint columns. \p average maps a
+      * vector in the columns of \p split back to the columns of this matrix, averaging
+      * each column over the blocks it appears in.
+      */
+        void ComponentAveragingSplit(int                     nblocks,
+                                     LocalMatrix<ValueType>* split,
+                                     LocalMatrix<ValueType>* average) const;
+        /** \brief Forward and backward Kaczmarz sweep on \p x
+      * \details
+      * The \p nblocks consecutive row blocks are processed in parallel. Their columns
+      * have to be disjoint, see ComponentAveragingSplit().
+      */
+        void KaczmarzSweep(ValueType                     omega,
+                           int                           nblocks,
+                           const LocalVector<ValueType>& rhs,
+                           LocalVector<ValueType>*       x) const;
+
         /** \brief Compute Householder vector */
         void Householder(int idx, ValueType& beta, LocalVector<ValueType>* vec) const;
         /** \brief QR Decomposition */
@@ -692,11 +728,93 @@ namespace rocalution
         /** \brief Convert the matrix to specified matrix ID format */
         void ConvertTo(unsigned int matrix_format);
 
+        /** \brief Select the fastest SpMV format for the matrix and convert to it
+      * \details
+      * \p AutotuneFormat inspects the row length statistics, the diagonal structure and
+      * the block structure of the matrix to determine the candidate formats. If
+      * \p benchmark is true, a few SpMVs are timed in each candidate format on the
+      * current backend and the fastest format is selected. Otherwise, the format is
+      * chosen from the structural statistics only. The decision is cached by the
+      * structure keys of the matrix (see Key()), such that matrices with identical
+      * structure are not analyzed again until stop_rocalution().
+      *
+      * @param[in]
+      * benchmark   time candidate SpMVs (true) or use structural heuristics only (false).
+      *
+      * \returns    the selected matrix format.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalMatrix<ValueType> mat;
+      *   mat.ReadFileMTX("my_matrix.mtx");
+      *   mat.MoveToAccelerator();
+      *
+      *   unsigned int format = mat.AutotuneFormat();
+      * \endcode
+      */
+        unsigned int AutotuneFormat(bool benchmark = true);
+
         virtual void Apply(const LocalVector<ValueType>& in, LocalVector<ValueType>* out) const;
         virtual void ApplyAdd(const LocalVector<ValueType>& in,
                               ValueType                     scalar,
                               LocalVector<ValueType>*       out) const;
 
+        /** \brief Compute the residual, res = b - this*x, in a single pass over the matrix
+      * and the vectors, if supported by the backend
+      */
+        virtual void Residual(const LocalVector<ValueType>& b,
+                              const LocalVector<ValueType>& x,
+                              LocalVector<ValueType>*       res) const;
+
+        /** \brief Compute the restricted residual, coarse = restriction*(b - this*x)
+      * \details
+      * If the backend supports it and \p restriction has at most one entry per column, as
+      * for aggregation based restrictions, the residual is computed on the fly and never
+      * stored. Otherwise, the residual is computed into \p res, which then serves as
+      * temporary vector. Callers that apply the same restriction repeatedly can check
+      * its columns once with HasUniqueColumns() and pass \p unique_cols = true to
+      * skip the check on every call.
+      */
+        void ResidualRestrict(const LocalMatrix<ValueType>& restriction,
+                              const LocalVector<ValueType>& b,
+                              const LocalVector<ValueType>& x,
+                              LocalVector<ValueType>*       res,
+                              LocalVector<ValueType>*       coarse,
+                              bool                          unique_cols = false) const;
+
+        /** \brief Return true if the matrix is in CSR format and has at most one entry
+      * per column
+      */
+        bool HasUniqueColumns(void) const;
+
+        /** \brief Perform out = this(rows, cols)*in, where the sub-matrix consists of the rows
+      * [row_offset, row_offset+row_size) and the columns [col_offset, col_offset+col_size)
+      * \details
+      * The sub-matrix is applied in place, without extracting it. \p in has size
+      * \p col_size and \p out has size \p row_size. Backends without support, see
+      * SupportsApplySubMatrix(), extract the sub-matrix on every call.
+      */
+        void ApplySubMatrix(int                           row_offset,
+                            int                           col_offset,
+                            int                           row_size,
+                            int                           col_size,
+                            const LocalVector<ValueType>& in,
+                            LocalVector<ValueType>*       out) const;
+
+        /** \brief Perform out = out + scalar*this(rows, cols)*in, where the sub-matrix is
+      * defined as in ApplySubMatrix()
+      */
+        void ApplyAddSubMatrix(int                           row_offset,
+                               int                           col_offset,
+                               int                           row_size,
+                               int                           col_size,
+                               const LocalVector<ValueType>& in,
+                               ValueType                     scalar,
+                               LocalVector<ValueType>*       out) const;
+
+        /** \brief Return true if the current backend and format apply sub-matrices in place */
+        bool SupportsApplySubMatrix(void) const;
+
         /** \brief Perform symbolic computation (structure only) of \f$|this|^p\f$ */
         void SymbolicPower(int p);
 
@@ -750,7 +868,9 @@ namespace rocalution
       * \details
       * Typically, it is hard to compare if two matrices have the same structure (and
       * values). To do so, rocALUTION provides a keying function, that generates three
-      * keys, for the row index, column index and values array.
+      * keys, for the row index, column index and values array. The row and column keys
+      * together identify the sparsity pattern. The keys are computed in parallel and do
+      * not depend on the number of threads.
       *
       * @param[out]
       * row_key row index array key
@@ -174,6 +174,22 @@ namespace rocalution
         this->vector_->LeaveDataPtr(ptr);
     }
 
+    template <typename ValueType>
+    void LocalVector<ValueType>::SetView(LocalVector<ValueType>& src, int offset, int size)
+    {
+        log_debug(this, "LocalVector::SetView()", (const void*&)src, offset, size);
+
+        assert(this != &src);
+        assert(offset >= 0);
+        assert(size >= 0);
+        assert(offset + size <= src.GetSize());
+
+        this->Clear();
+        this->CloneBackend(src);
+
+        this->vector_->SetView(*src.vector_, offset, size);
+    }
+
     template <typename ValueType>
     void LocalVector<ValueType>::Clear(void)
     {
@@ -781,6 +797,29 @@ namespace rocalution
         }
     }
 
+    // The dot product of a local vector is available right away
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotBegin(const LocalVector<ValueType>& x,
+                                          DotFuture<ValueType>*         dot) const
+    {
+        log_debug(this, "LocalVector::DotBegin()", (const void*&)x, dot);
+
+        assert(dot != NULL);
+
+        dot->Start_(this->Dot(x), NULL);
+    }
+
+    template <typename ValueType>
+    void LocalVector<ValueType>::DotNonConjBegin(const LocalVector<ValueType>& x,
+                                                 DotFuture<ValueType>*         dot) const
+    {
+        log_debug(this, "LocalVector::DotNonConjBegin()", (const void*&)x, dot);
+
+        assert(dot != NULL);
+
+        dot->Start_(this->DotNonConj(x), NULL);
+    }
+
     template <typename ValueType>
     ValueType LocalVector<ValueType>::Norm(void) const
     {
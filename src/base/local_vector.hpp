@@ -147,6 +147,32 @@ namespace rocalution
       */
         void LeaveDataPtr(ValueType** ptr);
 
+        /** \brief Initialize a LocalVector as view on a part of another LocalVector
+      * \details
+      * \p SetView lets the LocalVector refer to the \p size entries of \p src, starting at
+      * \p offset, without copying them. The view can be used like any other LocalVector,
+      * modifying the view modifies \p src and vice versa. The view is placed on the same
+      * backend as \p src. Clearing the view releases the reference only.
+      *
+      * \note
+      * \p src must not be cleared, reallocated or moved to another backend while the view
+      * is in use. Moving the view itself turns it into an independent copy.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   LocalVector<ValueType> vec;
+      *   vec.Allocate("my vector", 100);
+      *
+      *   // The second half of vec
+      *   LocalVector<ValueType> view;
+      *   view.SetView(vec, 50, 50);
+      *
+      *   // Sets vec[50] to vec[99] to one
+      *   view.Ones();
+      * \endcode
+      */
+        void SetView(LocalVector<ValueType>& src, int offset, int size);
+
         virtual void Clear();
         virtual void Zeros();
         virtual void Ones();
@@ -266,6 +292,9 @@ namespace rocalution
         virtual void      Scale(ValueType alpha);
         virtual ValueType Dot(const LocalVector<ValueType>& x) const;
         virtual ValueType DotNonConj(const LocalVector<ValueType>& x) const;
+        virtual void DotBegin(const LocalVector<ValueType>& x, DotFuture<ValueType>* dot) const;
+        virtual void DotNonConjBegin(const LocalVector<ValueType>& x,
+                                     DotFuture<ValueType>*         dot) const;
         virtual ValueType Norm(void) const;
         virtual ValueType Reduce(void) const;
         virtual ValueType Asum(void) const;
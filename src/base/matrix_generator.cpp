@@ -0,0 +1,1223 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../utils/def.hpp"
+#include "matrix_generator.hpp"
+#include "backend_manager.hpp"
+#include "global_matrix.hpp"
+#include "local_matrix.hpp"
+#include "parallel_manager.hpp"
+
+#include "../utils/allocate_free.hpp"
+#include "../utils/log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <deque>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace rocalution
+{
+
+    // Problem types
+    enum _matrix_generator_problem
+    {
+        GEN_NONE = 0,
+        GEN_LAPLACE,
+        GEN_ANISOTROPIC,
+        GEN_JUMPING,
+        GEN_ELASTICITY,
+        GEN_CONVECTION,
+        GEN_GRAPH
+    };
+
+    const std::string _matrix_generator_problem_names[7] = {"None",
+                                                            "Laplace",
+                                                            "AnisotropicDiffusion",
+                                                            "JumpingDiffusion",
+                                                            "Elasticity",
+                                                            "ConvectionDiffusion",
+                                                            "PowerLawGraph"};
+
+    // Rows of a grid problem. The grid is split into boxes on a px x py x pz process grid,
+    // the unknowns of each box are numbered lexicographically with the degrees of freedom
+    // of a grid point numbered consecutively.
+    template <typename ValueType>
+    class GridRows
+    {
+    public:
+        GridRows(int           problem,
+                 const int*    n,
+                 const int*    p,
+                 int           rank,
+                 int           points,
+                 int           width,
+                 const double* coef)
+            : problem_(problem)
+            , points_(points)
+            , width_(width)
+            , coef_(coef)
+        {
+            this->ndof_ = (problem == GEN_ELASTICITY) ? 3 : 1;
+
+            for(int d = 0; d < 3; ++d)
+            {
+                this->n_[d] = n[d];
+                this->p_[d] = p[d];
+
+                this->begin_[d].resize(p[d] + 1);
+                this->owner_[d].resize(n[d]);
+
+                for(int i = 0; i <= p[d]; ++i)
+                {
+                    this->begin_[d][i]
+                        = static_cast<int>((static_cast<long long>(n[d]) * i) / p[d]);
+                }
+
+                for(int i = 0; i < p[d]; ++i)
+                {
+                    for(int j = this->begin_[d][i]; j < this->begin_[d][i + 1]; ++j)
+                    {
+                        this->owner_[d][j] = i;
+                    }
+                }
+            }
+
+            int nprocs = p[0] * p[1] * p[2];
+
+            this->offsets_.resize(nprocs + 1);
+            this->offsets_[0] = 0;
+
+            for(int r = 0; r < nprocs; ++r)
+            {
+                int c[3] = {r % p[0], (r / p[0]) % p[1], r / (p[0] * p[1])};
+
+                IndexType2 size = this->ndof_;
+
+                for(int d = 0; d < 3; ++d)
+                {
+                    size *= this->begin_[d][c[d] + 1] - this->begin_[d][c[d]];
+                }
+
+                this->offsets_[r + 1] = this->offsets_[r] + size;
+            }
+
+            int box[3] = {rank % p[0], (rank / p[0]) % p[1], rank / (p[0] * p[1])};
+
+            for(int d = 0; d < 3; ++d)
+            {
+                this->origin_[d] = this->begin_[d][box[d]];
+                this->size_[d]   = this->begin_[d][box[d] + 1] - this->begin_[d][box[d]];
+            }
+
+            // Stencil offsets in lexicographic order
+            for(int dz = -1; dz <= 1; ++dz)
+            {
+                for(int dy = -1; dy <= 1; ++dy)
+                {
+                    for(int dx = -1; dx <= 1; ++dx)
+                    {
+                        int s[3] = {dx, dy, dz};
+
+                        if(this->InStencil_(s) == true)
+                        {
+                            this->stencil_.push_back(dx);
+                            this->stencil_.push_back(dy);
+                            this->stencil_.push_back(dz);
+                        }
+                    }
+                }
+            }
+
+            this->nrow_ = static_cast<int>(this->offsets_[rank + 1] - this->offsets_[rank]);
+        }
+
+        const std::vector<IndexType2>& GetOffsets(void) const
+        {
+            return this->offsets_;
+        }
+
+        int GetNrow(void) const
+        {
+            return this->nrow_;
+        }
+
+        int GetMaxRowNnz(void) const
+        {
+            return static_cast<int>(this->stencil_.size() / 3) * this->ndof_;
+        }
+
+        // Fills the entries of local row i in ascending order of the local numbering of the
+        // box, returns their number
+        int operator()(int i, IndexType2* col, ValueType* val) const
+        {
+            int node = i / this->ndof_;
+            int comp = i % this->ndof_;
+
+            int x[3];
+
+            x[0] = this->origin_[0] + node % this->size_[0];
+            x[1] = this->origin_[1] + (node / this->size_[0]) % this->size_[1];
+            x[2] = this->origin_[2] + node / (this->size_[0] * this->size_[1]);
+
+            int nnz = 0;
+
+            for(size_t k = 0; k < this->stencil_.size(); k += 3)
+            {
+                const int* s = &this->stencil_[k];
+
+                int y[3] = {x[0] + s[0], x[1] + s[1], x[2] + s[2]};
+
+                if(y[0] < 0 || y[0] >= this->n_[0] || y[1] < 0 || y[1] >= this->n_[1] || y[2] < 0
+                   || y[2] >= this->n_[2])
+                {
+                    continue;
+                }
+
+                IndexType2 g = this->Global_(y);
+
+                for(int c = 0; c < this->ndof_; ++c)
+                {
+                    col[nnz] = g + c;
+                    val[nnz] = static_cast<ValueType>(this->Coupling_(x, s, comp, c));
+                    ++nnz;
+                }
+            }
+
+            return nnz;
+        }
+
+    private:
+        bool InStencil_(const int* s) const
+        {
+            int dist = std::abs(s[0]) + std::abs(s[1]) + std::abs(s[2]);
+
+            if(this->problem_ == GEN_LAPLACE && this->points_ == 27)
+            {
+                return true;
+            }
+
+            if(this->problem_ == GEN_ELASTICITY)
+            {
+                // 19 point stencil
+                return dist <= 2;
+            }
+
+            return dist <= 1;
+        }
+
+        // Global index of the first unknown of grid point y
+        IndexType2 Global_(const int* y) const
+        {
+            int o[3];
+            int l[3];
+            int z[3];
+
+            for(int d = 0; d < 3; ++d)
+            {
+                o[d] = this->owner_[d][y[d]];
+                l[d] = this->begin_[d][o[d] + 1] - this->begin_[d][o[d]];
+                z[d] = y[d] - this->begin_[d][o[d]];
+            }
+
+            int rank = (o[2] * this->p_[1] + o[1]) * this->p_[0] + o[0];
+
+            return this->offsets_[rank]
+                   + ((static_cast<IndexType2>(z[2]) * l[1] + z[1]) * l[0] + z[0]) * this->ndof_;
+        }
+
+        // Diffusion coefficient of grid point x
+        double Coefficient_(const int* x) const
+        {
+            int w = this->width_;
+
+            return ((x[0] / w + x[1] / w + x[2] / w) % 2 == 0) ? 1.0 : this->coef_[0];
+        }
+
+        // Coupling between the diffusion coefficients of x and its neighbour x + s
+        double Harmonic_(const int* x, const int* s) const
+        {
+            int y[3] = {x[0] + s[0], x[1] + s[1], x[2] + s[2]};
+
+            double a = this->Coefficient_(x);
+
+            for(int d = 0; d < 3; ++d)
+            {
+                if(y[d] < 0 || y[d] >= this->n_[d])
+                {
+                    return a;
+                }
+            }
+
+            double b = this->Coefficient_(y);
+
+            return 2.0 * a * b / (a + b);
+        }
+
+        // Entry of component a of grid point x with component b of grid point x + s
+        double Coupling_(const int* x, const int* s, int a, int b) const
+        {
+            int axes = (s[0] != 0) + (s[1] != 0) + (s[2] != 0);
+
+            // Axis of a face neighbour
+            int d = (s[0] != 0) ? 0 : ((s[1] != 0) ? 1 : 2);
+
+            switch(this->problem_)
+            {
+            case GEN_LAPLACE:
+                return (axes == 0) ? static_cast<double>(this->points_ - 1) : -1.0;
+
+            case GEN_ANISOTROPIC:
+                if(axes == 0)
+                {
+                    return 2.0 * (this->coef_[0] + this->coef_[1] + this->coef_[2]);
+                }
+
+                return -this->coef_[d];
+
+            case GEN_JUMPING:
+                if(axes == 0)
+                {
+                    double diag = 0.0;
+
+                    for(int e = 0; e < 3; ++e)
+                    {
+                        for(int sign = -1; sign <= 1; sign += 2)
+                        {
+                            int t[3] = {0, 0, 0};
+                            t[e]     = sign;
+
+                            diag += this->Harmonic_(x, t);
+                        }
+                    }
+
+                    return diag;
+                }
+
+                return -this->Harmonic_(x, s);
+
+            case GEN_CONVECTION:
+            {
+                double eps = this->coef_[0];
+
+                if(axes == 0)
+                {
+                    return 6.0 * eps + std::abs(this->coef_[1]) + std::abs(this->coef_[2])
+                           + std::abs(this->coef_[3]);
+                }
+
+                // Upwind from the minus side for a positive velocity
+                double b = this->coef_[d + 1] * s[d];
+
+                return -(eps + std::max(-b, 0.0));
+            }
+
+            case GEN_ELASTICITY:
+            {
+                double lambda = this->coef_[0];
+                double mu     = this->coef_[1];
+
+                if(axes == 0)
+                {
+                    return (a == b) ? 2.0 * lambda + 8.0 * mu : 0.0;
+                }
+
+                if(axes == 1)
+                {
+                    // mu * laplace(u_a) + (lambda + mu) * d_aa(u_a)
+                    if(a != b)
+                    {
+                        return 0.0;
+                    }
+
+                    return (a == d) ? -(lambda + 2.0 * mu) : -mu;
+                }
+
+                // (lambda + mu) * d_ab(u_b), central differences
+                if(a == b || s[a] == 0 || s[b] == 0)
+                {
+                    return 0.0;
+                }
+
+                return -0.25 * (lambda + mu) * s[a] * s[b];
+            }
+            }
+
+            return 0.0;
+        }
+
+        int           problem_;
+        int           points_;
+        int           width_;
+        const double* coef_;
+
+        int ndof_;
+        int nrow_;
+
+        int n_[3];
+        int p_[3];
+        int origin_[3];
+        int size_[3];
+
+        std::vector<int> stencil_;
+
+        std::vector<int>        begin_[3];
+        std::vector<int>        owner_[3];
+        std::vector<IndexType2> offsets_;
+    };
+
+    // Random number in [0, 1) determined by the key (a, b, c)
+    static inline double
+        hash_uniform(unsigned long long a, unsigned long long b, unsigned long long c)
+    {
+        unsigned long long h = a;
+
+        h ^= b + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+        h ^= c + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+
+        // splitmix64 finalizer
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        h = h ^ (h >> 31);
+
+        return static_cast<double>(h >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Rows of a random power-law graph. Each of the L levels pairs vertex i with vertex
+    // i ^ key_l, the pair is an edge with probability min(1, w_i * w_j / S). The weights
+    // decay like a power of the rank of a vertex in a random permutation, such that the
+    // high degree vertices are scattered over all processes.
+    template <typename ValueType>
+    class GraphRows
+    {
+    public:
+        GraphRows(IndexType2         n,
+                  int                avg_degree,
+                  int                max_degree,
+                  double             exponent,
+                  unsigned long long seed,
+                  int                rank,
+                  int                nprocs)
+            : n_(n)
+            , seed_(seed)
+        {
+            this->bits_ = 1;
+
+            while((static_cast<IndexType2>(1) << this->bits_) < n)
+            {
+                ++this->bits_;
+            }
+
+            this->mask_ = (1ULL << this->bits_) - 1ULL;
+
+            // Weights are constant on the dyadic intervals [2^b, 2^(b+1)) of the rank
+            double beta = 1.0 / (exponent - 1.0);
+            double wsum = 0.0;
+
+            for(int b = 0; b <= this->bits_; ++b)
+            {
+                IndexType2 lo = static_cast<IndexType2>(1) << b;
+                IndexType2 hi = std::min(static_cast<IndexType2>(1) << (b + 1), n + 1);
+
+                this->weight_[b] = std::pow(2.0, -beta * b);
+
+                if(lo < hi)
+                {
+                    wsum += static_cast<double>(hi - lo) * this->weight_[b];
+                }
+            }
+
+            double wmean = wsum / static_cast<double>(n);
+
+            // Fraction of the pairs i ^ key_l that are valid vertices
+            double valid = static_cast<double>(n) / static_cast<double>(this->mask_ + 1ULL);
+
+            this->scale_ = 1.0 / (max_degree * valid * wmean * wmean / avg_degree);
+
+            this->key_.resize(max_degree);
+
+            for(int l = 0; l < max_degree; ++l)
+            {
+                unsigned long long key = 0;
+
+                for(int k = 0; key == 0; ++k)
+                {
+                    key = static_cast<unsigned long long>(hash_uniform(seed, l, k)
+                                                          * static_cast<double>(this->mask_ + 1ULL))
+                          & this->mask_;
+                }
+
+                this->key_[l] = key;
+            }
+
+            this->offsets_.resize(nprocs + 1);
+
+            for(int r = 0; r <= nprocs; ++r)
+            {
+                this->offsets_[r]
+                    = n / nprocs * r + std::min(static_cast<IndexType2>(r), n % nprocs);
+            }
+
+            this->begin_ = this->offsets_[rank];
+            this->nrow_  = static_cast<int>(this->offsets_[rank + 1] - this->offsets_[rank]);
+        }
+
+        const std::vector<IndexType2>& GetOffsets(void) const
+        {
+            return this->offsets_;
+        }
+
+        int GetNrow(void) const
+        {
+            return this->nrow_;
+        }
+
+        int GetMaxRowNnz(void) const
+        {
+            return static_cast<int>(this->key_.size()) + 1;
+        }
+
+        // Fills the entries of local row i in ascending order, returns their number
+        int operator()(int i, IndexType2* col, ValueType* val) const
+        {
+            unsigned long long v  = static_cast<unsigned long long>(this->begin_ + i);
+            double             wv = this->Weight_(v) * this->scale_;
+
+            int nnz = 0;
+
+            for(size_t l = 0; l < this->key_.size(); ++l)
+            {
+                unsigned long long w = v ^ this->key_[l];
+
+                if(w >= static_cast<unsigned long long>(this->n_))
+                {
+                    continue;
+                }
+
+                double u = hash_uniform(this->seed_ ^ l, std::min(v, w), std::max(v, w));
+
+                if(u < wv && u < wv * this->Weight_(w))
+                {
+                    col[nnz++] = static_cast<IndexType2>(w);
+                }
+            }
+
+            // Pairs can be repeated on different levels
+            std::sort(col, col + nnz);
+            nnz = static_cast<int>(std::unique(col, col + nnz) - col);
+
+            for(int j = 0; j < nnz; ++j)
+            {
+                val[j] = static_cast<ValueType>(-1);
+            }
+
+            // Diagonal entry
+            int pos = static_cast<int>(
+                std::lower_bound(col, col + nnz, static_cast<IndexType2>(v)) - col);
+
+            for(int j = nnz; j > pos; --j)
+            {
+                col[j] = col[j - 1];
+                val[j] = val[j - 1];
+            }
+
+            col[pos] = static_cast<IndexType2>(v);
+            val[pos] = static_cast<ValueType>(nnz + 1);
+
+            return nnz + 1;
+        }
+
+    private:
+        // Weight of vertex v, according to its rank in a random permutation of [0, n)
+        double Weight_(unsigned long long v) const
+        {
+            // Cycle walking on a bijection of [0, 2^bits)
+            do
+            {
+                for(int k = 0; k < 2; ++k)
+                {
+                    v = (v * 0x9e3779b97f4a7c15ULL + this->seed_) & this->mask_;
+                    v ^= v >> (this->bits_ / 2 + 1);
+                }
+            } while(v >= static_cast<unsigned long long>(this->n_));
+
+            // floor(log2(rank + 1))
+            int b = 0;
+
+            for(unsigned long long r = v + 1; r > 1; r >>= 1)
+            {
+                ++b;
+            }
+
+            return this->weight_[b];
+        }
+
+        IndexType2         n_;
+        unsigned long long seed_;
+
+        int                bits_;
+        unsigned long long mask_;
+        double             weight_[65];
+        double             scale_;
+
+        std::vector<unsigned long long> key_;
+
+        IndexType2              begin_;
+        int                     nrow_;
+        std::vector<IndexType2> offsets_;
+    };
+
+    // Generates the local rows [0, nrow) of a process, whose global rows start at begin.
+    // Each thread generates a contiguous range of rows into its own buffer, the buffers
+    // are then split into the interior and ghost part.
+    template <typename ValueType, typename Rows>
+    static void assemble_rows(const Rows&              rows,
+                              IndexType2               begin,
+                              int**                    row_offset,
+                              int**                    col,
+                              ValueType**              val,
+                              int*                     nnz,
+                              std::vector<int>&        ghost_row,
+                              std::vector<IndexType2>& ghost_col,
+                              std::vector<ValueType>&  ghost_val)
+    {
+        int        nrow = rows.GetNrow();
+        IndexType2 end  = begin + nrow;
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), nrow);
+
+        int nthreads = 1;
+#ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+#endif
+
+        std::vector<std::deque<IndexType2>> tcol(nthreads);
+        std::vector<std::deque<ValueType>>  tval(nthreads);
+
+        std::vector<int> ghost_offset(nrow + 1, 0);
+
+        allocate_host(nrow + 1, row_offset);
+
+        (*row_offset)[0] = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int t = 0; t < nthreads; ++t)
+        {
+            int first = static_cast<int>((static_cast<long long>(nrow) * t) / nthreads);
+            int last  = static_cast<int>((static_cast<long long>(nrow) * (t + 1)) / nthreads);
+
+            std::vector<IndexType2> c(rows.GetMaxRowNnz());
+            std::vector<ValueType>  v(rows.GetMaxRowNnz());
+
+            for(int i = first; i < last; ++i)
+            {
+                int n = rows(i, c.data(), v.data());
+
+                tcol[t].insert(tcol[t].end(), c.begin(), c.begin() + n);
+                tval[t].insert(tval[t].end(), v.begin(), v.begin() + n);
+
+                int interior = 0;
+
+                for(int j = 0; j < n; ++j)
+                {
+                    interior += (c[j] >= begin && c[j] < end);
+                }
+
+                (*row_offset)[i + 1] = interior;
+                ghost_offset[i + 1]  = n - interior;
+            }
+        }
+
+        for(int i = 0; i < nrow; ++i)
+        {
+            (*row_offset)[i + 1] += (*row_offset)[i];
+            ghost_offset[i + 1] += ghost_offset[i];
+        }
+
+        *nnz = (*row_offset)[nrow];
+
+        allocate_host(*nnz, col);
+        allocate_host(*nnz, val);
+
+        ghost_row.resize(ghost_offset[nrow]);
+        ghost_col.resize(ghost_offset[nrow]);
+        ghost_val.resize(ghost_offset[nrow]);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1)
+#endif
+        for(int t = 0; t < nthreads; ++t)
+        {
+            int first = static_cast<int>((static_cast<long long>(nrow) * t) / nthreads);
+            int last  = static_cast<int>((static_cast<long long>(nrow) * (t + 1)) / nthreads);
+
+            typename std::deque<IndexType2>::const_iterator c = tcol[t].begin();
+            typename std::deque<ValueType>::const_iterator  v = tval[t].begin();
+
+            for(int i = first; i < last; ++i)
+            {
+                int k = (*row_offset)[i];
+                int g = ghost_offset[i];
+
+                int n = (*row_offset)[i + 1] - k + ghost_offset[i + 1] - g;
+
+                for(int j = 0; j < n; ++j, ++c, ++v)
+                {
+                    if(*c >= begin && *c < end)
+                    {
+                        (*col)[k] = static_cast<int>(*c - begin);
+                        (*val)[k] = *v;
+                        ++k;
+                    }
+                    else
+                    {
+                        ghost_row[g] = i;
+                        ghost_col[g] = *c;
+                        ghost_val[g] = *v;
+                        ++g;
+                    }
+                }
+            }
+
+            std::deque<IndexType2>().swap(tcol[t]);
+            std::deque<ValueType>().swap(tval[t]);
+        }
+    }
+
+    // Process grid with boxes close to cubes
+    static void process_grid(int nprocs, const int* n, int* p)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        p[0] = 0;
+
+        for(int i = 1; i <= nprocs; ++i)
+        {
+            if(nprocs % i != 0)
+            {
+                continue;
+            }
+
+            for(int j = 1; j <= nprocs / i; ++j)
+            {
+                if((nprocs / i) % j != 0)
+                {
+                    continue;
+                }
+
+                int k = nprocs / i / j;
+
+                if(i > n[0] || j > n[1] || k > n[2])
+                {
+                    continue;
+                }
+
+                double lx = static_cast<double>(n[0]) / i;
+                double ly = static_cast<double>(n[1]) / j;
+                double lz = static_cast<double>(n[2]) / k;
+
+                double area = lx * ly + ly * lz + lx * lz;
+
+                if(area < best)
+                {
+                    best = area;
+                    p[0] = i;
+                    p[1] = j;
+                    p[2] = k;
+                }
+            }
+        }
+
+        if(p[0] == 0)
+        {
+            LOG_INFO("MatrixGenerator: the grid is too small for " << nprocs << " processes");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    template <typename ValueType>
+    MatrixGenerator<ValueType>::MatrixGenerator()
+    {
+        log_debug(this, "MatrixGenerator::MatrixGenerator()");
+
+        this->problem_ = GEN_NONE;
+
+        this->nx_ = 0;
+        this->ny_ = 0;
+        this->nz_ = 0;
+
+        this->px_ = 0;
+        this->py_ = 0;
+        this->pz_ = 0;
+
+        this->points_ = 7;
+        this->width_  = 1;
+
+        for(int i = 0; i < 4; ++i)
+        {
+            this->coef_[i] = 0.0;
+        }
+
+        this->graph_size_ = 0;
+        this->avg_degree_ = 0;
+        this->max_degree_ = 0;
+        this->exponent_   = 0.0;
+        this->seed_       = 0ULL;
+    }
+
+    template <typename ValueType>
+    MatrixGenerator<ValueType>::~MatrixGenerator()
+    {
+        log_debug(this, "MatrixGenerator::~MatrixGenerator()");
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::Print(void) const
+    {
+        LOG_INFO("MatrixGenerator problem=" << _matrix_generator_problem_names[this->problem_]);
+
+        switch(this->problem_)
+        {
+        case GEN_NONE:
+            break;
+
+        case GEN_GRAPH:
+            LOG_INFO("MatrixGenerator vertices=" << this->graph_size_
+                                                 << "; avg degree=" << this->avg_degree_
+                                                 << "; max degree=" << this->max_degree_
+                                                 << "; exponent=" << this->exponent_
+                                                 << "; seed=" << this->seed_);
+            break;
+
+        default:
+            LOG_INFO("MatrixGenerator grid=" << this->nx_ << "x" << this->ny_ << "x"
+                                             << this->nz_);
+
+            if(this->problem_ == GEN_LAPLACE)
+            {
+                LOG_INFO("MatrixGenerator points=" << this->points_);
+            }
+            else if(this->problem_ == GEN_JUMPING)
+            {
+                LOG_INFO("MatrixGenerator jump=" << this->coef_[0] << "; width="
+                                                 << this->width_);
+            }
+            else
+            {
+                LOG_INFO("MatrixGenerator coefficients=" << this->coef_[0] << ", "
+                                                         << this->coef_[1] << ", "
+                                                         << this->coef_[2] << ", "
+                                                         << this->coef_[3]);
+            }
+        }
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetGrid(int nx, int ny, int nz)
+    {
+        log_debug(this, "MatrixGenerator::SetGrid()", nx, ny, nz);
+
+        assert(nx > 0);
+        assert(ny > 0);
+        assert(nz > 0);
+
+        this->nx_ = nx;
+        this->ny_ = ny;
+        this->nz_ = nz;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetProcessGrid(int px, int py, int pz)
+    {
+        log_debug(this, "MatrixGenerator::SetProcessGrid()", px, py, pz);
+
+        assert(px > 0);
+        assert(py > 0);
+        assert(pz > 0);
+
+        this->px_ = px;
+        this->py_ = py;
+        this->pz_ = pz;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetLaplace(int points)
+    {
+        log_debug(this, "MatrixGenerator::SetLaplace()", points);
+
+        if(points != 7 && points != 27)
+        {
+            LOG_INFO("MatrixGenerator::SetLaplace() only 7 and 27 point stencils are supported");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        this->problem_ = GEN_LAPLACE;
+        this->points_  = points;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetAnisotropicDiffusion(double eps_x,
+                                                             double eps_y,
+                                                             double eps_z)
+    {
+        log_debug(this, "MatrixGenerator::SetAnisotropicDiffusion()", eps_x, eps_y, eps_z);
+
+        assert(eps_x > 0.0);
+        assert(eps_y > 0.0);
+        assert(eps_z > 0.0);
+
+        this->problem_ = GEN_ANISOTROPIC;
+        this->coef_[0] = eps_x;
+        this->coef_[1] = eps_y;
+        this->coef_[2] = eps_z;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetJumpingDiffusion(double jump, int width)
+    {
+        log_debug(this, "MatrixGenerator::SetJumpingDiffusion()", jump, width);
+
+        assert(jump > 0.0);
+        assert(width > 0);
+
+        this->problem_ = GEN_JUMPING;
+        this->coef_[0] = jump;
+        this->width_   = width;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetElasticity(double lambda, double mu)
+    {
+        log_debug(this, "MatrixGenerator::SetElasticity()", lambda, mu);
+
+        assert(lambda >= 0.0);
+        assert(mu > 0.0);
+
+        this->problem_ = GEN_ELASTICITY;
+        this->coef_[0] = lambda;
+        this->coef_[1] = mu;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetConvectionDiffusion(double eps,
+                                                            double bx,
+                                                            double by,
+                                                            double bz)
+    {
+        log_debug(this, "MatrixGenerator::SetConvectionDiffusion()", eps, bx, by, bz);
+
+        assert(eps > 0.0);
+
+        this->problem_ = GEN_CONVECTION;
+        this->coef_[0] = eps;
+        this->coef_[1] = bx;
+        this->coef_[2] = by;
+        this->coef_[3] = bz;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::SetPowerLawGraph(IndexType2         size,
+                                                      int                avg_degree,
+                                                      int                max_degree,
+                                                      double             exponent,
+                                                      unsigned long long seed)
+    {
+        log_debug(this,
+                  "MatrixGenerator::SetPowerLawGraph()",
+                  size,
+                  avg_degree,
+                  max_degree,
+                  exponent,
+                  seed);
+
+        assert(size > 1);
+        assert(avg_degree > 0);
+        assert(max_degree >= avg_degree);
+        assert(exponent > 2.0);
+
+        this->problem_    = GEN_GRAPH;
+        this->graph_size_ = size;
+        this->avg_degree_ = avg_degree;
+        this->max_degree_ = max_degree;
+        this->exponent_   = exponent;
+        this->seed_       = seed;
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::Assemble_(int                      rank,
+                                               int                      nprocs,
+                                               std::vector<IndexType2>& offsets,
+                                               int**                    row_offset,
+                                               int**                    col,
+                                               ValueType**              val,
+                                               int*                     nnz,
+                                               std::vector<int>&        ghost_row,
+                                               std::vector<IndexType2>& ghost_col,
+                                               std::vector<ValueType>&  ghost_val) const
+    {
+        if(this->problem_ == GEN_NONE)
+        {
+            LOG_INFO("MatrixGenerator: no problem has been set");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(this->problem_ == GEN_GRAPH)
+        {
+            GraphRows<ValueType> rows(this->graph_size_,
+                                      this->avg_degree_,
+                                      this->max_degree_,
+                                      this->exponent_,
+                                      this->seed_,
+                                      rank,
+                                      nprocs);
+
+            offsets = rows.GetOffsets();
+
+            assemble_rows(
+                rows, offsets[rank], row_offset, col, val, nnz, ghost_row, ghost_col, ghost_val);
+
+            return;
+        }
+
+        if(this->nx_ == 0)
+        {
+            LOG_INFO("MatrixGenerator: the grid has not been set");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int n[3] = {this->nx_, this->ny_, this->nz_};
+        int p[3] = {this->px_, this->py_, this->pz_};
+
+        if(nprocs == 1)
+        {
+            p[0] = 1;
+            p[1] = 1;
+            p[2] = 1;
+        }
+        else if(p[0] == 0)
+        {
+            process_grid(nprocs, n, p);
+        }
+
+        if(p[0] * p[1] * p[2] != nprocs || p[0] > n[0] || p[1] > n[1] || p[2] > n[2])
+        {
+            LOG_INFO("MatrixGenerator: the process grid " << p[0] << "x" << p[1] << "x" << p[2]
+                                                         << " does not match "
+                                                         << nprocs << " processes");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        GridRows<ValueType> rows(
+            this->problem_, n, p, rank, this->points_, this->width_, this->coef_);
+
+        offsets = rows.GetOffsets();
+
+        assemble_rows(
+            rows, offsets[rank], row_offset, col, val, nnz, ghost_row, ghost_col, ghost_val);
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::Generate(LocalMatrix<ValueType>* mat) const
+    {
+        log_debug(this, "MatrixGenerator::Generate()", mat);
+
+        assert(mat != NULL);
+
+        std::vector<IndexType2> offsets;
+        std::vector<int>        ghost_row;
+        std::vector<IndexType2> ghost_col;
+        std::vector<ValueType>  ghost_val;
+
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+        int        nnz;
+
+        this->Assemble_(
+            0, 1, offsets, &row_offset, &col, &val, &nnz, ghost_row, ghost_col, ghost_val);
+
+        assert(ghost_row.size() == 0);
+        assert(offsets[1] <= std::numeric_limits<int>::max());
+
+        int nrow = static_cast<int>(offsets[1]);
+
+        mat->Clear();
+        mat->SetDataPtrCSR(&row_offset,
+                           &col,
+                           &val,
+                           _matrix_generator_problem_names[this->problem_],
+                           nnz,
+                           nrow,
+                           nrow);
+    }
+
+    template <typename ValueType>
+    void MatrixGenerator<ValueType>::Generate(ParallelManager*         pm,
+                                              GlobalMatrix<ValueType>* mat) const
+    {
+        log_debug(this, "MatrixGenerator::Generate()", pm, mat);
+
+        assert(pm != NULL);
+        assert(mat != NULL);
+        assert(pm->comm_ != NULL);
+        assert(pm->rank_ >= 0);
+
+        int rank   = pm->rank_;
+        int nprocs = pm->num_procs_;
+
+        std::vector<IndexType2> offsets;
+        std::vector<int>        ghost_row;
+        std::vector<IndexType2> ghost_col;
+        std::vector<ValueType>  ghost_val;
+
+        int*       row_offset = NULL;
+        int*       col        = NULL;
+        ValueType* val        = NULL;
+        int        nnz;
+
+        this->Assemble_(
+            rank, nprocs, offsets, &row_offset, &col, &val, &nnz, ghost_row, ghost_col, ghost_val);
+
+        int nrow      = static_cast<int>(offsets[rank + 1] - offsets[rank]);
+        int ghost_nnz = static_cast<int>(ghost_col.size());
+
+        // The ghost unknowns are received in ascending global order, which groups them by
+        // their owning process
+        std::vector<IndexType2> recv_index(ghost_col);
+
+        std::sort(recv_index.begin(), recv_index.end());
+        recv_index.erase(std::unique(recv_index.begin(), recv_index.end()), recv_index.end());
+
+        std::vector<int> recvs;
+        std::vector<int> recv_offset(1, 0);
+
+        for(size_t i = 0; i < recv_index.size(); ++i)
+        {
+            int owner = static_cast<int>(
+                std::upper_bound(offsets.begin(), offsets.end(), recv_index[i]) - offsets.begin()
+                - 1);
+
+            if(recvs.empty() || recvs.back() != owner)
+            {
+                recvs.push_back(owner);
+                recv_offset.push_back(recv_offset.back());
+            }
+
+            ++recv_offset.back();
+        }
+
+        // The structure is symmetric, such that the rows of this process, which couple to
+        // a neighbour, are the ghost unknowns of the neighbour. They are sent in ascending
+        // order, which is the order the neighbour receives them in.
+        std::vector<std::pair<int, int>> boundary(ghost_nnz);
+
+        for(int i = 0; i < ghost_nnz; ++i)
+        {
+            int owner = static_cast<int>(
+                std::upper_bound(offsets.begin(), offsets.end(), ghost_col[i]) - offsets.begin()
+                - 1);
+
+            boundary[i] = std::make_pair(owner, ghost_row[i]);
+        }
+
+        std::sort(boundary.begin(), boundary.end());
+        boundary.erase(std::unique(boundary.begin(), boundary.end()), boundary.end());
+
+        std::vector<int> sends;
+        std::vector<int> send_offset(1, 0);
+        std::vector<int> boundary_index(boundary.size());
+
+        for(size_t i = 0; i < boundary.size(); ++i)
+        {
+            if(sends.empty() || sends.back() != boundary[i].first)
+            {
+                sends.push_back(boundary[i].first);
+                send_offset.push_back(send_offset.back());
+            }
+
+            ++send_offset.back();
+            boundary_index[i] = boundary[i].second;
+        }
+
+        assert(sends == recvs);
+
+        // Ghost part in COO format with columns in the receive buffer
+        int*       grow = NULL;
+        int*       gcol = NULL;
+        ValueType* gval = NULL;
+
+        allocate_host(ghost_nnz, &grow);
+        allocate_host(ghost_nnz, &gcol);
+        allocate_host(ghost_nnz, &gval);
+
+        _set_omp_backend_threads(*_get_backend_descriptor(), ghost_nnz);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for(int i = 0; i < ghost_nnz; ++i)
+        {
+            grow[i] = ghost_row[i];
+            gcol[i] = static_cast<int>(
+                std::lower_bound(recv_index.begin(), recv_index.end(), ghost_col[i])
+                - recv_index.begin());
+            gval[i] = ghost_val[i];
+        }
+
+        pm->SetGlobalSize(offsets[nprocs]);
+        pm->SetLocalSize(nrow);
+
+        if(recvs.size() > 0)
+        {
+            pm->SetBoundaryIndex(static_cast<int>(boundary_index.size()), boundary_index.data());
+            pm->SetReceivers(static_cast<int>(recvs.size()), recvs.data(), recv_offset.data());
+            pm->SetSenders(static_cast<int>(sends.size()), sends.data(), send_offset.data());
+        }
+
+        std::string name = _matrix_generator_problem_names[this->problem_];
+
+        mat->Clear();
+        mat->SetParallelManager(*pm);
+        mat->SetLocalDataPtrCSR(&row_offset, &col, &val, name, nnz);
+
+        if(ghost_nnz > 0)
+        {
+            mat->SetGhostDataPtrCOO(&grow, &gcol, &gval, name, ghost_nnz);
+        }
+    }
+
+    template class MatrixGenerator<double>;
+    template class MatrixGenerator<float>;
+#ifdef SUPPORT_COMPLEX
+    template class MatrixGenerator<std::complex<double>>;
+    template class MatrixGenerator<std::complex<float>>;
+#endif
+
+} // namespace rocalution
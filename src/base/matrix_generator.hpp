@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_MATRIX_GENERATOR_HPP_
+#define ROCALUTION_MATRIX_GENERATOR_HPP_
+
+#include "../utils/types.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    template <typename ValueType>
+    class LocalMatrix;
+    template <typename ValueType>
+    class GlobalMatrix;
+
+    class ParallelManager;
+
+    /** \ingroup op_vec_module
+  * \class MatrixGenerator
+  * \brief Synthetic test problems
+  * \details
+  * The MatrixGenerator class assembles sparse test matrices directly in CSR format,
+  * without reading them from a file. The rows are generated in parallel. For a
+  * GlobalMatrix, each process only generates its own rows, including the ghost part
+  * and the communication pattern of the ParallelManager. No communication is required
+  * for this, such that problems of arbitrary size can be set up for weak and strong
+  * scaling studies.
+  *
+  * The grid based problems are finite difference discretizations on a regular
+  * \f$n_x \times n_y \times n_z\f$ grid of unknowns with unit spacing and homogeneous
+  * Dirichlet boundary conditions:
+  * - SetLaplace() - 7 or 27 point Laplacian.
+  * - SetAnisotropicDiffusion() - 7 point diffusion with a different coefficient in each
+  *   direction.
+  * - SetJumpingDiffusion() - 7 point diffusion, where the coefficient alternates between
+  *   1 and a jump in a checkerboard of cubes.
+  * - SetElasticity() - Navier-Lame equations of linear elasticity. The three
+  *   displacements of a grid point are numbered consecutively and each pair of
+  *   neighbouring grid points is coupled by a dense 3x3 block, including its zeros.
+  * - SetConvectionDiffusion() - 7 point diffusion with first order upwind convection,
+  *   the matrix is nonsymmetric.
+  *
+  * For a GlobalMatrix, the grid is split into boxes on a process grid. The unknowns of
+  * each box are numbered consecutively, such that the global numbering depends on the
+  * process grid.
+  *
+  * SetPowerLawGraph() generates the Laplacian of a random graph with a power-law degree
+  * distribution, shifted by the identity. For a GlobalMatrix, its vertices are split
+  * into contiguous blocks of balanced size.
+  *
+  * \code{.cpp}
+  *   MatrixGenerator<ValueType> gen;
+  *
+  *   gen.SetGrid(100, 100, 100);
+  *   gen.SetLaplace(27);
+  *
+  *   LocalMatrix<ValueType> mat;
+  *   gen.Generate(&mat);
+  * \endcode
+  *
+  * \tparam ValueType - can be float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class MatrixGenerator
+    {
+    public:
+        MatrixGenerator();
+        virtual ~MatrixGenerator();
+
+        /** \brief Print the problem and its parameters */
+        void Print(void) const;
+
+        /** \brief Set the number of grid points in each direction */
+        void SetGrid(int nx, int ny, int nz);
+        /** \brief Set the process grid of a GlobalMatrix
+        * \details
+        * The product \p px * \p py * \p pz has to match the number of processes. By
+        * default, the process grid is chosen such that the boxes are close to cubes.
+        */
+        void SetProcessGrid(int px, int py, int pz);
+
+        /** \brief Laplacian with a 7 or 27 point stencil */
+        void SetLaplace(int points);
+        /** \brief Diffusion with coefficients \p eps_x, \p eps_y and \p eps_z */
+        void SetAnisotropicDiffusion(double eps_x, double eps_y, double eps_z);
+        /** \brief Diffusion with a coefficient of 1 or \p jump on cubes of \p width grid
+        * points
+        * \details
+        * The coupling between two neighbouring grid points is the harmonic mean of their
+        * coefficients.
+        */
+        void SetJumpingDiffusion(double jump, int width);
+        /** \brief Linear elasticity with Lame parameters \p lambda and \p mu */
+        void SetElasticity(double lambda, double mu);
+        /** \brief Diffusion \p eps with upwind convection (\p bx, \p by, \p bz)
+        * \details
+        * The velocity is given in units of the grid spacing, i.e. it is the cell Peclet
+        * number times \p eps.
+        */
+        void SetConvectionDiffusion(double eps, double bx, double by, double bz);
+        /** \brief Random graph with a power-law degree distribution
+        * \details
+        * The graph has \p size vertices, the probability of a vertex to have degree
+        * \f$k\f$ decays like \f$k^{-exponent}\f$, with \p exponent > 2. The average degree
+        * is approximately \p avg_degree, the degree of a vertex does not exceed
+        * \p max_degree. The generation costs are proportional to \p size * \p max_degree.
+        * The graph only depends on \p seed, not on the number of processes.
+        */
+        void SetPowerLawGraph(IndexType2         size,
+                              int                avg_degree,
+                              int                max_degree,
+                              double             exponent,
+                              unsigned long long seed);
+
+        /** \brief Generate the problem into a LocalMatrix */
+        void Generate(LocalMatrix<ValueType>* mat) const;
+        /** \brief Generate the rows of this process into a GlobalMatrix
+        * \details
+        * \p pm needs a valid MPI communicator, its sizes and communication pattern are
+        * set up by the generator.
+        */
+        void Generate(ParallelManager* pm, GlobalMatrix<ValueType>* mat) const;
+
+    private:
+        // Generates the rows of process rank out of nprocs. The interior part is returned in
+        // CSR format with local columns, the ghost part in COO format with global columns.
+        // offsets holds the first global row of each process.
+        void Assemble_(int                      rank,
+                       int                      nprocs,
+                       std::vector<IndexType2>& offsets,
+                       int**                    row_offset,
+                       int**                    col,
+                       ValueType**              val,
+                       int*                     nnz,
+                       std::vector<int>&        ghost_row,
+                       std::vector<IndexType2>& ghost_col,
+                       std::vector<ValueType>&  ghost_val) const;
+
+        int problem_;
+
+        // Grid
+        int nx_;
+        int ny_;
+        int nz_;
+
+        // Process grid
+        int px_;
+        int py_;
+        int pz_;
+
+        // Stencil points of the Laplacian
+        int points_;
+        // Cube width of the jumping coefficient
+        int width_;
+
+        // Problem coefficients
+        double coef_[4];
+
+        // Power-law graph
+        IndexType2         graph_size_;
+        int                avg_degree_;
+        int                max_degree_;
+        double             exponent_;
+        unsigned long long seed_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_MATRIX_GENERATOR_HPP_
@@ -138,6 +138,24 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Operator<ValueType>::Residual(const LocalVector<ValueType>& b,
+                                       const LocalVector<ValueType>& x,
+                                       LocalVector<ValueType>*       res) const
+    {
+        this->Apply(x, res);
+        res->ScaleAdd(static_cast<ValueType>(-1), b);
+    }
+
+    template <typename ValueType>
+    void Operator<ValueType>::Residual(const GlobalVector<ValueType>& b,
+                                       const GlobalVector<ValueType>& x,
+                                       GlobalVector<ValueType>*       res) const
+    {
+        this->Apply(x, res);
+        res->ScaleAdd(static_cast<ValueType>(-1), b);
+    }
+
     template class Operator<double>;
     template class Operator<float>;
 #ifdef SUPPORT_COMPLEX
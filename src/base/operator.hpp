@@ -100,6 +100,20 @@ namespace rocalution
         virtual void ApplyAdd(const GlobalVector<ValueType>& in,
                               ValueType                      scalar,
                               GlobalVector<ValueType>*       out) const;
+
+        /** \brief Compute the residual, res = b - Operator(x), where b, x and res are local
+      * vectors
+      */
+        virtual void Residual(const LocalVector<ValueType>& b,
+                              const LocalVector<ValueType>& x,
+                              LocalVector<ValueType>*       res) const;
+
+        /** \brief Compute the residual, res = b - Operator(x), where b, x and res are global
+      * vectors
+      */
+        virtual void Residual(const GlobalVector<ValueType>& b,
+                              const GlobalVector<ValueType>& x,
+                              GlobalVector<ValueType>*       res) const;
     };
 
 } // namespace rocalution
@@ -32,15 +32,20 @@
 #include <fstream>
 #include <limits>
 #include <sstream>
+#include <string.h>
 #include <vector>
 
 #ifdef SUPPORT_MULTINODE
+#include "../utils/communicator.hpp"
 #include <mpi.h>
 #endif
 
 namespace rocalution
 {
 
+    // Layout version of distributed files, to be increased whenever the layout changes
+    static const int distributed_file_format = 1;
+
     ParallelManager::ParallelManager()
     {
 #ifndef SUPPORT_MULTINODE
@@ -69,12 +74,26 @@ namespace rocalution
 
         this->boundary_index_ = NULL;
 
+        this->parent_       = NULL;
+        this->parent_procs_ = 0;
+        this->parent_dest_  = -1;
+        this->parent_first_ = -1;
+        this->split_comm_   = NULL;
+
         // if new values are added, also put check into status function
     }
 
     ParallelManager::~ParallelManager()
     {
         this->Clear();
+
+#ifdef SUPPORT_MULTINODE
+        if(this->split_comm_ != NULL)
+        {
+            communication_comm_free(this->split_comm_);
+            delete this->split_comm_;
+        }
+#endif
     }
 
     void ParallelManager::SetMPICommunicator(const void* comm)
@@ -88,8 +107,83 @@ namespace rocalution
 #endif
     }
 
+    void ParallelManager::SetMPICommunicator(const ParallelManager& pm, int nprocs)
+    {
+        assert(pm.Status());
+        assert(nprocs > 0 && nprocs <= pm.num_procs_);
+        assert(&pm != this);
+
+#ifdef SUPPORT_MULTINODE
+        this->Clear();
+
+        int size = pm.num_procs_;
+        int rank = pm.rank_;
+
+        // The communicator is kept, if the processes are agglomerated the same way again
+        if(this->parent_ != &pm || this->parent_procs_ != nprocs)
+        {
+            if(this->split_comm_ != NULL)
+            {
+                communication_comm_free(this->split_comm_);
+                delete this->split_comm_;
+            }
+
+            this->split_comm_ = new MComm;
+            communication_comm_split(rank < nprocs ? 0 : -1, this->split_comm_, pm.comm_);
+
+            this->parent_       = &pm;
+            this->parent_procs_ = nprocs;
+
+            if(rank < nprocs)
+            {
+                this->SetMPICommunicator(&this->split_comm_->comm);
+            }
+            else
+            {
+                this->comm_      = NULL;
+                this->rank_      = -1;
+                this->num_procs_ = -1;
+            }
+        }
+
+        std::vector<long long> sizes(size);
+        communication_allgather_single(pm.local_size_, sizes.data(), pm.comm_);
+
+        this->parent_dest_  = static_cast<int>(static_cast<long long>(rank) * nprocs / size);
+        this->parent_first_ = -1;
+        this->parent_offset_.assign(1, 0);
+
+        for(int p = 0; p < size; ++p)
+        {
+            if(static_cast<long long>(p) * nprocs / size == rank)
+            {
+                if(this->parent_first_ < 0)
+                {
+                    this->parent_first_ = p;
+                }
+
+                this->parent_offset_.push_back(this->parent_offset_.back()
+                                               + static_cast<int>(sizes[p]));
+            }
+        }
+
+        if(rank < nprocs)
+        {
+            this->global_size_ = pm.global_size_;
+            this->local_size_  = this->parent_offset_.back();
+        }
+#endif
+    }
+
+    bool ParallelManager::IsActive(void) const
+    {
+        return this->comm_ != NULL;
+    }
+
     void ParallelManager::Clear(void)
     {
+        this->ClearHaloExchange_();
+
         this->global_size_ = 0;
         this->local_size_  = 0;
 
@@ -109,15 +203,12 @@ namespace rocalution
             this->nsend_ = 0;
         }
 
-        if(this->recv_index_size_ > 0)
-        {
-            free_host(&this->boundary_index_);
-
-            this->recv_index_size_ = 0;
-        }
+        this->recv_index_size_ = 0;
 
         if(this->send_index_size_ > 0)
         {
+            free_host(&this->boundary_index_);
+
             this->send_index_size_ = 0;
         }
     }
@@ -188,6 +279,8 @@ namespace rocalution
             this->send_index_size_ = size;
         }
 
+        this->ClearHaloExchange_();
+
         allocate_host(size, &this->boundary_index_);
 
         for(int i = 0; i < size; ++i)
@@ -202,6 +295,8 @@ namespace rocalution
         assert(recvs != NULL);
         assert(recv_offset != NULL);
 
+        this->ClearHaloExchange_();
+
         this->nrecv_ = nrecv;
 
         allocate_host(nrecv, &this->recvs_);
@@ -224,6 +319,8 @@ namespace rocalution
         assert(sends != NULL);
         assert(send_offset != NULL);
 
+        this->ClearHaloExchange_();
+
         this->nsend_ = nsend;
 
         allocate_host(nsend, &this->sends_);
@@ -247,6 +344,151 @@ namespace rocalution
         }
     }
 
+    void ParallelManager::SetGhostGlobalIndex_(int               size,
+                                               const IndexType2* ghost,
+                                               const IndexType2* offsets)
+    {
+        assert(size >= 0);
+        assert(offsets != NULL);
+        assert(this->comm_ != NULL);
+
+#ifdef SUPPORT_MULTINODE
+        // Number of ghost unknowns owned by each process
+        std::vector<int> recv_count(this->num_procs_, 0);
+
+        for(int i = 0; i < size; ++i)
+        {
+            assert(i == 0 || ghost[i] > ghost[i - 1]);
+
+            int owner = static_cast<int>(
+                std::upper_bound(offsets, offsets + this->num_procs_ + 1, ghost[i]) - offsets - 1);
+
+            assert(owner >= 0 && owner < this->num_procs_);
+            assert(owner != this->rank_);
+
+            ++recv_count[owner];
+        }
+
+        // Number of boundary unknowns requested by each process
+        std::vector<int> send_count(this->num_procs_);
+
+        communication_alltoall_single(recv_count.data(), send_count.data(), this->comm_);
+
+        std::vector<int> recvs;
+        std::vector<int> sends;
+        std::vector<int> recv_offset(1, 0);
+        std::vector<int> send_offset(1, 0);
+
+        for(int p = 0; p < this->num_procs_; ++p)
+        {
+            if(recv_count[p] > 0)
+            {
+                recvs.push_back(p);
+                recv_offset.push_back(recv_offset.back() + recv_count[p]);
+            }
+
+            if(send_count[p] > 0)
+            {
+                sends.push_back(p);
+                send_offset.push_back(send_offset.back() + send_count[p]);
+            }
+        }
+
+        int nrecv = static_cast<int>(recvs.size());
+        int nsend = static_cast<int>(sends.size());
+
+        // The ghost ids are sent to their owners, which send the values in this order
+        std::vector<IndexType2> boundary(send_offset.back());
+        std::vector<MRequest>   req(nrecv + nsend);
+
+        for(int n = 0; n < nsend; ++n)
+        {
+            communication_async_recv(boundary.data() + send_offset[n],
+                                     send_offset[n + 1] - send_offset[n],
+                                     sends[n],
+                                     0,
+                                     &req[n],
+                                     this->comm_);
+        }
+
+        for(int n = 0; n < nrecv; ++n)
+        {
+            communication_async_send(const_cast<IndexType2*>(ghost) + recv_offset[n],
+                                     recv_offset[n + 1] - recv_offset[n],
+                                     recvs[n],
+                                     0,
+                                     &req[nsend + n],
+                                     this->comm_);
+        }
+
+        if(nrecv + nsend > 0)
+        {
+            communication_syncall(nrecv + nsend, req.data());
+        }
+
+        std::vector<int> boundary_index(boundary.size());
+
+        for(size_t i = 0; i < boundary.size(); ++i)
+        {
+            assert(boundary[i] >= offsets[this->rank_]);
+            assert(boundary[i] < offsets[this->rank_ + 1]);
+
+            boundary_index[i] = static_cast<int>(boundary[i] - offsets[this->rank_]);
+        }
+
+        if(nsend > 0)
+        {
+            this->SetBoundaryIndex(static_cast<int>(boundary_index.size()), boundary_index.data());
+            this->SetSenders(nsend, sends.data(), send_offset.data());
+        }
+
+        if(nrecv > 0)
+        {
+            this->SetReceivers(nrecv, recvs.data(), recv_offset.data());
+        }
+#endif
+    }
+
+    HaloExchange* ParallelManager::GetHaloExchange_(int elem_size) const
+    {
+        assert(this->Status() == true);
+
+#ifdef SUPPORT_MULTINODE
+        for(size_t i = 0; i < this->halo_.size(); ++i)
+        {
+            if(this->halo_[i]->GetElementSize() == elem_size)
+            {
+                return this->halo_[i];
+            }
+        }
+
+        this->halo_.push_back(new HaloExchange(elem_size,
+                                               this->nrecv_,
+                                               this->recvs_,
+                                               this->recv_offset_index_,
+                                               this->nsend_,
+                                               this->sends_,
+                                               this->send_offset_index_,
+                                               this->comm_));
+
+        return this->halo_.back();
+#else
+        return NULL;
+#endif
+    }
+
+    void ParallelManager::ClearHaloExchange_(void)
+    {
+#ifdef SUPPORT_MULTINODE
+        for(size_t i = 0; i < this->halo_.size(); ++i)
+        {
+            delete this->halo_[i];
+        }
+#endif
+
+        this->halo_.clear();
+    }
+
     bool ParallelManager::Status(void) const
     {
         // clang-format off
@@ -262,7 +504,7 @@ namespace rocalution
     if(this->nsend_ > 0 && this->send_offset_index_ == NULL) return false;
     if(this->recv_index_size_ < 0) return false;
     if(this->send_index_size_ < 0) return false;
-    if(this->recv_index_size_ > 0 && this->boundary_index_ == NULL) return false;
+    if(this->send_index_size_ > 0 && this->boundary_index_ == NULL) return false;
         // clang-format on
 
         return true;
@@ -410,7 +652,11 @@ namespace rocalution
             FATAL_ERROR(__FILE__, __LINE__);
         }
 
+        // The halo exchanges of the previous communication pattern are set up on its
+        // buffers, thus they are freed before the pattern is rebuilt
+        this->ClearHaloExchange_();
         this->Clear();
+
         int rank = -1;
 
         while(!file.eof())
@@ -505,4 +751,202 @@ namespace rocalution
         LOG_INFO("ReadFileASCII: filename=" << filename << "; done");
     }
 
+    void ParallelManager::ReadFileDistributed(const std::string filename)
+    {
+        log_debug(this, "ParallelManager::ReadFileDistributed()", filename);
+
+        assert(this->comm_ != NULL);
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; reading...");
+
+        this->ClearHaloExchange_();
+        this->Clear();
+
+#ifdef SUPPORT_MULTINODE
+        // The parallel manager data is stored at the start of each block of a matrix file
+        MFile     file;
+        long long offset = this->OpenFileDistributed_(
+            filename, "#rocALUTION distributed matrix", false, 0, &file);
+
+        // Sizes
+        long long info[6];
+        communication_file_read_at(&file, offset, info, sizeof(info));
+        offset += sizeof(info);
+
+        int nrecv           = static_cast<int>(info[2]);
+        int nsend           = static_cast<int>(info[3]);
+        int recv_index_size = static_cast<int>(info[4]);
+        int send_index_size = static_cast<int>(info[5]);
+
+        std::vector<int> recvs(nrecv);
+        std::vector<int> recv_offset(nrecv + 1);
+        std::vector<int> sends(nsend);
+        std::vector<int> send_offset(nsend + 1);
+        std::vector<int> boundary_index(send_index_size);
+
+        communication_file_read_at(&file, offset, recvs.data(), sizeof(int) * nrecv);
+        offset += sizeof(int) * nrecv;
+        communication_file_read_at(&file, offset, recv_offset.data(), sizeof(int) * (nrecv + 1));
+        offset += sizeof(int) * (nrecv + 1);
+        communication_file_read_at(&file, offset, sends.data(), sizeof(int) * nsend);
+        offset += sizeof(int) * nsend;
+        communication_file_read_at(&file, offset, send_offset.data(), sizeof(int) * (nsend + 1));
+        offset += sizeof(int) * (nsend + 1);
+        communication_file_read_at(
+            &file, offset, boundary_index.data(), sizeof(int) * send_index_size);
+
+        communication_file_close(&file);
+
+        this->SetGlobalSize(static_cast<IndexType2>(info[0]));
+        this->SetLocalSize(static_cast<int>(info[1]));
+
+        if(nrecv > 0)
+        {
+            this->SetReceivers(nrecv, recvs.data(), recv_offset.data());
+        }
+
+        if(nsend > 0)
+        {
+            this->SetSenders(nsend, sends.data(), send_offset.data());
+            this->SetBoundaryIndex(send_index_size, boundary_index.data());
+        }
+
+        assert(this->recv_index_size_ == recv_index_size);
+#endif
+
+        if(this->Status() == false)
+        {
+            LOG_INFO("Incomplete ParallelManager file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        LOG_INFO("ReadFileDistributed: filename=" << filename << "; done");
+    }
+
+    long long ParallelManager::OpenFileDistributed_(const std::string& filename,
+                                                    const char*        id,
+                                                    bool               write,
+                                                    long long          size,
+                                                    MFile*             file) const
+    {
+        assert(this->comm_ != NULL);
+        assert(strlen(id) < 32);
+
+        long long offset = 0;
+
+#ifdef SUPPORT_MULTINODE
+        communication_file_open(filename, write, file, this->comm_);
+
+        if(write == true)
+        {
+            // Exclusive prefix sum over the block sizes of all processes
+            std::vector<long long> offsets(this->num_procs_ + 1);
+
+            communication_allgather_single(size, offsets.data() + 1, this->comm_);
+
+            offsets[0] = 32 + 2 * sizeof(int) + sizeof(long long) * (this->num_procs_ + 1);
+
+            for(int i = 0; i < this->num_procs_; ++i)
+            {
+                offsets[i + 1] += offsets[i];
+            }
+
+            if(this->rank_ == 0)
+            {
+                char header[32] = {};
+                int  info[2]    = {distributed_file_format, this->num_procs_};
+
+                strncpy(header, id, sizeof(header) - 1);
+
+                communication_file_write_at(file, 0, header, sizeof(header));
+                communication_file_write_at(file, sizeof(header), info, sizeof(info));
+                communication_file_write_at(file,
+                                            sizeof(header) + sizeof(info),
+                                            offsets.data(),
+                                            sizeof(long long) * (this->num_procs_ + 1));
+            }
+
+            offset = offsets[this->rank_];
+        }
+        else
+        {
+            char header[32];
+            int  info[2];
+
+            communication_file_read_at(file, 0, header, sizeof(header));
+            communication_file_read_at(file, sizeof(header), info, sizeof(info));
+
+            if(strncmp(header, id, sizeof(header)) != 0)
+            {
+                LOG_INFO("ReadFileDistributed: filename=" << filename << "; invalid header");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(info[0] != distributed_file_format)
+            {
+                LOG_INFO("ReadFileDistributed: filename=" << filename << " has file format "
+                                                          << info[0] << ", expected "
+                                                          << distributed_file_format);
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            if(info[1] != this->num_procs_)
+            {
+                LOG_INFO("ReadFileDistributed: filename=" << filename << " was written by "
+                                                          << info[1] << " processes");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            communication_file_read_at(file,
+                                       sizeof(header) + sizeof(info)
+                                           + sizeof(long long) * this->rank_,
+                                       &offset,
+                                       sizeof(long long));
+        }
+#endif
+
+        return offset;
+    }
+
+    long long ParallelManager::SizeFileDistributed_(void) const
+    {
+        return 6 * sizeof(long long)
+               + sizeof(int) * (2 * this->nrecv_ + 2 * this->nsend_ + 2 + this->send_index_size_);
+    }
+
+    long long ParallelManager::WriteFileDistributed_(MFile* file, long long offset) const
+    {
+        assert(this->Status());
+
+#ifdef SUPPORT_MULTINODE
+        long long info[6] = {this->global_size_,
+                             this->local_size_,
+                             this->nrecv_,
+                             this->nsend_,
+                             this->recv_index_size_,
+                             this->send_index_size_};
+
+        // The offset arrays are not allocated without neighbours
+        int        zero        = 0;
+        const int* recv_offset = (this->nrecv_ > 0) ? this->recv_offset_index_ : &zero;
+        const int* send_offset = (this->nsend_ > 0) ? this->send_offset_index_ : &zero;
+
+        communication_file_write_at(file, offset, info, sizeof(info));
+        offset += sizeof(info);
+        communication_file_write_at(file, offset, this->recvs_, sizeof(int) * this->nrecv_);
+        offset += sizeof(int) * this->nrecv_;
+        communication_file_write_at(file, offset, recv_offset, sizeof(int) * (this->nrecv_ + 1));
+        offset += sizeof(int) * (this->nrecv_ + 1);
+        communication_file_write_at(file, offset, this->sends_, sizeof(int) * this->nsend_);
+        offset += sizeof(int) * this->nsend_;
+        communication_file_write_at(file, offset, send_offset, sizeof(int) * (this->nsend_ + 1));
+        offset += sizeof(int) * (this->nsend_ + 1);
+        communication_file_write_at(
+            file, offset, this->boundary_index_, sizeof(int) * this->send_index_size_);
+        offset += sizeof(int) * this->send_index_size_;
+#endif
+
+        return offset;
+    }
+
 } // namespace rocalution
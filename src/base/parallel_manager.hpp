@@ -29,6 +29,7 @@
 
 #include <complex>
 #include <string>
+#include <vector>
 
 namespace rocalution
 {
@@ -37,6 +38,12 @@ namespace rocalution
     class GlobalMatrix;
     template <typename ValueType>
     class GlobalVector;
+    template <typename ValueType>
+    class MatrixGenerator;
+
+    struct MFile;
+    struct MComm;
+    class HaloExchange;
 
     /** \ingroup backend_module
   * \brief Parallel Manager class
@@ -55,6 +62,16 @@ namespace rocalution
 
         /** \brief Set the MPI communicator */
         void SetMPICommunicator(const void* comm);
+        /** \brief Set the communicator to the first \p nprocs processes of \p pm
+      * \details
+      * The rows of process \f$p\f$ of \p pm are agglomerated onto process
+      * \f$\lfloor p \cdot nprocs / P \rfloor\f$, where \f$P\f$ is the number of processes
+      * of \p pm, such that the global numbering is preserved. The new communicator is
+      * split from the one of \p pm, this is collective on \p pm. The remaining processes
+      * are not part of it, see IsActive(). The communication pattern is set up by
+      * GlobalMatrix::Agglomerate().
+      */
+        void SetMPICommunicator(const ParallelManager& pm, int nprocs);
         /** \brief Clear all allocated resources */
         void Clear(void);
 
@@ -97,13 +114,50 @@ namespace rocalution
 
         /** \brief Check sanity status of parallel manager */
         bool Status(void) const;
+        /** \brief Return true, if the current process is part of the communicator */
+        bool IsActive(void) const;
 
         /** \brief Read file that contains all relevant parallel manager data */
         void ReadFileASCII(const std::string filename);
         /** \brief Write file that contains all relevant parallel manager data */
         void WriteFileASCII(const std::string filename) const;
+        /** \brief Read the parallel manager data from a distributed matrix file
+      * \details
+      * The file has to be written by GlobalMatrix::WriteFileDistributed() with the same
+      * number of processes. Each process only reads its own block of the file.
+      */
+        void ReadFileDistributed(const std::string filename);
 
     private:
+        // Opens a distributed file with identifier id and returns the byte offset of the
+        // block of this process. The file starts with the identifier, the file format
+        // version, the number of processes and the byte offsets of all blocks. For writing,
+        // size is the block size of this process and the header is written by the master
+        // rank.
+        long long OpenFileDistributed_(const std::string& filename,
+                                       const char*        id,
+                                       bool               write,
+                                       long long          size,
+                                       MFile*             file) const;
+        // Size of the parallel manager data at the start of a matrix block
+        long long SizeFileDistributed_(void) const;
+        // Writes the parallel manager data at offset and returns the offset behind it
+        long long WriteFileDistributed_(MFile* file, long long offset) const;
+
+        // Sets up the communication pattern from the global ids of the ghost unknowns,
+        // which have to be sorted in ascending order. offsets holds the first global id
+        // of each process. The owners are asked for their boundary unknowns, such that
+        // this is collective.
+        void SetGhostGlobalIndex_(int size, const IndexType2* ghost, const IndexType2* offsets);
+
+        // Returns the persistent exchange of the ghost values for values of elem_size
+        // bytes, it is set up on first use. There is only one exchange per value size,
+        // thus two ghost updates of the same value size on this manager must not overlap,
+        // i.e. an update has to be completed before the next one is started.
+        HaloExchange* GetHaloExchange_(int elem_size) const;
+        // Frees the ghost value exchanges, e.g. if the communication pattern changes
+        void ClearHaloExchange_(void);
+
         const void* comm_;
         int         rank_;
         int         num_procs_;
@@ -134,6 +188,22 @@ namespace rocalution
         // Boundary index ids
         int* boundary_index_;
 
+        // Ghost value exchanges for the different value sizes
+        mutable std::vector<HaloExchange*> halo_;
+
+        // Parallel manager, the processes are agglomerated from, and the number of
+        // processes they are agglomerated onto
+        const ParallelManager* parent_;
+        int                    parent_procs_;
+        // Process of the parent, the rows of this process are sent to
+        int parent_dest_;
+        // Processes of the parent, this process receives the rows from, they start at
+        // parent_first_ and their rows start at the offsets
+        int              parent_first_;
+        std::vector<int> parent_offset_;
+        // Communicator of the agglomerated processes
+        MComm* split_comm_;
+
         friend class GlobalMatrix<double>;
         friend class GlobalMatrix<float>;
         friend class GlobalMatrix<std::complex<double>>;
@@ -143,6 +213,10 @@ namespace rocalution
         friend class GlobalVector<std::complex<double>>;
         friend class GlobalVector<std::complex<float>>;
         friend class GlobalVector<int>;
+        friend class MatrixGenerator<double>;
+        friend class MatrixGenerator<float>;
+        friend class MatrixGenerator<std::complex<double>>;
+        friend class MatrixGenerator<std::complex<float>>;
     };
 
 } // namespace rocalution
@@ -27,11 +27,78 @@
 #include "global_vector.hpp"
 #include "local_vector.hpp"
 
+#ifdef SUPPORT_MULTINODE
+#include "../utils/communicator.hpp"
+#endif
+
 #include <complex>
 
 namespace rocalution
 {
 
+    template <typename ValueType>
+    DotFuture<ValueType>::DotFuture()
+    {
+        this->local_   = static_cast<ValueType>(0);
+        this->value_   = static_cast<ValueType>(0);
+        this->pending_ = false;
+        this->reduce_  = false;
+        this->request_ = NULL;
+    }
+
+    template <typename ValueType>
+    DotFuture<ValueType>::~DotFuture()
+    {
+        // A reduction in flight has to be completed, before its buffers are released
+        this->Wait_();
+
+#ifdef SUPPORT_MULTINODE
+        delete this->request_;
+#endif
+    }
+
+    template <typename ValueType>
+    void DotFuture<ValueType>::Start_(ValueType local, const void* comm)
+    {
+        assert(this->pending_ == false);
+
+        this->local_   = local;
+        this->pending_ = true;
+
+#ifdef SUPPORT_MULTINODE
+        if(comm != NULL)
+        {
+            if(this->request_ == NULL)
+            {
+                this->request_ = new MRequest;
+            }
+
+            communication_async_allreduce_single_sum(
+                &this->local_, &this->value_, this->request_, comm);
+
+            this->reduce_ = true;
+
+            return;
+        }
+#endif
+
+        this->value_ = local;
+    }
+
+    template <typename ValueType>
+    void DotFuture<ValueType>::Wait_(void)
+    {
+#ifdef SUPPORT_MULTINODE
+        if(this->reduce_ == true)
+        {
+            communication_syncall(1, this->request_);
+            this->reduce_ = false;
+        }
+#endif
+
+        this->pending_ = false;
+    }
+
     template <typename ValueType>
     Vector<ValueType>::Vector()
     {
@@ -264,6 +331,67 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template <typename ValueType>
+    void Vector<ValueType>::DotBegin(const LocalVector<ValueType>& x,
+                                     DotFuture<ValueType>*         dot) const
+    {
+        LOG_INFO("Vector<ValueType>::DotBegin(const LocalVector<ValueType>& x, "
+                 "DotFuture<ValueType>* dot) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotBegin(const GlobalVector<ValueType>& x,
+                                     DotFuture<ValueType>*          dot) const
+    {
+        LOG_INFO("Vector<ValueType>::DotBegin(const GlobalVector<ValueType>& x, "
+                 "DotFuture<ValueType>* dot) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotNonConjBegin(const LocalVector<ValueType>& x,
+                                            DotFuture<ValueType>*         dot) const
+    {
+        LOG_INFO("Vector<ValueType>::DotNonConjBegin(const LocalVector<ValueType>& x, "
+                 "DotFuture<ValueType>* dot) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    void Vector<ValueType>::DotNonConjBegin(const GlobalVector<ValueType>& x,
+                                            DotFuture<ValueType>*          dot) const
+    {
+        LOG_INFO("Vector<ValueType>::DotNonConjBegin(const GlobalVector<ValueType>& x, "
+                 "DotFuture<ValueType>* dot) const");
+        LOG_INFO("Mismatched types:");
+        this->Info();
+        x.Info();
+        FATAL_ERROR(__FILE__, __LINE__);
+    }
+
+    template <typename ValueType>
+    ValueType Vector<ValueType>::DotEnd(DotFuture<ValueType>* dot) const
+    {
+        log_debug(this, "Vector::DotEnd()", dot);
+
+        assert(dot != NULL);
+        assert(dot->pending_ == true);
+
+        dot->Wait_();
+
+        return dot->value_;
+    }
+
     template <typename ValueType>
     void Vector<ValueType>::PointWiseMult(const LocalVector<ValueType>& x)
     {
@@ -368,6 +496,15 @@ namespace rocalution
         FATAL_ERROR(__FILE__, __LINE__);
     }
 
+    template class DotFuture<double>;
+    template class DotFuture<float>;
+#ifdef SUPPORT_COMPLEX
+    template class DotFuture<std::complex<double>>;
+    template class DotFuture<std::complex<float>>;
+#endif
+
+    template class DotFuture<int>;
+
     template class Vector<double>;
     template class Vector<float>;
 #ifdef SUPPORT_COMPLEX
@@ -38,6 +38,57 @@ namespace rocalution
     class GlobalVector;
     template <typename ValueType>
     class LocalVector;
+    template <typename ValueType>
+    class Vector;
+
+    struct MRequest;
+
+    /** \ingroup op_vec_module
+  * \class DotFuture
+  * \brief Pending dot (scalar) product
+  * \details
+  * A DotFuture holds a dot product, that has been started by Vector::DotBegin() or
+  * Vector::DotNonConjBegin() and is completed by Vector::DotEnd(). For global vectors,
+  * the reduction over all processes is in flight in between, such that it can be
+  * overlapped with independent work, e.g. vector updates or a matrix-vector product.
+  * Started dot products have to be completed in the same order on all processes. A
+  * future can be reused, once it is completed.
+  *
+  * \tparam ValueType - can be int, float, double, std::complex<float> and
+  *                     std::complex<double>
+  */
+    template <typename ValueType>
+    class DotFuture
+    {
+    public:
+        DotFuture();
+        ~DotFuture();
+
+    private:
+        // Starts the reduction of the local result over the processes of comm, or sets
+        // the result right away, if there is no communicator
+        void Start_(ValueType local, const void* comm);
+        // Completes the reduction
+        void Wait_(void);
+
+        // Local and reduced result, buffers of the reduction in flight
+        ValueType local_;
+        ValueType value_;
+
+        // Started and not completed yet
+        bool pending_;
+        // Reduction in flight
+        bool reduce_;
+        MRequest* request_;
+
+        // Not copyable, the reduction in flight refers to the buffers
+        DotFuture(const DotFuture<ValueType>&);
+        DotFuture<ValueType>& operator=(const DotFuture<ValueType>&);
+
+        friend class Vector<ValueType>;
+        friend class LocalVector<ValueType>;
+        friend class GlobalVector<ValueType>;
+    };
 
     /** \ingroup op_vec_module
   * \class Vector
@@ -329,6 +380,40 @@ namespace rocalution
         /** \brief Compute non-conjugate dot (scalar) product, return this^T y */
         virtual ValueType DotNonConj(const GlobalVector<ValueType>& x) const;
 
+        /** \brief Start the dot (scalar) product this^T x, completed by DotEnd() */
+        virtual void DotBegin(const LocalVector<ValueType>& x, DotFuture<ValueType>* dot) const;
+        /** \brief Start the dot (scalar) product this^T x, completed by DotEnd() */
+        virtual void DotBegin(const GlobalVector<ValueType>& x, DotFuture<ValueType>* dot) const;
+
+        /** \brief Start the non-conjugate dot (scalar) product this^T x, completed by
+      * DotEnd()
+      */
+        virtual void DotNonConjBegin(const LocalVector<ValueType>& x,
+                                     DotFuture<ValueType>*         dot) const;
+        /** \brief Start the non-conjugate dot (scalar) product this^T x, completed by
+      * DotEnd()
+      */
+        virtual void DotNonConjBegin(const GlobalVector<ValueType>& x,
+                                     DotFuture<ValueType>*          dot) const;
+
+        /** \brief Complete a dot product, started by DotBegin() or DotNonConjBegin(), and
+      * return its result
+      * \par Example
+      * \code{.cpp}
+      *   DotFuture<ValueType> dot;
+      *
+      *   // Start the dot product
+      *   vec1.DotBegin(vec2, &dot);
+      *
+      *   // Work that is independent of the dot product
+      *   vec3.AddScale(vec4, alpha);
+      *
+      *   // Complete the dot product
+      *   ValueType result = vec1.DotEnd(&dot);
+      * \endcode
+      */
+        ValueType DotEnd(DotFuture<ValueType>* dot) const;
+
         /** \brief Compute \f$L_2\f$ norm of the vector, return = srqt(this^T this) */
         virtual ValueType Norm(void) const = 0;
 
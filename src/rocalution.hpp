@@ -46,6 +46,8 @@
 #include "base/local_stencil.hpp"
 #include "base/stencil_types.hpp"
 
+#include "base/matrix_generator.hpp"
+
 #include "solvers/chebyshev.hpp"
 #include "solvers/direct/inversion.hpp"
 #include "solvers/direct/lu.hpp"
@@ -64,6 +66,8 @@
 #include "solvers/multigrid/base_amg.hpp"
 #include "solvers/multigrid/base_multigrid.hpp"
 #include "solvers/multigrid/global_pairwise_amg.hpp"
+#include "solvers/multigrid/global_smoothed_amg.hpp"
+#include "solvers/multigrid/global_agglomeration.hpp"
 #include "solvers/multigrid/multigrid.hpp"
 #include "solvers/multigrid/pairwise_amg.hpp"
 #include "solvers/multigrid/ruge_stueben_amg.hpp"
@@ -76,6 +80,7 @@
 #include "solvers/preconditioners/preconditioner_as.hpp"
 #include "solvers/preconditioners/preconditioner_blockjacobi.hpp"
 #include "solvers/preconditioners/preconditioner_blockprecond.hpp"
+#include "solvers/preconditioners/preconditioner_global_ras.hpp"
 #include "solvers/preconditioners/preconditioner_multicolored.hpp"
 #include "solvers/preconditioners/preconditioner_multicolored_gs.hpp"
 #include "solvers/preconditioners/preconditioner_multicolored_ilu.hpp"
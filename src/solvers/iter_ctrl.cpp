@@ -26,7 +26,9 @@
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
 
+#include <algorithm>
 #include <complex>
+#include <cstdio>
 #include <cstdlib>
 #include <fstream>
 #include <limits>
@@ -35,6 +37,9 @@
 namespace rocalution
 {
 
+    // Layout version of iteration state files, to be increased whenever the layout changes
+    static const int state_file_format = 1;
+
     IterationControl::IterationControl()
     {
         this->residual_history_.clear();
@@ -42,9 +47,12 @@ namespace rocalution
 
         this->init_res_ = false;
         this->rec_      = false;
+        this->resume_   = false;
         this->verb_     = 1;
         this->reached_  = 0;
 
+        this->checkpoint_freq_ = 0;
+
         this->initial_residual_ = 0.0;
         this->current_res_      = 0.0;
         this->current_index_    = -1;
@@ -67,6 +75,7 @@ namespace rocalution
         this->iteration_ = 0;
 
         this->init_res_ = false;
+        this->resume_   = false;
         this->reached_  = 0;
 
         this->current_res_   = 0.0;
@@ -88,20 +97,34 @@ namespace rocalution
 
     bool IterationControl::InitResidual(double res)
     {
-        this->init_res_         = true;
-        this->initial_residual_ = res;
-
-        this->reached_   = 0;
-        this->iteration_ = 0;
+        this->init_res_ = true;
+        this->reached_  = 0;
 
-        if(this->verb_ > 0)
+        if(this->resume_ == true)
         {
-            LOG_INFO("IterationControl initial residual = " << res);
-        }
+            // Continue from the state read, relative to its initial residual
+            this->resume_ = false;
 
-        if(this->rec_ == true)
+            if(this->verb_ > 0)
+            {
+                LOG_INFO("IterationControl resumed at iter=" << this->iteration_
+                                                             << "; residual=" << res);
+            }
+        }
+        else
         {
-            this->residual_history_.push_back(res);
+            this->initial_residual_ = res;
+            this->iteration_        = 0;
+
+            if(this->verb_ > 0)
+            {
+                LOG_INFO("IterationControl initial residual = " << res);
+            }
+
+            if(this->rec_ == true)
+            {
+                this->residual_history_.push_back(res);
+            }
         }
 
         if((std::abs(res) == std::numeric_limits<double>::infinity()) || // infinity
@@ -244,6 +267,11 @@ namespace rocalution
             return true;
         }
 
+        if(this->checkpoint_freq_ > 0 && this->iteration_ % this->checkpoint_freq_ == 0)
+        {
+            this->checkpoint_();
+        }
+
         return false;
     }
 
@@ -322,7 +350,9 @@ namespace rocalution
 
         file.setf(std::ios::scientific);
 
-        for(int n = 0; n < this->iteration_; n++)
+        int size = std::min(this->iteration_, static_cast<int>(this->residual_history_.size()));
+
+        for(int n = 0; n < size; n++)
         {
             file << this->residual_history_[n] << std::endl;
         }
@@ -332,6 +362,113 @@ namespace rocalution
         LOG_INFO("Writing residual history to filename = " << filename << "; done");
     }
 
+    void IterationControl::WriteStateToFile(const std::string filename) const
+    {
+        // The file is written under a temporary name and renamed, once it is complete
+        std::string tmp = filename + ".tmp";
+
+        std::ofstream out(tmp.c_str(), std::ios::out | std::ios::binary);
+
+        if(!out.is_open())
+        {
+            LOG_INFO("WriteStateToFile: filename=" << filename << "; cannot open file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header
+        out << "#rocALUTION binary iteration state file" << std::endl;
+
+        // File format version
+        int format = state_file_format;
+        out.write((char*)&format, sizeof(int));
+
+        int size = static_cast<int>(this->residual_history_.size());
+
+        out.write((char*)&this->iteration_, sizeof(int));
+        out.write((char*)&this->initial_residual_, sizeof(double));
+        out.write((char*)&this->current_res_, sizeof(double));
+        out.write((char*)&size, sizeof(int));
+        out.write((char*)this->residual_history_.data(), sizeof(double) * size);
+
+        // Check ofstream status
+        if(!out)
+        {
+            LOG_INFO("WriteStateToFile: filename=" << filename << "; could not write to file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        out.close();
+
+        if(std::rename(tmp.c_str(), filename.c_str()) != 0)
+        {
+            LOG_INFO("WriteStateToFile: filename=" << filename << "; cannot rename file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    void IterationControl::ReadStateFromFile(const std::string filename)
+    {
+        std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+
+        if(!in.is_open())
+        {
+            LOG_INFO("ReadStateFromFile: filename=" << filename << "; cannot open file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // Header
+        std::string header;
+        std::getline(in, header);
+
+        if(header != "#rocALUTION binary iteration state file")
+        {
+            LOG_INFO("ReadStateFromFile: filename=" << filename
+                                                    << " is not a rocALUTION iteration state");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        // File format version
+        int format;
+        in.read((char*)&format, sizeof(int));
+
+        if(format != state_file_format)
+        {
+            LOG_INFO("ReadStateFromFile: filename=" << filename << "; unsupported state format "
+                                                    << format);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        int size;
+
+        in.read((char*)&this->iteration_, sizeof(int));
+        in.read((char*)&this->initial_residual_, sizeof(double));
+        in.read((char*)&this->current_res_, sizeof(double));
+        in.read((char*)&size, sizeof(int));
+
+        this->residual_history_.resize(size);
+        in.read((char*)this->residual_history_.data(), sizeof(double) * size);
+
+        // Check ifstream status
+        if(!in)
+        {
+            LOG_INFO("ReadStateFromFile: filename=" << filename << "; could not read from file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        in.close();
+
+        this->resume_  = true;
+        this->reached_ = 0;
+    }
+
+    void IterationControl::SetCheckpoint(int freq, std::function<void(void)> checkpoint)
+    {
+        assert(freq >= 0);
+
+        this->checkpoint_freq_ = freq;
+        this->checkpoint_      = checkpoint;
+    }
+
     void IterationControl::PrintInit(void)
     {
         if(this->minimum_iter_ > 0)
@@ -24,6 +24,7 @@
 #ifndef ROCALUTION_ITER_CTRL_HPP_
 #define ROCALUTION_ITER_CTRL_HPP_
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -84,6 +85,17 @@ namespace rocalution
         // Write the history of the residual to an ASCII file
         void WriteHistoryToFile(const std::string filename) const;
 
+        // Write the iteration count, the initial and current residual and the history of
+        // the residual to a binary file
+        void WriteStateToFile(const std::string filename) const;
+
+        // Read a state written by WriteStateToFile(), the next call of InitResidual()
+        // continues the iteration count and keeps the initial residual
+        void ReadStateFromFile(const std::string filename);
+
+        // Call checkpoint every freq iterations (0 disables the checkpoints)
+        void SetCheckpoint(int freq, std::function<void(void)> checkpoint);
+
         // Provide verbose output of the solver (iter, residual)
         void Verbose(int verb = 1);
 
@@ -151,6 +163,13 @@ namespace rocalution
 
         // Flag == true then the residual is recorded in the residual_history_ vector
         bool rec_;
+
+        // Flag == true after reading a state, until the next call of InitResidual()
+        bool resume_;
+
+        // Checkpoint frequency and function
+        int                       checkpoint_freq_;
+        std::function<void(void)> checkpoint_;
     };
 
 } // namespace rocalution
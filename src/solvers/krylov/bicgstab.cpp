@@ -268,6 +268,11 @@ namespace rocalution
         ValueType rho;
         ValueType rho_old;
 
+        DotFuture<ValueType> res_dot;
+        DotFuture<ValueType> rho_dot;
+        DotFuture<ValueType> tr_dot;
+        DotFuture<ValueType> tt_dot;
+
         // Inital residual r0 = b - Ax
         op->Apply(*x, r0);
         r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -282,15 +287,17 @@ namespace rocalution
             return;
         }
 
+        // rho = <r0,r0>, overlapped with r = p = r0
+        r0->DotBegin(*r0, &rho_dot);
+
         // r = r0
         r->CopyFrom(*r0);
 
-        // rho = <r,r>
-        rho = r->Dot(*r);
-
         // p = r
         p->CopyFrom(*r);
 
+        rho = r0->DotEnd(&rho_dot);
+
         while(true)
         {
             // q = Ap
@@ -306,7 +313,9 @@ namespace rocalution
             op->Apply(*r, t);
 
             // omega = <t,r> / <t,t>
-            omega = t->Dot(*r) / t->Dot(*t);
+            t->DotBegin(*r, &tr_dot);
+            t->DotBegin(*t, &tt_dot);
+            omega = t->DotEnd(&tr_dot) / t->DotEnd(&tt_dot);
 
             if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
                || (omega == static_cast<ValueType>(0)))
@@ -334,17 +343,21 @@ namespace rocalution
             // r = r - omega * t
             r->AddScale(*t, -omega);
 
+            // Residual norm and rho = <r0,r> are reduced together
+            this->NormBegin_(*r, &res_dot);
+            r0->DotBegin(*r, &rho_dot);
+
+            res_norm = this->NormEnd_(*r, &res_dot);
+
+            rho_old = rho;
+            rho     = r0->DotEnd(&rho_dot);
+
             // Check convergence
-            res_norm = this->Norm_(*r);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
             }
 
-            // rho = <r0,r>
-            rho_old = rho;
-            rho     = r0->Dot(*r);
-
             // Check rho for zero
             if(rho == static_cast<ValueType>(0))
             {
@@ -390,6 +403,11 @@ namespace rocalution
         ValueType rho;
         ValueType rho_old;
 
+        DotFuture<ValueType> res_dot;
+        DotFuture<ValueType> rho_dot;
+        DotFuture<ValueType> tr_dot;
+        DotFuture<ValueType> tt_dot;
+
         // Initial residual = b - Ax
         op->Apply(*x, r0);
         r0->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -404,16 +422,18 @@ namespace rocalution
             return;
         }
 
+        // rho = <r0,r0>, overlapped with r = p = r0 and Mz = r
+        r0->DotBegin(*r0, &rho_dot);
+
         // p = r = r0
         r->CopyFrom(*r0);
         p->CopyFrom(*r);
 
-        // rho = <r,r>
-        rho = r->Dot(*r);
-
         // Mz = r
         this->precond_->SolveZeroSol(*r, z);
 
+        rho = r0->DotEnd(&rho_dot);
+
         while(true)
         {
             // q = Az
@@ -432,7 +452,9 @@ namespace rocalution
             op->Apply(*v, t);
 
             // omega = (t,r) / (t,t)
-            omega = t->Dot(*r) / t->Dot(*t);
+            t->DotBegin(*r, &tr_dot);
+            t->DotBegin(*t, &tt_dot);
+            omega = t->DotEnd(&tr_dot) / t->DotEnd(&tt_dot);
 
             if((std::abs(omega) == std::numeric_limits<ValueType>::infinity()) || (omega != omega)
                || (omega == static_cast<ValueType>(0)))
@@ -459,17 +481,21 @@ namespace rocalution
             // r = r - omega * t
             r->AddScale(*t, -omega);
 
+            // Residual norm and rho = <r0,r> are reduced together
+            this->NormBegin_(*r, &res_dot);
+            r0->DotBegin(*r, &rho_dot);
+
+            res_norm = this->NormEnd_(*r, &res_dot);
+
+            rho_old = rho;
+            rho     = r0->DotEnd(&rho_dot);
+
             // Check convergence
-            res_norm = this->Norm_(*r);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
             }
 
-            // rho = <r0,r>
-            rho_old = rho;
-            rho     = r0->Dot(*r);
-
             // Check rho for zero
             if(rho == static_cast<ValueType>(0))
             {
@@ -308,6 +308,9 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
+        DotFuture<ValueType> res_dot;
+        DotFuture<ValueType> rho_dot;
+
         // Initial residual = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -323,11 +326,13 @@ namespace rocalution
             return;
         }
 
+        // rho = (r,r), overlapped with p = r
+        r->DotNonConjBegin(*r, &rho_dot);
+
         // p = r
         p->CopyFrom(*r);
 
-        // rho = (r,r)
-        rho = r->DotNonConj(*r);
+        rho = r->DotEnd(&rho_dot);
 
         while(true)
         {
@@ -337,23 +342,28 @@ namespace rocalution
             // alpha = rho / (p,q)
             alpha = rho / p->DotNonConj(*q);
 
+            // r = r - alpha*q
+            r->AddScale(*q, -alpha);
+
+            // Residual norm and rho = (r,r) are reduced together, overlapped with the
+            // update of x
+            this->NormBegin_(*r, &res_dot);
+            r->DotNonConjBegin(*r, &rho_dot);
+
             // x = x + alpha*p
             x->AddScale(*p, alpha);
 
-            // r = r - alpha*q
-            r->AddScale(*q, -alpha);
+            res_norm = this->NormEnd_(*r, &res_dot);
+
+            rho_old = rho;
+            rho     = r->DotEnd(&rho_dot);
 
             // Check convergence
-            res_norm = this->Norm_(*r);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
             }
 
-            // rho = (r,r)
-            rho_old = rho;
-            rho     = r->DotNonConj(*r);
-
             // p = beta*p + r
             beta = rho / rho_old;
             p->ScaleAdd(beta, *r);
@@ -384,6 +394,9 @@ namespace rocalution
         ValueType alpha, beta;
         ValueType rho, rho_old;
 
+        DotFuture<ValueType> res_dot;
+        DotFuture<ValueType> rho_dot;
+
         // Initial residual = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -400,14 +413,20 @@ namespace rocalution
             return;
         }
 
+        // The preconditioner might still be built by a host task, such that its build
+        // overlaps with the initial residual computation
+        this->precond_->Sync();
+
         // Solve Mz=r
         this->precond_->SolveZeroSol(*r, z);
 
+        // rho = (r,z), overlapped with p = z
+        r->DotNonConjBegin(*z, &rho_dot);
+
         // p = z
         p->CopyFrom(*z);
 
-        // rho = (r,z)
-        rho = r->DotNonConj(*z);
+        rho = r->DotEnd(&rho_dot);
 
         while(true)
         {
@@ -417,14 +436,17 @@ namespace rocalution
             // alpha = rho / (p,q)
             alpha = rho / p->DotNonConj(*q);
 
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
-
             // r = r - alpha*q
             r->AddScale(*q, -alpha);
 
+            // Residual norm, overlapped with the update of x
+            this->NormBegin_(*r, &res_dot);
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
             // Check convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->NormEnd_(*r, &res_dot);
             if(this->iter_ctrl_.CheckResidual(std::abs(res_norm), this->index_))
             {
                 break;
@@ -255,6 +255,11 @@ namespace rocalution
         ValueType rho;
         ValueType gamma, gamma_rho;
 
+        DotFuture<ValueType> alpha_dot;
+        DotFuture<ValueType> beta_dot;
+        DotFuture<ValueType> gamma_dot;
+        DotFuture<ValueType> res_dot;
+
         // initial residual = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -263,14 +268,14 @@ namespace rocalution
         ValueType res = this->Norm_(*r);
         this->iter_ctrl_.InitResidual(std::abs(res));
 
+        // alpha = (r,r), overlapped with w = Ar
+        r->DotBegin(*r, &alpha_dot);
+
         // w = Ar
         op->Apply(*r, w);
 
-        // alpha = (r,r)
-        alpha = r->Dot(*r);
-
-        // beta = (r,w)
-        beta = r->Dot(*w);
+        // beta = (r,w), overlapped with p = r and q = w
+        r->DotBegin(*w, &beta_dot);
 
         // p = r
         p->CopyFrom(*r);
@@ -278,27 +283,36 @@ namespace rocalution
         // q = w
         q->CopyFrom(*w);
 
+        alpha = r->DotEnd(&alpha_dot);
+        beta  = r->DotEnd(&beta_dot);
+
         // rho = beta
         rho = beta;
 
-        // x = x + alpha/rho * p
-        x->AddScale(*p, alpha / rho);
-
         // r = r - alpha/rho * q
         r->AddScale(*q, -alpha / rho);
 
-        res = this->Norm_(*r);
+        // Residual norm, overlapped with the update of x
+        this->NormBegin_(*r, &res_dot);
+
+        // x = x + alpha/rho * p
+        x->AddScale(*p, alpha / rho);
+
+        res = this->NormEnd_(*r, &res_dot);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
+            // gamma = (r,q) and (r,r), overlapped with w = Ar
+            r->DotBegin(*q, &gamma_dot);
+            r->DotBegin(*r, &alpha_dot);
+
             // w = Ar
             op->Apply(*r, w);
 
-            // beta = (r,w)
-            beta = r->Dot(*w);
+            // beta = (r,w), overlapped with the update of p and q
+            r->DotBegin(*w, &beta_dot);
 
-            // gamma = (r,q)
-            gamma     = r->Dot(*q);
+            gamma     = r->DotEnd(&gamma_dot);
             gamma_rho = -gamma / rho;
 
             // p = r - gamma/rho * p
@@ -307,19 +321,24 @@ namespace rocalution
             // q = w - gamma/rho * q
             q->ScaleAdd(gamma_rho, *w);
 
+            beta = r->DotEnd(&beta_dot);
+
             // rho = beta + gamma^2 / rho
             rho = beta + gamma * gamma_rho;
 
             // alpha = (r,r) / rho
-            alpha = r->Dot(*r) / rho;
-
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
+            alpha = r->DotEnd(&alpha_dot) / rho;
 
             // r = r - alpha*q
             r->AddScale(*q, -alpha);
 
-            res = this->Norm_(*r);
+            // Residual norm, overlapped with the update of x
+            this->NormBegin_(*r, &res_dot);
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            res = this->NormEnd_(*r, &res_dot);
         }
 
         log_debug(this, "FCG::SolveNonPrecond_()", " #*# end");
@@ -349,6 +368,11 @@ namespace rocalution
         ValueType rho;
         ValueType gamma, gamma_rho;
 
+        DotFuture<ValueType> alpha_dot;
+        DotFuture<ValueType> beta_dot;
+        DotFuture<ValueType> gamma_dot;
+        DotFuture<ValueType> res_dot;
+
         // initial residual = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(static_cast<ValueType>(-1), rhs);
@@ -360,14 +384,14 @@ namespace rocalution
         // Mz = r
         this->precond_->SolveZeroSol(*r, z);
 
+        // alpha = (z,r), overlapped with w = Az
+        z->DotBegin(*r, &alpha_dot);
+
         // w = Az
         op->Apply(*z, w);
 
-        // alpha = (z,r)
-        alpha = z->Dot(*r);
-
-        // beta = (z,w)
-        beta = z->Dot(*w);
+        // beta = (z,w), overlapped with p = z and q = w
+        z->DotBegin(*w, &beta_dot);
 
         // p = z
         p->CopyFrom(*z);
@@ -375,30 +399,39 @@ namespace rocalution
         // q = w
         q->CopyFrom(*w);
 
+        alpha = z->DotEnd(&alpha_dot);
+        beta  = z->DotEnd(&beta_dot);
+
         // rho = beta
         rho = beta;
 
-        // x = x + alpha/rho * p
-        x->AddScale(*p, alpha / rho);
-
         // r = r - alpha/rho * q
         r->AddScale(*q, -alpha / rho);
 
-        res = this->Norm_(*r);
+        // Residual norm, overlapped with the update of x
+        this->NormBegin_(*r, &res_dot);
+
+        // x = x + alpha/rho * p
+        x->AddScale(*p, alpha / rho);
+
+        res = this->NormEnd_(*r, &res_dot);
 
         while(!this->iter_ctrl_.CheckResidual(std::abs(res), this->index_))
         {
             // Mz = r
             this->precond_->SolveZeroSol(*r, z);
 
+            // gamma = (z,q) and (z,r), overlapped with w = Az
+            z->DotBegin(*q, &gamma_dot);
+            z->DotBegin(*r, &alpha_dot);
+
             // w = Az
             op->Apply(*z, w);
 
-            // beta = (r,w)
-            beta = z->Dot(*w);
+            // beta = (z,w), overlapped with the update of p and q
+            z->DotBegin(*w, &beta_dot);
 
-            // gamma = (z,q)
-            gamma     = z->Dot(*q);
+            gamma     = z->DotEnd(&gamma_dot);
             gamma_rho = -gamma / rho;
 
             // p = z - gamma/rho * p
@@ -407,19 +440,24 @@ namespace rocalution
             // q = w - gamma/rho * q
             q->ScaleAdd(gamma_rho, *w);
 
+            beta = z->DotEnd(&beta_dot);
+
             // rho = beta + gamma^2 / rho
             rho = beta + gamma * gamma_rho;
 
             // alpha = (z,r) / rho
-            alpha = z->Dot(*r) / rho;
-
-            // x = x + alpha*p
-            x->AddScale(*p, alpha);
+            alpha = z->DotEnd(&alpha_dot) / rho;
 
             // r = r - alpha*q
             r->AddScale(*q, -alpha);
 
-            res = this->Norm_(*r);
+            // Residual norm, overlapped with the update of x
+            this->NormBegin_(*r, &res_dot);
+
+            // x = x + alpha*p
+            x->AddScale(*p, alpha);
+
+            res = this->NormEnd_(*r, &res_dot);
         }
 
         log_debug(this, "FCG::SolvePrecond_()", " #*# end");
@@ -365,6 +365,11 @@ namespace rocalution
         ValueType rho;
         ValueType omega = one;
 
+        DotFuture<ValueType>  res_dot;
+        DotFuture<ValueType>  rt_dot;
+        DotFuture<ValueType>  nt_dot;
+        DotFuture<ValueType>* dots = NULL;
+
         // Initial residual r = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(-one, rhs);
@@ -378,6 +383,9 @@ namespace rocalution
             return;
         }
 
+        // One pending reduction per shadow space
+        dots = new DotFuture<ValueType>[s];
+
         // G = U = 0
         for(int i = 0; i < s; ++i)
         {
@@ -394,10 +402,15 @@ namespace rocalution
         while(true)
         {
             // Generate rhs for small system
-            // f = P^T * r
+            // f = P^T * r, all s reductions are in flight together
+            for(int i = 0; i < s; ++i)
+            {
+                P[i]->DotBegin(*r, &dots[i]);
+            }
+
             for(int i = 0; i < s; ++i)
             {
-                f[i] = P[i]->Dot(*r);
+                f[i] = P[i]->DotEnd(&dots[i]);
             }
 
             // Loop over shadow spaces
@@ -448,7 +461,12 @@ namespace rocalution
                 for(int i = k; i < s; ++i)
                 {
                     // M_ik = P^T_i * G_k
-                    M[DENSE_IND(i, k, s, s)] = P[i]->Dot(*G[k]);
+                    P[i]->DotBegin(*G[k], &dots[i]);
+                }
+
+                for(int i = k; i < s; ++i)
+                {
+                    M[DENSE_IND(i, k, s, s)] = P[i]->DotEnd(&dots[i]);
                 }
 
                 // Check M_kk for zero
@@ -480,11 +498,13 @@ namespace rocalution
                 // r = r - beta * G_k
                 r->AddScale(*G[k], -beta);
 
+                // Residual norm, overlapped with the update of x
+                this->NormBegin_(*r, &res_dot);
+
                 // x = x + beta * U_k
                 x->AddScale(*U[k], beta);
 
-                // Residual norm
-                res_norm = this->Norm_(*r);
+                res_norm = this->NormEnd_(*r, &res_dot);
 
                 // Check inner loop for convergence
                 if(this->iter_ctrl_.CheckResidualNoCount(std::abs(res_norm)))
@@ -511,8 +531,11 @@ namespace rocalution
             op->Apply(*r, v);
 
             // omega = (v,r) / ||v||^2
-            ValueType rt = v->Dot(*r);
-            ValueType nt = v->Norm();
+            v->DotBegin(*r, &rt_dot);
+            v->DotBegin(*v, &nt_dot);
+
+            ValueType rt = v->DotEnd(&rt_dot);
+            ValueType nt = sqrt(v->DotEnd(&nt_dot));
 
             rt /= nt;
 
@@ -555,6 +578,8 @@ namespace rocalution
             res_norm = this->Norm_(*r);
         }
 
+        delete[] dots;
+
         log_debug(this, "IDR::SolveNonPrecond_()", " #*# end");
     }
 
@@ -593,6 +618,11 @@ namespace rocalution
         ValueType rho;
         ValueType omega = one;
 
+        DotFuture<ValueType>  res_dot;
+        DotFuture<ValueType>  rt_dot;
+        DotFuture<ValueType>  nt_dot;
+        DotFuture<ValueType>* dots = NULL;
+
         // Initial residual r = b - Ax
         op->Apply(*x, r);
         r->ScaleAdd(-one, rhs);
@@ -606,6 +636,9 @@ namespace rocalution
             return;
         }
 
+        // One pending reduction per shadow space
+        dots = new DotFuture<ValueType>[s];
+
         // G = U = 0
         for(int i = 0; i < s; ++i)
         {
@@ -622,10 +655,15 @@ namespace rocalution
         while(true)
         {
             // Generate rhs for small system
-            // f = P^T * r
+            // f = P^T * r, all s reductions are in flight together
             for(int i = 0; i < s; ++i)
             {
-                f[i] = P[i]->Dot(*r);
+                P[i]->DotBegin(*r, &dots[i]);
+            }
+
+            for(int i = 0; i < s; ++i)
+            {
+                f[i] = P[i]->DotEnd(&dots[i]);
             }
 
             // Loop over shadow spaces
@@ -679,7 +717,12 @@ namespace rocalution
                 for(int i = k; i < s; ++i)
                 {
                     // M_ik = P^T_i * G_k
-                    M[DENSE_IND(i, k, s, s)] = P[i]->Dot(*G[k]);
+                    P[i]->DotBegin(*G[k], &dots[i]);
+                }
+
+                for(int i = k; i < s; ++i)
+                {
+                    M[DENSE_IND(i, k, s, s)] = P[i]->DotEnd(&dots[i]);
                 }
 
                 // Check M_kk for zero
@@ -711,11 +754,13 @@ namespace rocalution
                 // r = r - beta * G_k
                 r->AddScale(*G[k], -beta);
 
+                // Residual norm, overlapped with the update of x
+                this->NormBegin_(*r, &res_dot);
+
                 // x = x + beta * U_k
                 x->AddScale(*U[k], beta);
 
-                // Residual norm
-                res_norm = this->Norm_(*r);
+                res_norm = this->NormEnd_(*r, &res_dot);
 
                 // Check inner loop for convergence
                 if(this->iter_ctrl_.CheckResidualNoCount(std::abs(res_norm)))
@@ -745,8 +790,11 @@ namespace rocalution
             op->Apply(*v, t);
 
             // omega = (t,r) / ||t||^2
-            ValueType rt = t->Dot(*r);
-            ValueType nt = t->Norm();
+            t->DotBegin(*r, &rt_dot);
+            t->DotBegin(*t, &nt_dot);
+
+            ValueType rt = t->DotEnd(&rt_dot);
+            ValueType nt = sqrt(t->DotEnd(&nt_dot));
 
             rt /= nt;
 
@@ -782,13 +830,17 @@ namespace rocalution
             // r = r - omega * t
             r->AddScale(*t, -omega);
 
+            // Residual norm to check outer loop convergence, overlapped with the update of x
+            this->NormBegin_(*r, &res_dot);
+
             // x = x + omega * v
             x->AddScale(*v, omega);
 
-            // Residual norm to check outer loop convergence
-            res_norm = this->Norm_(*r);
+            res_norm = this->NormEnd_(*r, &res_dot);
         }
 
+        delete[] dots;
+
         log_debug(this, "::SolvePrecond_()", " #*# end");
     }
 
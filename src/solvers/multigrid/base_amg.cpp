@@ -34,13 +34,34 @@
 #include "../krylov/cg.hpp"
 #include "../preconditioners/preconditioner.hpp"
 
+#include "../../base/host/host_tasks.hpp"
+
 #include "../../utils/log.hpp"
+#include "../../utils/time_functions.hpp"
 
+#include <algorithm>
 #include <list>
+#include <vector>
 
 namespace rocalution
 {
 
+    // Smoothers of local operators are independent of each other and can be built
+    // concurrently
+    template <typename ValueType>
+    static bool concurrent_smoother_build(const LocalMatrix<ValueType>& op)
+    {
+        return true;
+    }
+
+    // Smoothers of distributed operators might communicate during their build, such that
+    // they are built one after another
+    template <typename ValueType>
+    static bool concurrent_smoother_build(const GlobalMatrix<ValueType>& op)
+    {
+        return false;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     BaseAMG<OperatorType, VectorType, ValueType>::BaseAMG()
     {
@@ -57,6 +78,10 @@ namespace rocalution
         // default operator format
         this->op_format_ = CSR;
 
+        // no automatic operator format selection
+        this->op_autotune_           = false;
+        this->op_autotune_benchmark_ = true;
+
         // since hierarchy has not been built yet
         this->hierarchy_ = false;
 
@@ -119,7 +144,17 @@ namespace rocalution
     {
         log_debug(this, "BaseAMG::SetOperatorFormat()", op_format);
 
-        this->op_format_ = op_format;
+        this->op_format_   = op_format;
+        this->op_autotune_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::SetOperatorFormatAutotune(bool benchmark)
+    {
+        log_debug(this, "BaseAMG::SetOperatorFormatAutotune()", benchmark);
+
+        this->op_autotune_           = true;
+        this->op_autotune_benchmark_ = benchmark;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -233,6 +268,8 @@ namespace rocalution
             this->BuildSmoothers();
         }
 
+        std::vector<double> sm_time(this->levels_ - 1, 0.0);
+
         for(int i = 0; i < this->levels_ - 1; ++i)
         {
             if(i > 0)
@@ -243,8 +280,103 @@ namespace rocalution
             {
                 this->smoother_level_[i]->SetOperator(*this->op_);
             }
+        }
+
+        // Threads available for the smoother build, limited by the budget of an enclosing
+        // host task
+        int nthreads = _get_backend_descriptor()->OpenMP_threads;
 
-            this->smoother_level_[i]->Build();
+        if(_get_host_task_threads() > 0 && _get_host_task_threads() < nthreads)
+        {
+            nthreads = _get_host_task_threads();
+        }
+
+        if(_rocalution_available_accelerator() == false && nthreads > 1
+           && concurrent_smoother_build(*this->op_) == true)
+        {
+            // Coarse levels cannot use all threads, thus the smoothers of all levels are
+            // built by concurrent host tasks with thread budgets proportional to the level
+            // size. With more levels than threads, the coarsest levels share the last task.
+            int ntasks = std::min(this->levels_ - 1, nthreads);
+
+            std::vector<double> task_nnz(ntasks, 0.0);
+            double              nnz = 0.0;
+
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                double level_nnz = static_cast<double>(i > 0 ? this->op_level_[i - 1]->GetNnz()
+                                                             : this->op_->GetNnz());
+
+                task_nnz[std::min(i, ntasks - 1)] += level_nnz;
+                nnz += level_nnz;
+            }
+
+            // Each task gets one thread, the remaining threads are shared out by the largest
+            // remainders, such that the budgets add up to nthreads
+            std::vector<int>    task_threads(ntasks, 1);
+            std::vector<double> remainder(ntasks, 0.0);
+            int                 assigned = ntasks;
+
+            for(int k = 0; k < ntasks; ++k)
+            {
+                double share = (nnz > 0.0) ? (nthreads - ntasks) * task_nnz[k] / nnz : 0.0;
+
+                task_threads[k] += static_cast<int>(share);
+                remainder[k] = share - static_cast<int>(share);
+                assigned += static_cast<int>(share);
+            }
+
+            for(; assigned < nthreads; ++assigned)
+            {
+                int k = static_cast<int>(std::max_element(remainder.begin(), remainder.end())
+                                         - remainder.begin());
+
+                ++task_threads[k];
+                remainder[k] = -1.0;
+            }
+
+            HostTaskGroup tasks;
+
+            for(int k = 0; k < ntasks; ++k)
+            {
+                int last = (k < ntasks - 1) ? k : this->levels_ - 2;
+
+                IterativeLinearSolver<OperatorType, VectorType, ValueType>** sm
+                    = &this->smoother_level_[k];
+                double*                                       t  = &sm_time[k];
+                int                                           n  = last - k + 1;
+
+                tasks.Launch(
+                    [sm, t, n](void) {
+                        for(int i = 0; i < n; ++i)
+                        {
+                            t[i] = rocalution_time();
+                            sm[i]->Build();
+                            t[i] = rocalution_time() - t[i];
+                        }
+                    },
+                    task_threads[k]);
+            }
+
+            tasks.Wait();
+        }
+        else
+        {
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                sm_time[i] = rocalution_time();
+                this->smoother_level_[i]->Build();
+                sm_time[i] = rocalution_time() - sm_time[i];
+            }
+        }
+
+        if(this->verb_ > 1)
+        {
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                LOG_INFO("AMG level " << i + 1 << " smoother build time: " << sm_time[i] / 1e6
+                                      << " sec");
+            }
         }
 
         log_debug(this, "BaseAMG::Build()", "#*# setup coarse solver");
@@ -252,16 +384,7 @@ namespace rocalution
         // Setup and build coarse grid solver
         if(this->set_s_ == false)
         {
-            // Coarse Grid Solver
-            CG<OperatorType, VectorType, ValueType>* cgs
-                = new CG<OperatorType, VectorType, ValueType>;
-
-            // set absolute tolerance to 0 to avoid issues with very small numbers
-            cgs->Init(0.0, 1e-6, 1e+8, 1000000);
-            // be quite
-            cgs->Verbose(0);
-
-            this->solver_coarse_ = cgs;
+            this->solver_coarse_ = this->CreateCoarseSolver_();
         }
 
         this->solver_coarse_->SetOperator(*this->op_level_[this->levels_ - 2]);
@@ -270,15 +393,62 @@ namespace rocalution
         log_debug(this, "BaseAMG::Build()", "#*# convert operators");
 
         // Convert operator to op_format
-        if(this->op_format_ != CSR)
+        this->ConvertOperators_();
+
+        log_debug(this, "BaseAMG::Build()", "#*# check restrictions for fusion");
+
+        this->CheckRestrictions_();
+
+        log_debug(this, "BaseAMG::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool BaseAMG<OperatorType, VectorType, ValueType>::CoarsestLevel_(const OperatorType& op) const
+    {
+        return op.GetM() <= (IndexType2)this->coarse_size_;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    Solver<OperatorType, VectorType, ValueType>*
+        BaseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_(void)
+    {
+        // Coarse Grid Solver
+        CG<OperatorType, VectorType, ValueType>* cgs = new CG<OperatorType, VectorType, ValueType>;
+
+        // set absolute tolerance to 0 to avoid issues with very small numbers
+        cgs->Init(0.0, 1e-6, 1e+8, 1000000);
+        // be quite
+        cgs->Verbose(0);
+
+        return cgs;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseAMG<OperatorType, VectorType, ValueType>::ConvertOperators_(void)
+    {
+        log_debug(this, "BaseAMG::ConvertOperators_()");
+
+        if(this->op_autotune_ == true)
+        {
+            for(int i = 0; i < this->levels_ - 1; ++i)
+            {
+                unsigned int format
+                    = this->op_level_[i]->AutotuneFormat(this->op_autotune_benchmark_);
+
+                if(this->verb_ > 0)
+                {
+                    LOG_INFO("AMG level " << i + 1 << " operator format "
+                                          << _matrix_format_names[format]);
+                }
+            }
+        }
+        else if(this->op_format_ != CSR)
         {
             for(int i = 0; i < this->levels_ - 1; ++i)
             {
                 this->op_level_[i]->ConvertTo(this->op_format_);
             }
         }
-
-        log_debug(this, "BaseAMG::Build()", this->build_, " #*# end");
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -323,7 +493,7 @@ namespace rocalution
 
             ++this->levels_;
 
-            while(op_list_.back()->GetM() > (IndexType2)this->coarse_size_)
+            while(this->CoarsestLevel_(*op_list_.back()) == false)
             {
                 // Add new list elements
                 restrict_list_.push_back(new OperatorType);
@@ -427,6 +597,9 @@ namespace rocalution
             delete[] this->t_level_;
             delete[] this->s_level_;
 
+            delete[] this->fused_level_;
+            this->fused_level_ = NULL;
+
             // Extra structure for K-cycle
             if(this->cycle_ == 2)
             {
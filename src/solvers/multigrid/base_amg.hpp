@@ -43,6 +43,10 @@ namespace rocalution
   * All parameters in the Algebraic MultiGrid class can be set externally, including
   * smoothers and coarse grid solver.
   *
+  * On the host, the smoothers of a LocalMatrix hierarchy are built concurrently, each
+  * with a number of threads proportional to the number of non-zeros of its level. With
+  * a verbosity level of 2, the build time of each smoother is reported.
+  *
   * \tparam OperatorType - can be LocalMatrix or GlobalMatrix
   * \tparam VectorType - can be LocalVector or GlobalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
@@ -78,6 +82,13 @@ namespace rocalution
         void SetDefaultSmootherFormat(unsigned int op_format);
         /** \brief Set the operator format */
         void SetOperatorFormat(unsigned int op_format);
+        /** \brief Select the operator format of each level automatically
+      * \details
+      * The format of each coarse level operator is chosen by
+      * LocalMatrix::AutotuneFormat(). If \p benchmark is false, the choice is made
+      * from the structure of the operator only, without timing SpMVs.
+      */
+        void SetOperatorFormatAutotune(bool benchmark = true);
 
         /** \brief Returns the number of levels in hierarchy */
         int GetNumLevels(void);
@@ -97,6 +108,14 @@ namespace rocalution
                                 OperatorType*        coarse)
             = 0;
 
+        /** \brief Returns true, if \p op is the coarsest level of the hierarchy */
+        virtual bool CoarsestLevel_(const OperatorType& op) const;
+        /** \brief Creates the coarse grid solver, if it is not passed manually */
+        virtual Solver<OperatorType, VectorType, ValueType>* CreateCoarseSolver_(void);
+
+        /** \brief Converts the coarse level operators to the operator format */
+        void ConvertOperators_(void);
+
         /** \brief Maximal coarse grid size */
         int coarse_size_;
 
@@ -115,6 +134,10 @@ namespace rocalution
         unsigned int sm_format_;
         /** \brief Operator format */
         unsigned int op_format_;
+        /** \brief Operator format is selected automatically */
+        bool op_autotune_;
+        /** \brief Time SpMVs for the automatic operator format selection */
+        bool op_autotune_benchmark_;
     };
 
 } // namespace rocalution
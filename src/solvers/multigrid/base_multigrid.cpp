@@ -31,6 +31,8 @@
 #include "../../base/global_matrix.hpp"
 #include "../../base/global_vector.hpp"
 
+#include "../../base/host/host_tasks.hpp"
+
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 
@@ -40,6 +42,54 @@
 namespace rocalution
 {
 
+    // Restrictions with at most one entry per column can be fused with the residual
+    template <typename ValueType>
+    static bool unique_restriction_columns(const Operator<ValueType>& restriction)
+    {
+        const LocalMatrix<ValueType>* cast_restrict
+            = dynamic_cast<const LocalMatrix<ValueType>*>(&restriction);
+
+        if(cast_restrict == NULL)
+        {
+            return false;
+        }
+
+        return cast_restrict->HasUniqueColumns();
+    }
+
+    // Residual computation fused with the restriction, available for local operators only
+    template <class OperatorType, class VectorType, typename ValueType>
+    static bool fused_residual_restrict(const OperatorType&        op,
+                                        const Operator<ValueType>& restriction,
+                                        const VectorType&          rhs,
+                                        const VectorType&          x,
+                                        VectorType*                res,
+                                        VectorType*                coarse)
+    {
+        return false;
+    }
+
+    template <typename ValueType>
+    static bool fused_residual_restrict(const LocalMatrix<ValueType>& op,
+                                        const Operator<ValueType>&    restriction,
+                                        const LocalVector<ValueType>& rhs,
+                                        const LocalVector<ValueType>& x,
+                                        LocalVector<ValueType>*       res,
+                                        LocalVector<ValueType>*       coarse)
+    {
+        const LocalMatrix<ValueType>* cast_restrict
+            = dynamic_cast<const LocalMatrix<ValueType>*>(&restriction);
+
+        if(cast_restrict == NULL)
+        {
+            return false;
+        }
+
+        op.ResidualRestrict(*cast_restrict, rhs, x, res, coarse, true);
+
+        return true;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     BaseMultiGrid<OperatorType, VectorType, ValueType>::BaseMultiGrid()
     {
@@ -58,6 +108,8 @@ namespace rocalution
         this->restrict_op_level_ = NULL;
         this->prolong_op_level_  = NULL;
 
+        this->fused_level_ = NULL;
+
         this->d_level_ = NULL;
         this->r_level_ = NULL;
         this->t_level_ = NULL;
@@ -247,6 +299,10 @@ namespace rocalution
         this->solver_coarse_->SetOperator(*op_level_[this->levels_ - 2]);
         this->solver_coarse_->Build();
 
+        log_debug(this, "BaseMultiGrid::Build()", "#*# check restrictions for fusion");
+
+        this->CheckRestrictions_();
+
         log_debug(this, "BaseMultiGrid::Build()", "#*# setup all tmp vectors");
 
         // Setup all temporary vectors for the cycles - needed on all levels
@@ -342,6 +398,9 @@ namespace rocalution
             delete[] this->t_level_;
             delete[] this->s_level_;
 
+            delete[] this->fused_level_;
+            this->fused_level_ = NULL;
+
             // Extra structure for K-cycle
             if(this->cycle_ == Kcycle)
             {
@@ -562,6 +621,12 @@ namespace rocalution
     {
         log_debug(this, "BaseMultiGrid::Solve()", " #*# begin", (const void*&)rhs, x);
 
+        // Wait for an asynchronous build on the host
+        if(this->tasks_ != NULL)
+        {
+            this->tasks_->Wait();
+        }
+
         assert(this->levels_ > 1);
         assert(x != NULL);
         assert(x != &rhs);
@@ -611,8 +676,7 @@ namespace rocalution
         }
 
         // initial residual = b - Ax
-        this->op_->Apply(*x, this->r_level_[0]);
-        this->r_level_[0]->ScaleAdd(static_cast<ValueType>(-1), rhs);
+        this->op_->Residual(rhs, *x, this->r_level_[0]);
 
         this->res_norm_ = std::abs(this->Norm_(*this->r_level_[0]));
 
@@ -623,6 +687,8 @@ namespace rocalution
             return;
         }
 
+        this->StartCheckpoint_(x);
+
         this->Vcycle_(rhs, x);
 
         while(!this->iter_ctrl_.CheckResidual(this->res_norm_, this->index_))
@@ -630,6 +696,8 @@ namespace rocalution
             this->Vcycle_(rhs, x);
         }
 
+        this->StopCheckpoint_();
+
         if(this->verb_ > 0)
         {
             this->iter_ctrl_.PrintStatus();
@@ -639,6 +707,20 @@ namespace rocalution
         log_debug(this, "BaseMultiGrid::Solve()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::CheckRestrictions_(void)
+    {
+        log_debug(this, "BaseMultiGrid::CheckRestrictions_()");
+
+        // The column counts of the restrictions do not change between cycles
+        this->fused_level_ = new bool[this->levels_ - 1];
+
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            this->fused_level_[i] = unique_restriction_columns(*this->restrict_op_level_[i]);
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Restrict_(const VectorType& fine,
                                                                        VectorType*       coarse,
@@ -659,6 +741,40 @@ namespace rocalution
         this->prolong_op_level_[level]->Apply(coarse.GetInterior(), &(fine->GetInterior()));
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::ResidualRestrict_(
+        const VectorType& rhs, const VectorType& x, VectorType* res, VectorType* coarse, int level)
+    {
+        log_debug(this,
+                  "BaseMultiGrid::ResidualRestrict_()",
+                  (const void*&)rhs,
+                  (const void*&)x,
+                  res,
+                  coarse,
+                  level);
+
+        const OperatorType* op = (level == 0) ? this->op_ : this->op_level_[level - 1];
+
+        if(this->fused_level_[level] == false
+           || fused_residual_restrict(*op, *this->restrict_op_level_[level], rhs, x, res, coarse)
+                  == false)
+        {
+            op->Residual(rhs, x, res);
+            this->Restrict_(*res, coarse, level);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BaseMultiGrid<OperatorType, VectorType, ValueType>::ProlongAdd_(const VectorType& coarse,
+                                                                         VectorType*       fine,
+                                                                         int               level)
+    {
+        log_debug(this, "BaseMultiGrid::ProlongAdd_()", (const void*&)coarse, fine, level);
+
+        this->prolong_op_level_[level]->ApplyAdd(
+            coarse.GetInterior(), static_cast<ValueType>(1), &(fine->GetInterior()));
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void BaseMultiGrid<OperatorType, VectorType, ValueType>::Vcycle_(const VectorType& rhs,
                                                                      VectorType*       x)
@@ -701,41 +817,53 @@ namespace rocalution
                 }
             }
 
-            // Update residual
-            if(this->current_level_ == 0)
-            {
-                this->op_->Apply(*x, this->s_level_[this->current_level_]);
-            }
-            else
-            {
-                this->op_level_[this->current_level_ - 1]->Apply(
-                    *x, this->s_level_[this->current_level_]);
-            }
-
-            this->s_level_[this->current_level_]->ScaleAdd(static_cast<ValueType>(-1), rhs);
-
-            if(this->current_level_ == this->levels_ - this->host_level_ - 1)
-            {
-                this->s_level_[this->current_level_]->MoveToHost();
-            }
-
-            // Restrict residual vector on finest
-            // level
-            this->Restrict_(*this->s_level_[this->current_level_],
-                            this->t_level_[this->current_level_ + 1],
-                            this->current_level_);
-
-            if(this->current_level_ == this->levels_ - this->host_level_ - 1)
+            // The scaling on the finest level requires the residual
+            if(this->current_level_ == this->levels_ - this->host_level_ - 1
+               || (this->scaling_ == true && this->current_level_ == 0))
             {
+                // Update residual
                 if(this->current_level_ == 0)
                 {
-                    this->s_level_[this->current_level_]->CloneBackend(*this->op_);
+                    this->op_->Residual(rhs, *x, this->s_level_[this->current_level_]);
                 }
                 else
                 {
-                    this->s_level_[this->current_level_]->CloneBackend(
-                        *this->op_level_[this->current_level_ - 1]);
+                    this->op_level_[this->current_level_ - 1]->Residual(
+                        rhs, *x, this->s_level_[this->current_level_]);
+                }
+
+                if(this->current_level_ == this->levels_ - this->host_level_ - 1)
+                {
+                    this->s_level_[this->current_level_]->MoveToHost();
                 }
+
+                // Restrict residual vector on finest
+                // level
+                this->Restrict_(*this->s_level_[this->current_level_],
+                                this->t_level_[this->current_level_ + 1],
+                                this->current_level_);
+
+                if(this->current_level_ == this->levels_ - this->host_level_ - 1)
+                {
+                    if(this->current_level_ == 0)
+                    {
+                        this->s_level_[this->current_level_]->CloneBackend(*this->op_);
+                    }
+                    else
+                    {
+                        this->s_level_[this->current_level_]->CloneBackend(
+                            *this->op_level_[this->current_level_ - 1]);
+                    }
+                }
+            }
+            else
+            {
+                // Update and restrict residual
+                this->ResidualRestrict_(rhs,
+                                        *x,
+                                        this->s_level_[this->current_level_],
+                                        this->t_level_[this->current_level_ + 1],
+                                        this->current_level_);
             }
 
             ++this->current_level_;
@@ -777,34 +905,51 @@ namespace rocalution
                 break;
             }
 
-            if(this->current_level_ == this->levels_ - this->host_level_)
-            {
-                this->r_level_[this->current_level_ - 1]->MoveToHost();
-            }
+            bool host_switch = (this->current_level_ == this->levels_ - this->host_level_);
+            bool scale
+                = (this->scaling_ == true && this->current_level_ - 1 < this->levels_ - 2);
 
-            // Prolong solution vector on finest
-            // level
-            this->Prolong_(*this->d_level_[this->current_level_],
-                           this->r_level_[this->current_level_ - 1],
-                           this->current_level_ - 1);
+            if(host_switch == false && scale == false)
+            {
+                // Prolong solution vector and apply
+                // the defect correction
+                this->ProlongAdd_(*this->d_level_[this->current_level_],
+                                  x,
+                                  this->current_level_ - 1);
 
-            if(this->current_level_ == this->levels_ - this->host_level_)
+                --this->current_level_;
+            }
+            else
             {
-                if(this->current_level_ == 1)
+                if(host_switch == true)
                 {
-                    this->r_level_[this->current_level_ - 1]->CloneBackend(*this->op_);
+                    this->r_level_[this->current_level_ - 1]->MoveToHost();
                 }
-                else
+
+                // Prolong solution vector on finest
+                // level
+                this->Prolong_(*this->d_level_[this->current_level_],
+                               this->r_level_[this->current_level_ - 1],
+                               this->current_level_ - 1);
+
+                if(host_switch == true)
                 {
-                    this->r_level_[this->current_level_ - 1]->CloneBackend(
-                        *this->op_level_[this->current_level_ - 2]);
+                    if(this->current_level_ == 1)
+                    {
+                        this->r_level_[this->current_level_ - 1]->CloneBackend(*this->op_);
+                    }
+                    else
+                    {
+                        this->r_level_[this->current_level_ - 1]->CloneBackend(
+                            *this->op_level_[this->current_level_ - 2]);
+                    }
                 }
-            }
 
-            --this->current_level_;
+                --this->current_level_;
+            }
 
             // Scaling
-            if(this->scaling_ == true && this->current_level_ < this->levels_ - 2)
+            if(scale == true)
             {
                 if(this->current_level_ == 0)
                 {
@@ -849,9 +994,11 @@ namespace rocalution
                 // Defect correction
                 x->AddScale(*this->r_level_[this->current_level_], factor);
             }
-            else
+            else if(host_switch == true)
+            {
                 // Defect correction
                 x->AddScale(*this->r_level_[this->current_level_], static_cast<ValueType>(1));
+            }
 
             // Post-smoothing on finest level
             this->smoother_level_[this->current_level_]->InitMaxIter(this->iter_post_smooth_);
@@ -860,8 +1007,7 @@ namespace rocalution
             if(this->current_level_ == 0)
             {
                 // Update residual
-                this->op_->Apply(*x, this->r_level_[this->current_level_]);
-                this->r_level_[this->current_level_]->ScaleAdd(static_cast<ValueType>(-1), rhs);
+                this->op_->Residual(rhs, *x, this->r_level_[this->current_level_]);
 
                 this->res_norm_ = std::abs(this->Norm_(*this->r_level_[this->current_level_]));
             }
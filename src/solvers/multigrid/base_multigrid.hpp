@@ -101,11 +101,26 @@ namespace rocalution
         virtual void Clear(void);
 
     protected:
+        /** \brief Checks once which restrictions can be fused with the residual */
+        void CheckRestrictions_(void);
+
         /** \brief Restricts from level 'level' to 'level-1' */
-        void Restrict_(const VectorType& fine, VectorType* coarse, int level);
+        virtual void Restrict_(const VectorType& fine, VectorType* coarse, int level);
 
         /** \brief Prolongs from level 'level' to 'level+1' */
-        void Prolong_(const VectorType& coarse, VectorType* fine, int level);
+        virtual void Prolong_(const VectorType& coarse, VectorType* fine, int level);
+
+        /** \brief Computes the residual on level 'level' and restricts it to 'level-1',
+      * res may be used as temporary vector
+      */
+        void ResidualRestrict_(const VectorType& rhs,
+                               const VectorType& x,
+                               VectorType*       res,
+                               VectorType*       coarse,
+                               int               level);
+
+        /** \brief Prolongs from level 'level' to 'level+1' and adds the result to fine */
+        virtual void ProlongAdd_(const VectorType& coarse, VectorType* fine, int level);
 
         /** \brief V-cycle */
         void Vcycle_(const VectorType& rhs, VectorType* x);
@@ -159,6 +174,9 @@ namespace rocalution
         /** \brief Prolongation operator hierarchy */
         Operator<ValueType>** prolong_op_level_;
 
+        /** \brief Restrictions with at most one entry per column, checked once in Build() */
+        bool* fused_level_;
+
         VectorType** d_level_; /**< \private */
         VectorType** r_level_; /**< \private */
         VectorType** t_level_; /**< \private */
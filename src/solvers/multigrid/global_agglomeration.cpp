@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "global_agglomeration.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/types.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+#include "../../base/parallel_manager.hpp"
+
+#include "../../utils/log.hpp"
+
+#include <complex>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalAgglomeration<OperatorType, VectorType, ValueType>::GlobalAgglomeration()
+    {
+        log_debug(this, "GlobalAgglomeration::GlobalAgglomeration()", "default constructor");
+
+        this->nprocs_ = 1;
+        this->solver_ = NULL;
+        this->pm_     = NULL;
+
+        // be quiet, the direct solver is called in each cycle
+        this->lu_.Verbose(0);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalAgglomeration<OperatorType, VectorType, ValueType>::~GlobalAgglomeration()
+    {
+        log_debug(this, "GlobalAgglomeration::~GlobalAgglomeration()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("GlobalAgglomeration solver onto " << this->nprocs_ << " process(es)");
+
+        if(this->solver_ == NULL)
+        {
+            this->lu_.Print();
+        }
+        else
+        {
+            this->solver_->Print();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        LOG_INFO("GlobalAgglomeration solver starts");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        LOG_INFO("GlobalAgglomeration solver ends");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::SetProcesses(int nprocs)
+    {
+        log_debug(this, "GlobalAgglomeration::SetProcesses()", nprocs);
+
+        assert(nprocs > 0);
+        assert(this->build_ == false);
+
+        this->nprocs_ = nprocs;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::SetSolver(
+        Solver<OperatorType, VectorType, ValueType>& solver)
+    {
+        log_debug(this, "GlobalAgglomeration::SetSolver()", (const void*&)solver);
+
+        assert(this->build_ == false);
+
+        this->solver_ = &solver;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::Agglomerate_(void)
+    {
+        this->op_->Agglomerate(this->nprocs_, this->pm_, &this->op_agg_);
+
+        this->rhs_agg_.Clear();
+        this->x_agg_.Clear();
+
+        this->rhs_agg_.SetParallelManager(*this->pm_);
+        this->x_agg_.SetParallelManager(*this->pm_);
+
+        if(this->pm_->IsActive() == true)
+        {
+            this->rhs_agg_.Allocate("agglomerated rhs", this->op_agg_.GetM());
+            this->x_agg_.Allocate("agglomerated x", this->op_agg_.GetN());
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "GlobalAgglomeration::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        assert(this->op_ != NULL);
+        assert(this->nprocs_ == 1 || this->solver_ != NULL);
+
+        this->pm_ = new ParallelManager;
+
+        this->Agglomerate_();
+
+        // Only the agglomerated processes build the solver
+        if(this->pm_->IsActive() == true)
+        {
+            if(this->solver_ == NULL)
+            {
+                this->lu_.SetOperator(this->op_agg_.GetInterior());
+                this->lu_.Build();
+            }
+            else
+            {
+                this->solver_->SetOperator(this->op_agg_);
+                this->solver_->Build();
+            }
+        }
+
+        this->build_ = true;
+
+        log_debug(this, "GlobalAgglomeration::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "GlobalAgglomeration::ReBuildNumeric()", this->build_);
+
+        assert(this->build_ == true);
+
+        // The communicator of the agglomerated processes is kept
+        this->Agglomerate_();
+
+        if(this->pm_->IsActive() == true)
+        {
+            if(this->solver_ == NULL)
+            {
+                this->lu_.Clear();
+                this->lu_.SetOperator(this->op_agg_.GetInterior());
+                this->lu_.Build();
+            }
+            else
+            {
+                this->solver_->ResetOperator(this->op_agg_);
+                this->solver_->ReBuildNumeric();
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "GlobalAgglomeration::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            if(this->solver_ != NULL)
+            {
+                this->solver_->Clear();
+                this->solver_ = NULL;
+            }
+
+            this->lu_.Clear();
+
+            this->rhs_agg_.Clear();
+            this->x_agg_.Clear();
+            this->op_agg_.Clear();
+
+            delete this->pm_;
+            this->pm_ = NULL;
+
+            this->build_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
+                                                                         VectorType*       x)
+    {
+        log_debug(this, "GlobalAgglomeration::Solve()", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(x != &rhs);
+        assert(this->build_ == true);
+
+        if(this->verb_ > 0)
+        {
+            this->PrintStart_();
+        }
+
+        this->rhs_agg_.Gather(rhs);
+
+        if(this->pm_->IsActive() == true)
+        {
+            if(this->solver_ == NULL)
+            {
+                this->lu_.Solve(this->rhs_agg_.GetInterior(), &this->x_agg_.GetInterior());
+            }
+            else
+            {
+                this->solver_->SolveZeroSol(this->rhs_agg_, &this->x_agg_);
+            }
+        }
+
+        x->Scatter(this->x_agg_);
+
+        if(this->verb_ > 0)
+        {
+            this->PrintEnd_();
+        }
+    }
+
+    // The agglomerated operator is small, it stays on the host
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "GlobalAgglomeration::MoveToHostLocalData_()", this->build_);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalAgglomeration<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(
+        void)
+    {
+        log_debug(this, "GlobalAgglomeration::MoveToAcceleratorLocalData_()", this->build_);
+    }
+
+    template class GlobalAgglomeration<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class GlobalAgglomeration<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GlobalAgglomeration<GlobalMatrix<std::complex<double>>,
+                                       GlobalVector<std::complex<double>>,
+                                       std::complex<double>>;
+    template class GlobalAgglomeration<GlobalMatrix<std::complex<float>>,
+                                       GlobalVector<std::complex<float>>,
+                                       std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_MULTIGRID_GLOBAL_AGGLOMERATION_HPP_
+#define ROCALUTION_MULTIGRID_GLOBAL_AGGLOMERATION_HPP_
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_vector.hpp"
+#include "../direct/lu.hpp"
+#include "../solver.hpp"
+
+namespace rocalution
+{
+
+    class ParallelManager;
+
+    /** \ingroup solver_module
+  * \class GlobalAgglomeration
+  * \brief Agglomerated Coarse Grid Solver (multi-node)
+  * \details
+  * On coarse levels, the communication of a global multigrid cycle is dominated by
+  * latency, since only a few rows remain on each process. The agglomerated solver
+  * gathers the operator onto the first processes, see GlobalMatrix::Agglomerate(), and
+  * solves the system on the smaller communicator. The remaining processes only send
+  * their part of the right-hand side and receive their part of the solution.
+  *
+  * The agglomerated operator is solved by the solver set by SetSolver(), e.g. another
+  * global AMG, which may agglomerate its coarse levels again. If no solver is set, the
+  * operator has to be gathered onto a single process, where it is solved by a LU
+  * decomposition on the host.
+  *
+  * \tparam OperatorType - can be GlobalMatrix
+  * \tparam VectorType - can be GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class GlobalAgglomeration : public Solver<OperatorType, VectorType, ValueType>
+    {
+    public:
+        GlobalAgglomeration();
+        virtual ~GlobalAgglomeration();
+
+        virtual void Print(void) const;
+
+        /** \brief Set the number of processes, the operator is gathered onto */
+        void SetProcesses(int nprocs);
+        /** \brief Set the solver for the agglomerated operator, required if it is
+      * gathered onto more than one process
+      */
+        void SetSolver(Solver<OperatorType, VectorType, ValueType>& solver);
+
+        virtual void Build(void);
+        virtual void ReBuildNumeric(void);
+        virtual void Clear(void);
+
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+
+    protected:
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Sets up the agglomerated operator and vectors
+        void Agglomerate_(void);
+
+        int nprocs_;
+
+        Solver<OperatorType, VectorType, ValueType>* solver_;
+
+        // Direct solver on a single process
+        LU<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType> lu_;
+
+        // Parallel manager of the agglomerated processes
+        ParallelManager* pm_;
+
+        OperatorType op_agg_;
+        VectorType   rhs_agg_;
+        VectorType   x_agg_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_MULTIGRID_GLOBAL_AGGLOMERATION_HPP_
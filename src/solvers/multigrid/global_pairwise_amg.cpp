@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "global_pairwise_amg.hpp"
+#include "global_agglomeration.hpp"
 #include "../../utils/def.hpp"
 #include "../../utils/types.hpp"
 
@@ -36,6 +37,7 @@
 #include "../../utils/log.hpp"
 #include "../../utils/math_functions.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <list>
 
@@ -67,6 +69,10 @@ namespace rocalution
 
         // set default ordering to connectivity ordering
         this->aggregation_ordering_ = 1;
+
+        // agglomerate coarse levels with less than 500 rows per process
+        this->agglomeration_size_   = 500;
+        this->agglomeration_solver_ = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -138,6 +144,103 @@ namespace rocalution
         this->aggregation_ordering_ = ordering;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalPairwiseAMG<OperatorType, VectorType, ValueType>::SetAgglomerationSize(int rows)
+    {
+        log_debug(this, "GlobalPairwiseAMG::SetAgglomerationSize()", rows);
+
+        assert(rows >= 0);
+
+        this->agglomeration_size_ = rows;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool GlobalPairwiseAMG<OperatorType, VectorType, ValueType>::CoarsestLevel_(
+        const OperatorType& op) const
+    {
+        if(op.GetM() <= (IndexType2)this->coarse_size_)
+        {
+            return true;
+        }
+
+        // Agglomeration is only used with the default coarse grid solver
+        if(this->set_s_ == true || this->agglomeration_size_ == 0)
+        {
+            return false;
+        }
+
+        // Stop early, if the coarse levels can be continued on at least two processes
+        int nprocs = op.GetParallelManager()->GetNumProcs();
+
+        return nprocs >= 4 && op.GetM() < (IndexType2)this->agglomeration_size_ * nprocs;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    Solver<OperatorType, VectorType, ValueType>*
+        GlobalPairwiseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_(void)
+    {
+        const OperatorType* coarse = this->op_level_[this->levels_ - 2];
+
+        int nprocs = coarse->GetParallelManager()->GetNumProcs();
+
+        if(this->agglomeration_size_ == 0 || nprocs == 1)
+        {
+            return BaseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_();
+        }
+
+        GlobalAgglomeration<OperatorType, VectorType, ValueType>* agg
+            = new GlobalAgglomeration<OperatorType, VectorType, ValueType>;
+
+        agg->Verbose(0);
+
+        if(coarse->GetM() > (IndexType2)this->coarse_size_)
+        {
+            // Continue the hierarchy on one process per agglomeration size rows, but at
+            // least on two and at most on half of the processes
+            IndexType2 procs = coarse->GetM() / this->agglomeration_size_;
+            procs = std::max(std::min(procs, static_cast<IndexType2>(nprocs / 2)),
+                             static_cast<IndexType2>(2));
+
+            GlobalPairwiseAMG<OperatorType, VectorType, ValueType>* amg
+                = new GlobalPairwiseAMG<OperatorType, VectorType, ValueType>;
+
+            amg->SetBeta(this->beta_);
+            amg->SetCoarseningFactor(this->coarsening_factor_);
+            amg->SetOrdering(
+                static_cast<_aggregation_ordering>(this->aggregation_ordering_));
+            amg->SetAgglomerationSize(this->agglomeration_size_);
+            amg->SetCoarsestLevel(this->coarse_size_);
+            amg->SetCycle(this->cycle_);
+            amg->SetSmootherPreIter(this->iter_pre_smooth_);
+            amg->SetSmootherPostIter(this->iter_post_smooth_);
+            amg->SetScaling(this->scaling_);
+            amg->SetOperatorFormat(this->op_format_);
+            amg->InitMaxIter(1);
+            amg->Verbose(0);
+
+            agg->SetProcesses(static_cast<int>(procs));
+            agg->SetSolver(*amg);
+
+            this->agglomeration_solver_ = amg;
+        }
+        else
+        {
+            agg->SetProcesses(1);
+
+            // Operators, that are too large for the direct solver, are solved by the
+            // default coarse grid solver on a single process
+            if(coarse->GetM() > (IndexType2)this->agglomeration_size_)
+            {
+                this->agglomeration_solver_
+                    = BaseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_();
+
+                agg->SetSolver(*this->agglomeration_solver_);
+            }
+        }
+
+        return agg;
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void GlobalPairwiseAMG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
     {
@@ -188,13 +291,7 @@ namespace rocalution
         this->solver_coarse_->Verbose(0);
 
         // Convert operator to op_format
-        if(this->op_format_ != CSR)
-        {
-            for(int i = 0; i < this->levels_ - 1; ++i)
-            {
-                this->op_level_[i]->ConvertTo(this->op_format_);
-            }
-        }
+        this->ConvertOperators_();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -248,7 +345,7 @@ namespace rocalution
 
             ++this->levels_;
 
-            while(op_list_.back()->GetM() > (IndexType2)this->coarse_size_)
+            while(this->CoarsestLevel_(*op_list_.back()) == false)
             {
                 // Add new list elements
                 OperatorType* prev_op_ = op_list_.back();
@@ -331,6 +428,14 @@ namespace rocalution
             this->Gsize_level_.clear();
             this->rGsize_level_.clear();
             this->rG_level_.clear();
+
+            if(this->agglomeration_solver_ != NULL)
+            {
+                this->solver_coarse_->Clear();
+
+                delete this->agglomeration_solver_;
+                this->agglomeration_solver_ = NULL;
+            }
         }
     }
 
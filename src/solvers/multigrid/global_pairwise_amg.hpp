@@ -63,6 +63,18 @@ namespace rocalution
         virtual void SetOrdering(const _aggregation_ordering ordering);
         /** \brief Set target coarsening factor */
         virtual void SetCoarseningFactor(double factor);
+        /** \brief Set the number of rows per process, below which the coarse levels are
+      * agglomerated onto fewer processes
+      * \details
+      * Once the coarse operator has less than \p rows rows per process, the coarsening
+      * stops and the coarse operator is gathered onto fewer processes, see
+      * GlobalAgglomeration, where the hierarchy is continued by another
+      * GlobalPairwiseAMG with the same parameters. The coarsest operator is gathered
+      * onto a single process and solved by a LU decomposition, if it has at most \p rows
+      * rows. A value of 0 disables the agglomeration. It has no effect, if the coarse
+      * grid solver is set manually.
+      */
+        void SetAgglomerationSize(int rows);
 
         virtual void ReBuildNumeric(void);
 
@@ -81,6 +93,9 @@ namespace rocalution
                                 Operator<ValueType>* res,
                                 OperatorType*        coarse);
 
+        virtual bool CoarsestLevel_(const OperatorType& op) const;
+        virtual Solver<OperatorType, VectorType, ValueType>* CreateCoarseSolver_(void);
+
         virtual void PrintStart_(void) const;
         virtual void PrintEnd_(void) const;
 
@@ -93,6 +108,11 @@ namespace rocalution
         // Ordering for the aggregation scheme
         int aggregation_ordering_;
 
+        // Number of rows per process, below which the coarse levels are agglomerated
+        int agglomeration_size_;
+        // Solver of the agglomerated coarse operator
+        Solver<OperatorType, VectorType, ValueType>* agglomeration_solver_;
+
         // Parallel Manager for coarser levels
         ParallelManager** pm_level_;
 
@@ -0,0 +1,351 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "global_smoothed_amg.hpp"
+#include "global_agglomeration.hpp"
+#include "../../utils/def.hpp"
+#include "../../utils/types.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_vector.hpp"
+
+#include "../../utils/log.hpp"
+#include "../../utils/math_functions.hpp"
+
+#include <algorithm>
+#include <complex>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalSAAMG<OperatorType, VectorType, ValueType>::GlobalSAAMG()
+    {
+        log_debug(this, "GlobalSAAMG::GlobalSAAMG()", "default constructor");
+
+        // parameter for strong couplings in smoothed aggregation
+        this->eps_   = static_cast<ValueType>(0.01);
+        this->relax_ = static_cast<ValueType>(2) / static_cast<ValueType>(3);
+
+        // agglomerate coarse levels with less than 500 rows per process
+        this->agglomeration_size_   = 500;
+        this->agglomeration_solver_ = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalSAAMG<OperatorType, VectorType, ValueType>::~GlobalSAAMG()
+    {
+        log_debug(this, "GlobalSAAMG::GlobalSAAMG()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("GlobalSAAMG solver");
+        LOG_INFO("GlobalSAAMG number of levels " << this->levels_);
+        LOG_INFO("GlobalSAAMG using smoothed aggregation");
+        LOG_INFO("GlobalSAAMG coarsest operator size = "
+                 << this->op_level_[this->levels_ - 2]->GetM());
+        LOG_INFO("GlobalSAAMG coarsest level nnz = " << this->op_level_[this->levels_ - 2]->GetNnz());
+        LOG_INFO("GlobalSAAMG with smoother:");
+        this->smoother_level_[0]->Print();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::PrintStart_(void) const
+    {
+        assert(this->levels_ > 0);
+
+        LOG_INFO("GlobalSAAMG solver starts");
+        LOG_INFO("GlobalSAAMG number of levels " << this->levels_);
+        LOG_INFO("GlobalSAAMG using smoothed aggregation");
+        LOG_INFO("GlobalSAAMG coarsest operator size = "
+                 << this->op_level_[this->levels_ - 2]->GetM());
+        LOG_INFO("GlobalSAAMG coarsest level nnz = " << this->op_level_[this->levels_ - 2]->GetNnz());
+        LOG_INFO("GlobalSAAMG with smoother:");
+        this->smoother_level_[0]->Print();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::PrintEnd_(void) const
+    {
+        LOG_INFO("GlobalSAAMG ends");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::SetInterpRelax(ValueType relax)
+    {
+        log_debug(this, "GlobalSAAMG::SetInterpRelax()", relax);
+
+        this->relax_ = relax;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::SetCouplingStrength(ValueType eps)
+    {
+        log_debug(this, "GlobalSAAMG::SetCouplingStrength()", eps);
+
+        this->eps_ = eps;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::SetAgglomerationSize(int rows)
+    {
+        log_debug(this, "GlobalSAAMG::SetAgglomerationSize()", rows);
+
+        assert(rows >= 0);
+
+        this->agglomeration_size_ = rows;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    bool GlobalSAAMG<OperatorType, VectorType, ValueType>::CoarsestLevel_(
+        const OperatorType& op) const
+    {
+        if(op.GetM() <= (IndexType2)this->coarse_size_)
+        {
+            return true;
+        }
+
+        // Agglomeration is only used with the default coarse grid solver
+        if(this->set_s_ == true || this->agglomeration_size_ == 0)
+        {
+            return false;
+        }
+
+        // Stop early, if the coarse levels can be continued on at least two processes
+        int nprocs = op.GetParallelManager()->GetNumProcs();
+
+        return nprocs >= 4 && op.GetM() < (IndexType2)this->agglomeration_size_ * nprocs;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    Solver<OperatorType, VectorType, ValueType>*
+        GlobalSAAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_(void)
+    {
+        const OperatorType* coarse = this->op_level_[this->levels_ - 2];
+
+        int nprocs = coarse->GetParallelManager()->GetNumProcs();
+
+        if(this->agglomeration_size_ == 0 || nprocs == 1)
+        {
+            return BaseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_();
+        }
+
+        GlobalAgglomeration<OperatorType, VectorType, ValueType>* agg
+            = new GlobalAgglomeration<OperatorType, VectorType, ValueType>;
+
+        agg->Verbose(0);
+
+        if(coarse->GetM() > (IndexType2)this->coarse_size_)
+        {
+            // Continue the hierarchy on one process per agglomeration size rows, but at
+            // least on two and at most on half of the processes
+            IndexType2 procs = coarse->GetM() / this->agglomeration_size_;
+            procs = std::max(std::min(procs, static_cast<IndexType2>(nprocs / 2)),
+                             static_cast<IndexType2>(2));
+
+            GlobalSAAMG<OperatorType, VectorType, ValueType>* amg
+                = new GlobalSAAMG<OperatorType, VectorType, ValueType>;
+
+            amg->SetCouplingStrength(this->eps_);
+            amg->SetInterpRelax(this->relax_);
+            amg->SetAgglomerationSize(this->agglomeration_size_);
+            amg->SetCoarsestLevel(this->coarse_size_);
+            amg->SetCycle(this->cycle_);
+            amg->SetSmootherPreIter(this->iter_pre_smooth_);
+            amg->SetSmootherPostIter(this->iter_post_smooth_);
+            amg->SetScaling(this->scaling_);
+            amg->SetOperatorFormat(this->op_format_);
+            amg->InitMaxIter(1);
+            amg->Verbose(0);
+
+            agg->SetProcesses(static_cast<int>(procs));
+            agg->SetSolver(*amg);
+
+            this->agglomeration_solver_ = amg;
+        }
+        else
+        {
+            agg->SetProcesses(1);
+
+            // Operators, that are too large for the direct solver, are solved by the
+            // default coarse grid solver on a single process
+            if(coarse->GetM() > (IndexType2)this->agglomeration_size_)
+            {
+                this->agglomeration_solver_
+                    = BaseAMG<OperatorType, VectorType, ValueType>::CreateCoarseSolver_();
+
+                agg->SetSolver(*this->agglomeration_solver_);
+            }
+        }
+
+        return agg;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::ClearLocal(void)
+    {
+        log_debug(this, "GlobalSAAMG::ClearLocal()", this->build_);
+
+        if(this->build_ == true)
+        {
+            for(size_t i = 0; i < this->pm_level_.size(); ++i)
+            {
+                delete this->pm_level_[i];
+            }
+
+            this->pm_level_.clear();
+
+            if(this->agglomeration_solver_ != NULL)
+            {
+                this->solver_coarse_->Clear();
+
+                delete this->agglomeration_solver_;
+                this->agglomeration_solver_ = NULL;
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "GlobalSAAMG::ReBuildNumeric()", " #*# begin");
+
+        assert(this->levels_ > 1);
+        assert(this->build_ == true);
+        assert(this->op_ != NULL);
+
+        // The transfer operators and the parallel managers are kept
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            const OperatorType* fine = (i == 0) ? this->op_ : this->op_level_[i - 1];
+
+            OperatorType* cast_res = dynamic_cast<OperatorType*>(this->restrict_op_level_[i]);
+            OperatorType* cast_pro = dynamic_cast<OperatorType*>(this->prolong_op_level_[i]);
+            assert(cast_res != NULL);
+            assert(cast_pro != NULL);
+
+            this->op_level_[i]->TripleMatrixProduct(*cast_res, *fine, *cast_pro);
+        }
+
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            if(i > 0)
+            {
+                this->smoother_level_[i]->ResetOperator(*this->op_level_[i - 1]);
+            }
+            else
+            {
+                this->smoother_level_[i]->ResetOperator(*this->op_);
+            }
+
+            this->smoother_level_[i]->ReBuildNumeric();
+            this->smoother_level_[i]->Verbose(0);
+        }
+
+        this->solver_coarse_->ResetOperator(*this->op_level_[this->levels_ - 2]);
+        this->solver_coarse_->ReBuildNumeric();
+        this->solver_coarse_->Verbose(0);
+
+        // Convert operator to op_format
+        this->ConvertOperators_();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::Aggregate_(const OperatorType&  op,
+                                                                      Operator<ValueType>* pro,
+                                                                      Operator<ValueType>* res,
+                                                                      OperatorType*        coarse)
+    {
+        log_debug(this, "GlobalSAAMG::Aggregate_()", this->build_);
+
+        assert(pro != NULL);
+        assert(res != NULL);
+        assert(coarse != NULL);
+
+        OperatorType* cast_res = dynamic_cast<OperatorType*>(res);
+        OperatorType* cast_pro = dynamic_cast<OperatorType*>(pro);
+
+        assert(cast_res != NULL);
+        assert(cast_pro != NULL);
+
+        ValueType eps = this->eps_;
+        for(int i = 0; i < this->levels_ - 1; ++i)
+        {
+            eps *= static_cast<ValueType>(0.5);
+        }
+
+        this->pm_level_.push_back(new ParallelManager);
+
+        op.AMGSmoothedAggregation(
+            eps, this->relax_, this->pm_level_.back(), cast_pro, cast_res, coarse);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::Restrict_(const VectorType& fine,
+                                                                     VectorType*       coarse,
+                                                                     int               level)
+    {
+        log_debug(this, "GlobalSAAMG::Restrict_()", (const void*&)fine, coarse, level);
+
+        // The transfer operators are global matrices
+        this->restrict_op_level_[level]->Apply(fine, coarse);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::Prolong_(const VectorType& coarse,
+                                                                    VectorType*       fine,
+                                                                    int               level)
+    {
+        log_debug(this, "GlobalSAAMG::Prolong_()", (const void*&)coarse, fine, level);
+
+        this->prolong_op_level_[level]->Apply(coarse, fine);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalSAAMG<OperatorType, VectorType, ValueType>::ProlongAdd_(const VectorType& coarse,
+                                                                       VectorType*       fine,
+                                                                       int               level)
+    {
+        log_debug(this, "GlobalSAAMG::ProlongAdd_()", (const void*&)coarse, fine, level);
+
+        this->prolong_op_level_[level]->ApplyAdd(coarse, static_cast<ValueType>(1), fine);
+    }
+
+    template class GlobalSAAMG<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class GlobalSAAMG<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GlobalSAAMG<GlobalMatrix<std::complex<double>>,
+                               GlobalVector<std::complex<double>>,
+                               std::complex<double>>;
+    template class GlobalSAAMG<GlobalMatrix<std::complex<float>>,
+                               GlobalVector<std::complex<float>>,
+                               std::complex<float>>;
+#endif
+
+} // namespace rocalution
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_MULTIGRID_GLOBAL_SMOOTHED_AMG_HPP_
+#define ROCALUTION_MULTIGRID_GLOBAL_SMOOTHED_AMG_HPP_
+
+#include "../solver.hpp"
+#include "base_amg.hpp"
+
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \ingroup solver_module
+  * \class GlobalSAAMG
+  * \brief Smoothed Aggregation Algebraic MultiGrid Method (multi-node)
+  * \details
+  * The Smoothed Aggregation Algebraic MultiGrid method is based on smoothed
+  * aggregation based interpolation scheme. This version has multi-node support. The
+  * aggregates are built in parallel and may span process boundaries, the prolongation
+  * is smoothed with the ghost rows of the neighbouring processes and the coarse
+  * operators are distributed Galerkin products with their own parallel managers. The
+  * setup is performed on the host. See GlobalMatrix::AMGSmoothedAggregation().
+  * \cite vanek
+  *
+  * \tparam OperatorType - can be GlobalMatrix
+  * \tparam VectorType - can be GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class GlobalSAAMG : public BaseAMG<OperatorType, VectorType, ValueType>
+    {
+    public:
+        GlobalSAAMG();
+        virtual ~GlobalSAAMG();
+
+        virtual void Print(void) const;
+        virtual void ClearLocal(void);
+
+        /** \brief Set coupling strength */
+        void SetCouplingStrength(ValueType eps);
+        /** \brief Set the relaxation parameter */
+        void SetInterpRelax(ValueType relax);
+        /** \brief Set the number of rows per process, below which the coarse levels are
+      * agglomerated onto fewer processes
+      * \details
+      * Once the coarse operator has less than \p rows rows per process, the coarsening
+      * stops and the coarse operator is gathered onto fewer processes, see
+      * GlobalAgglomeration, where the hierarchy is continued by another GlobalSAAMG with
+      * the same parameters. The coarsest operator is gathered onto a single process and
+      * solved by a LU decomposition, if it has at most \p rows rows. A value of 0
+      * disables the agglomeration. It has no effect, if the coarse grid solver is set
+      * manually.
+      */
+        void SetAgglomerationSize(int rows);
+
+        virtual void ReBuildNumeric(void);
+
+    protected:
+        virtual void Aggregate_(const OperatorType&  op,
+                                Operator<ValueType>* pro,
+                                Operator<ValueType>* res,
+                                OperatorType*        coarse);
+
+        virtual bool CoarsestLevel_(const OperatorType& op) const;
+        virtual Solver<OperatorType, VectorType, ValueType>* CreateCoarseSolver_(void);
+
+        /** \private */
+        virtual void Restrict_(const VectorType& fine, VectorType* coarse, int level);
+        /** \private */
+        virtual void Prolong_(const VectorType& coarse, VectorType* fine, int level);
+        /** \private */
+        virtual void ProlongAdd_(const VectorType& coarse, VectorType* fine, int level);
+
+        virtual void PrintStart_(void) const;
+        virtual void PrintEnd_(void) const;
+
+    private:
+        /** \brief Coupling strength */
+        ValueType eps_;
+
+        /** \brief Relaxation parameter */
+        ValueType relax_;
+
+        /** \brief Number of rows per process, below which the coarse levels are
+      * agglomerated
+      */
+        int agglomeration_size_;
+        /** \brief Solver of the agglomerated coarse operator */
+        Solver<OperatorType, VectorType, ValueType>* agglomeration_solver_;
+
+        // Parallel Manager for coarser levels
+        std::vector<ParallelManager*> pm_level_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_MULTIGRID_GLOBAL_SMOOTHED_AMG_HPP_
@@ -185,7 +185,7 @@ namespace rocalution
 
             ++this->levels_;
 
-            while(op_list_.back()->GetM() > (IndexType2)this->coarse_size_)
+            while(this->CoarsestLevel_(*op_list_.back()) == false)
             {
                 // Add new list elements
                 restrict_list_.push_back(new OperatorType);
@@ -331,13 +331,7 @@ namespace rocalution
         this->solver_coarse_->Verbose(0);
 
         // Convert operator to op_format
-        if(this->op_format_ != CSR)
-        {
-            for(int i = 0; i < this->levels_ - 1; ++i)
-            {
-                this->op_level_[i]->ConvertTo(this->op_format_);
-            }
-        }
+        this->ConvertOperators_();
 
         log_debug(this, "PairwiseAMG::ReBuildNumeric()", " #*# end");
     }
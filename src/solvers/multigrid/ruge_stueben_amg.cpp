@@ -216,13 +216,7 @@ namespace rocalution
         this->solver_coarse_->Verbose(0);
 
         // Convert operator to op_format
-        if(this->op_format_ != CSR)
-        {
-            for(int i = 0; i < this->levels_ - 1; ++i)
-            {
-                this->op_level_[i]->ConvertTo(this->op_format_);
-            }
-        }
+        this->ConvertOperators_();
 
         log_debug(this, "RugeStuebenAMG::ReBuildNumeric()", " #*# end");
     }
@@ -22,6 +22,7 @@
  * ************************************************************************ */
 
 #include "preconditioner.hpp"
+#include "../../base/backend_manager.hpp"
 #include "../../base/global_matrix.hpp"
 #include "../../base/local_matrix.hpp"
 #include "../../utils/def.hpp"
@@ -32,6 +33,7 @@
 
 #include "../../utils/log.hpp"
 
+#include <algorithm>
 #include <complex>
 #include <math.h>
 
@@ -390,6 +392,293 @@ namespace rocalution
         this->v_.MoveToAccelerator();
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    SSOR<OperatorType, VectorType, ValueType>::SSOR()
+    {
+        log_debug(this, "SSOR::SSOR()", "default constructor");
+
+        this->omega_   = static_cast<ValueType>(1);
+        this->blocks_  = 0;
+        this->nblocks_ = 0;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    SSOR<OperatorType, VectorType, ValueType>::~SSOR()
+    {
+        log_debug(this, "SSOR::~SSOR()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("SSOR(" << this->omega_ << ") preconditioner");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("Number of blocks = " << this->nblocks_);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::SetRelaxation(ValueType omega)
+    {
+        log_debug(this, "SSOR::SetRelaxation()", omega);
+
+        this->omega_ = omega;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::SetBlocks(int nblocks)
+    {
+        log_debug(this, "SSOR::SetBlocks()", nblocks);
+
+        assert(nblocks >= 0);
+        assert(this->build_ == false);
+
+        this->blocks_ = nblocks;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "SSOR::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->op_->GetM() == this->op_->GetN());
+
+        this->nblocks_ = (this->blocks_ > 0) ? this->blocks_
+                                             : _get_backend_descriptor()->OpenMP_threads;
+        this->nblocks_ = static_cast<int>(std::min(static_cast<IndexType2>(this->nblocks_),
+                                                   std::max(this->op_->GetM(),
+                                                            static_cast<IndexType2>(1))));
+
+        if(this->op_->GetFormat() != CSR)
+        {
+            this->SSOR_.CloneFrom(*this->op_);
+            this->SSOR_.ConvertToCSR();
+        }
+
+        log_debug(this, "SSOR::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::ResetOperator(const OperatorType& op)
+    {
+        log_debug(this, "SSOR::ResetOperator()", this->build_, (const void*&)op);
+
+        assert(this->op_ != NULL);
+
+        this->SSOR_.Clear();
+
+        if(this->op_->GetFormat() != CSR)
+        {
+            this->SSOR_.CloneFrom(*this->op_);
+            this->SSOR_.ConvertToCSR();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "SSOR::Clear()", this->build_);
+
+        this->SSOR_.Clear();
+        this->nblocks_ = 0;
+
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "SSOR::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+
+        if(this->SSOR_.GetNnz() > 0)
+        {
+            this->SSOR_.SSORSolve(this->omega_, this->nblocks_, rhs, x);
+        }
+        else
+        {
+            this->op_->SSORSolve(this->omega_, this->nblocks_, rhs, x);
+        }
+
+        log_debug(this, "SSOR::Solve()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "SSOR::MoveToHostLocalData_()", this->build_);
+
+        this->SSOR_.MoveToHost();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void SSOR<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "SSOR::MoveToAcceleratorLocalData_()", this->build_);
+
+        this->SSOR_.MoveToAccelerator();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    Kaczmarz<OperatorType, VectorType, ValueType>::Kaczmarz()
+    {
+        log_debug(this, "Kaczmarz::Kaczmarz()", "default constructor");
+
+        this->omega_   = static_cast<ValueType>(1);
+        this->blocks_  = 0;
+        this->nblocks_ = 0;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    Kaczmarz<OperatorType, VectorType, ValueType>::~Kaczmarz()
+    {
+        log_debug(this, "Kaczmarz::~Kaczmarz()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("Kaczmarz(" << this->omega_ << ") preconditioner");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("Number of blocks = " << this->nblocks_);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::SetRelaxation(ValueType omega)
+    {
+        log_debug(this, "Kaczmarz::SetRelaxation()", omega);
+
+        this->omega_ = omega;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::SetBlocks(int nblocks)
+    {
+        log_debug(this, "Kaczmarz::SetBlocks()", nblocks);
+
+        assert(nblocks >= 0);
+        assert(this->build_ == false);
+
+        this->blocks_ = nblocks;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "Kaczmarz::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+
+        this->nblocks_ = (this->blocks_ > 0) ? this->blocks_
+                                             : _get_backend_descriptor()->OpenMP_threads;
+        this->nblocks_ = static_cast<int>(std::min(static_cast<IndexType2>(this->nblocks_),
+                                                   std::max(this->op_->GetM(),
+                                                            static_cast<IndexType2>(1))));
+
+        this->ResetOperator(*this->op_);
+
+        log_debug(this, "Kaczmarz::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::ResetOperator(const OperatorType& op)
+    {
+        log_debug(this, "Kaczmarz::ResetOperator()", this->build_, (const void*&)op);
+
+        assert(this->op_ != NULL);
+        assert(this->nblocks_ > 0);
+
+        this->split_.Clear();
+        this->average_.Clear();
+        this->z_.Clear();
+
+        this->split_.CloneBackend(*this->op_);
+        this->average_.CloneBackend(*this->op_);
+        this->op_->ComponentAveragingSplit(this->nblocks_, &this->split_, &this->average_);
+
+        // The sweeps are performed in CSR format
+        this->split_.ConvertToCSR();
+
+        this->z_.CloneBackend(*this->op_);
+        this->z_.Allocate("z", this->split_.GetN());
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "Kaczmarz::Clear()", this->build_);
+
+        this->split_.Clear();
+        this->average_.Clear();
+        this->z_.Clear();
+        this->nblocks_ = 0;
+
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "Kaczmarz::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+
+        this->z_.Zeros();
+        this->split_.KaczmarzSweep(this->omega_, this->nblocks_, rhs, &this->z_);
+        this->average_.Apply(this->z_, x);
+
+        log_debug(this, "Kaczmarz::Solve()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "Kaczmarz::MoveToHostLocalData_()", this->build_);
+
+        this->split_.MoveToHost();
+        this->average_.MoveToHost();
+        this->z_.MoveToHost();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void Kaczmarz<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "Kaczmarz::MoveToAcceleratorLocalData_()", this->build_);
+
+        this->split_.MoveToAccelerator();
+        this->average_.MoveToAccelerator();
+        this->z_.MoveToAccelerator();
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     ILU<OperatorType, VectorType, ValueType>::ILU()
     {
@@ -659,6 +948,32 @@ namespace rocalution
         log_debug(this, "IC::Build()", this->build_, " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IC<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "IC::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // Keep the structure, only update the values of the lower triangular part
+            OperatorType values;
+            values.CloneFrom(*this->op_);
+            values.ConvertTo(this->IC_.GetFormat());
+
+            this->IC_.Zeros();
+            this->IC_.MatrixAdd(
+                values, static_cast<ValueType>(0), static_cast<ValueType>(1), false);
+
+            this->IC_.ICFactorize(&this->inv_diag_entries_);
+            this->IC_.LLAnalyseClear();
+            this->IC_.LLAnalyse();
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IC<OperatorType, VectorType, ValueType>::Clear(void)
     {
@@ -702,6 +1017,151 @@ namespace rocalution
         log_debug(this, "IC::Solve()", " #*# end");
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    ICT<OperatorType, VectorType, ValueType>::ICT()
+    {
+        log_debug(this, "ICT::ICT()", "default constructor");
+
+        this->t_       = 0.05;
+        this->max_row_ = 100;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    ICT<OperatorType, VectorType, ValueType>::~ICT()
+    {
+        log_debug(this, "ICT::~ICT()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("ICT(" << this->t_ << "," << this->max_row_ << ") preconditioner");
+
+        if(this->build_ == true)
+        {
+            LOG_INFO("ICT nnz = " << this->ICT_.GetNnz());
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Set(double t)
+    {
+        log_debug(this, "ICT::Set()", t);
+
+        assert(t >= 0);
+        assert(this->build_ == false);
+
+        this->t_ = t;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Set(double t, int maxrow)
+    {
+        log_debug(this, "ICT::Set()", t, maxrow);
+
+        assert(t >= 0);
+        assert(this->build_ == false);
+
+        this->t_       = t;
+        this->max_row_ = maxrow;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "ICT::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+
+        this->inv_diag_entries_.CloneBackend(*this->op_);
+
+        this->ICT_.CloneFrom(*this->op_);
+        this->ICT_.ICTFactorize(this->t_, this->max_row_, &this->inv_diag_entries_);
+        this->ICT_.LLAnalyse();
+
+        log_debug(this, "ICT::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "ICT::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // Re-use the sparsity pattern of the threshold factorization, the
+            // numerical factorization is then performed without dropping
+            OperatorType values;
+            values.CloneFrom(*this->op_);
+            values.ConvertTo(this->ICT_.GetFormat());
+
+            this->ICT_.Zeros();
+            this->ICT_.MatrixAdd(
+                values, static_cast<ValueType>(0), static_cast<ValueType>(1), false);
+
+            this->ICT_.ICFactorize(&this->inv_diag_entries_);
+            this->ICT_.LLAnalyseClear();
+            this->ICT_.LLAnalyse();
+        }
+        else
+        {
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "ICT::Clear()", this->build_);
+
+        this->inv_diag_entries_.Clear();
+        this->ICT_.Clear();
+        this->ICT_.LLAnalyseClear();
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "ICT::MoveToHostLocalData_()", this->build_);
+
+        // this->inv_diag_entries_ is NOT needed on accelerator!
+        this->ICT_.MoveToHost();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "ICT::MoveToAcceleratorLocalData_()", this->build_);
+
+        // this->inv_diag_entries_ is NOT needed on accelerator!
+        this->ICT_.MoveToAccelerator();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void ICT<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs, VectorType* x)
+    {
+        log_debug(this, "ICT::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(this->build_ == true);
+        assert(x != NULL);
+        assert(x != &rhs);
+
+        this->ICT_.LLSolve(rhs, this->inv_diag_entries_, x);
+
+        log_debug(this, "ICT::Solve()", " #*# end");
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     VariablePreconditioner<OperatorType, VectorType, ValueType>::VariablePreconditioner()
     {
@@ -926,6 +1386,28 @@ namespace rocalution
                        std::complex<float>>;
 #endif
 
+    template class SSOR<LocalMatrix<double>, LocalVector<double>, double>;
+    template class SSOR<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class SSOR<LocalMatrix<std::complex<double>>,
+                        LocalVector<std::complex<double>>,
+                        std::complex<double>>;
+    template class SSOR<LocalMatrix<std::complex<float>>,
+                        LocalVector<std::complex<float>>,
+                        std::complex<float>>;
+#endif
+
+    template class Kaczmarz<LocalMatrix<double>, LocalVector<double>, double>;
+    template class Kaczmarz<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class Kaczmarz<LocalMatrix<std::complex<double>>,
+                            LocalVector<std::complex<double>>,
+                            std::complex<double>>;
+    template class Kaczmarz<LocalMatrix<std::complex<float>>,
+                            LocalVector<std::complex<float>>,
+                            std::complex<float>>;
+#endif
+
     template class ILU<LocalMatrix<double>, LocalVector<double>, double>;
     template class ILU<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -959,6 +1441,17 @@ namespace rocalution
                       std::complex<float>>;
 #endif
 
+    template class ICT<LocalMatrix<double>, LocalVector<double>, double>;
+    template class ICT<LocalMatrix<float>, LocalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class ICT<LocalMatrix<std::complex<double>>,
+                       LocalVector<std::complex<double>>,
+                       std::complex<double>>;
+    template class ICT<LocalMatrix<std::complex<float>>,
+                       LocalVector<std::complex<float>>,
+                       std::complex<float>>;
+#endif
+
     template class VariablePreconditioner<LocalMatrix<double>, LocalVector<double>, double>;
     template class VariablePreconditioner<LocalMatrix<float>, LocalVector<float>, float>;
 #ifdef SUPPORT_COMPLEX
@@ -169,6 +169,123 @@ namespace rocalution
         VectorType v_;
     };
 
+    /** \ingroup precond_module
+  * \class SSOR
+  * \brief Block Symmetric Successive Over-Relaxation Method
+  * \details
+  * The SSOR preconditioner with relaxation parameter \f$\omega \in (0,2)\f$ is
+  * \f[
+  *   M = \frac{\omega}{2 - \omega}
+  *       \left(\frac{1}{\omega}D + L\right) D^{-1} \left(\frac{1}{\omega}D + U\right),
+  * \f]
+  * where \f$D\f$, \f$L\f$ and \f$U\f$ are the diagonal, the strictly lower and the
+  * strictly upper triangular part of \f$A\f$. The rows are split into consecutive
+  * blocks, which are swept in parallel. Couplings between different blocks are
+  * neglected, i.e. \f$M\f$ is built from the diagonal blocks of \f$A\f$ only. With a
+  * single block, this is the sequential SSOR method. If \f$A\f$ is symmetric and
+  * positive definite, so is \f$M\f$, for any number of blocks.
+  *
+  * By default, the number of blocks is the number of OpenMP threads at the time of
+  * Build(). Since \f$M\f$ depends on the number of blocks, it should be set with
+  * SetBlocks() for reproducible results.
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class SSOR : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        SSOR();
+        virtual ~SSOR();
+
+        virtual void Print(void) const;
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+        virtual void Build(void);
+        virtual void Clear(void);
+
+        virtual void ResetOperator(const OperatorType& op);
+
+        /** \brief Set the relaxation parameter \f$\omega\f$ */
+        void SetRelaxation(ValueType omega);
+        /** \brief Set the number of row blocks, 0 selects the number of OpenMP threads */
+        void SetBlocks(int nblocks);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // CSR copy of the operator, if it is stored in another format
+        OperatorType SSOR_;
+
+        ValueType omega_;
+
+        int blocks_;
+        int nblocks_;
+    };
+
+    /** \ingroup precond_module
+  * \class Kaczmarz
+  * \brief Block Kaczmarz Method with Component Averaging (CARP)
+  * \details
+  * The Kaczmarz method successively projects the iterate onto the hyperplanes given by
+  * the rows \f$a_{i}\f$ of \f$A\f$,
+  * \f[
+  *   x = x + \omega \frac{b_{i} - a_{i}x}{\|a_{i}\|_{2}^{2}} a_{i}^{H},
+  * \f]
+  * with \f$\omega \in (0,2)\f$. It requires neither symmetry nor diagonal dominance
+  * of \f$A\f$, which makes it a robust smoother for nonsymmetric, e.g. convection
+  * dominated, problems. Each application performs a forward and a backward sweep over
+  * the rows, starting from a zero initial guess.
+  *
+  * The rows are split into consecutive blocks, which are swept in parallel. Each block
+  * works on its own copy of the unknowns it is coupled to. Afterwards, every unknown is
+  * averaged over the blocks it appears in (component averaging). With a single block,
+  * this is the sequential symmetric Kaczmarz method. As for SSOR, the number of blocks
+  * defaults to the number of OpenMP threads at the time of Build().
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class Kaczmarz : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        Kaczmarz();
+        virtual ~Kaczmarz();
+
+        virtual void Print(void) const;
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+        virtual void Build(void);
+        virtual void Clear(void);
+
+        virtual void ResetOperator(const OperatorType& op);
+
+        /** \brief Set the relaxation parameter \f$\omega\f$ */
+        void SetRelaxation(ValueType omega);
+        /** \brief Set the number of row blocks, 0 selects the number of OpenMP threads */
+        void SetBlocks(int nblocks);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Row blocks with disjoint columns and the averaging of their columns
+        OperatorType split_;
+        OperatorType average_;
+
+        VectorType z_;
+
+        ValueType omega_;
+
+        int blocks_;
+        int nblocks_;
+    };
+
     /** \ingroup precond_module
   * \class ILU
   * \brief Incomplete LU Factorization based on levels
@@ -217,7 +334,9 @@ namespace rocalution
   * \details
   * The Incomplete LU Factorization based on threshold computes a sparse lower and sparse
   * upper triangular matrix such that \f$A = LU - R\f$. Fill-in values are dropped
-  * depending on a threshold and number of maximal fill-ins per row.
+  * depending on a threshold and number of maximal fill-ins per row. On the host, rows
+  * that do not depend on each other are factorized concurrently; the resulting factors
+  * are identical for any number of threads.
   * \cite SAAD
   *
   * \tparam OperatorType - can be LocalMatrix
@@ -275,6 +394,7 @@ namespace rocalution
         virtual void Print(void) const;
         virtual void Solve(const VectorType& rhs, VectorType* x);
         virtual void Build(void);
+        virtual void ReBuildNumeric(void);
         virtual void Clear(void);
 
     protected:
@@ -286,6 +406,51 @@ namespace rocalution
         VectorType   inv_diag_entries_;
     };
 
+    /** \ingroup precond_module
+  * \class ICT
+  * \brief Incomplete Cholesky Factorization based on threshold
+  * \details
+  * The Incomplete Cholesky Factorization based on threshold computes a sparse lower
+  * triangular matrix such that \f$A=LL^{T} - R\f$. Fill-in values are dropped
+  * depending on a threshold and number of maximal fill-ins per row. ReBuildNumeric()
+  * keeps the sparsity pattern of the first factorization and only recomputes the
+  * values.
+  *
+  * \tparam OperatorType - can be LocalMatrix
+  * \tparam VectorType - can be LocalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class ICT : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        ICT();
+        virtual ~ICT();
+
+        virtual void Print(void) const;
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+
+        /** \brief Set drop-off threshold */
+        virtual void Set(double t);
+
+        /** \brief Set drop-off threshold and maximum fill-ins per row */
+        virtual void Set(double t, int maxrow);
+
+        virtual void Build(void);
+        virtual void ReBuildNumeric(void);
+        virtual void Clear(void);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        OperatorType ICT_;
+        VectorType   inv_diag_entries_;
+        double       t_;
+        int          max_row_;
+    };
+
     /** \ingroup precond_module
   * \class VariablePreconditioner
   * \brief Variable Preconditioner
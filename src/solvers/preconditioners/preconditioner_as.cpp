@@ -160,9 +160,8 @@ namespace rocalution
 
         for(int i = 0; i < this->num_blocks_; ++i)
         {
+            // Views on the rhs, set in Solve()
             this->r_[i] = new VectorType;
-            this->r_[i]->CloneBackend(*this->op_);
-            this->r_[i]->Allocate("AS residual vector", this->sizes_[i]);
 
             this->z_[i] = new VectorType;
             this->z_[i]->CloneBackend(*this->op_);
@@ -241,9 +240,12 @@ namespace rocalution
         assert(x != NULL);
         assert(x != &rhs);
 
+        // The blocks of the rhs are views and only read
+        VectorType& rhs_blocks = const_cast<VectorType&>(rhs);
+
         for(int i = 0; i < this->num_blocks_; ++i)
         {
-            this->r_[i]->CopyFrom(rhs, this->pos_[i], 0, this->sizes_[i]);
+            this->r_[i]->SetView(rhs_blocks, this->pos_[i], this->sizes_[i]);
         }
 
         // Solve
@@ -281,7 +283,6 @@ namespace rocalution
             for(int i = 0; i < this->num_blocks_; ++i)
             {
                 this->local_precond_[i]->MoveToHost();
-                this->r_[i]->MoveToHost();
                 this->z_[i]->MoveToHost();
                 this->local_mat_[i]->MoveToHost();
             }
@@ -300,7 +301,6 @@ namespace rocalution
             for(int i = 0; i < this->num_blocks_; ++i)
             {
                 this->local_precond_[i]->MoveToAccelerator();
-                this->r_[i]->MoveToAccelerator();
                 this->z_[i]->MoveToAccelerator();
                 this->local_mat_[i]->MoveToAccelerator();
             }
@@ -345,9 +345,12 @@ namespace rocalution
         assert(x != NULL);
         assert(x != &rhs);
 
+        // The blocks of the rhs are views and only read
+        VectorType& rhs_blocks = const_cast<VectorType&>(rhs);
+
         for(int i = 0; i < this->num_blocks_; ++i)
         {
-            this->r_[i]->CopyFrom(rhs, this->pos_[i], 0, this->sizes_[i]);
+            this->r_[i]->SetView(rhs_blocks, this->pos_[i], this->sizes_[i]);
         }
 
         // Solve
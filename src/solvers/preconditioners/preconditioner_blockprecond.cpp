@@ -51,6 +51,7 @@ namespace rocalution
 
         this->diag_solve_ = false;
         this->A_last_     = NULL;
+        this->L_block_    = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -88,13 +89,21 @@ namespace rocalution
 
                 delete[] this->A_block_[i];
                 this->A_block_[i] = NULL;
+
+                if(this->L_block_ != NULL)
+                {
+                    delete this->L_block_[i];
+                }
             }
 
             delete[] this->x_block_;
             delete[] this->tmp_block_;
             delete[] this->A_block_;
+            delete[] this->L_block_;
             delete[] this->D_solver_;
 
+            this->L_block_ = NULL;
+
             free_host(&this->block_sizes_);
             this->num_blocks_ = 0;
 
@@ -203,9 +212,8 @@ namespace rocalution
 
         for(int i = 0; i < this->num_blocks_; ++i)
         {
+            // Views on the solution, set in Solve()
             this->x_block_[i] = new VectorType;
-            this->x_block_[i]->CloneBackend(*this->op_); // clone backend
-            this->x_block_[i]->Allocate("Diagonal preconditioners", this->block_sizes_[i]);
 
             this->tmp_block_[i] = new VectorType;
             this->tmp_block_[i]->CloneBackend(*this->op_); // clone backend
@@ -214,21 +222,6 @@ namespace rocalution
             //    LOG_INFO("Block=" << i << " size=" << this->block_sizes_[i]);
         }
 
-        int* offsets = NULL;
-        allocate_host(this->num_blocks_ + 1, &offsets);
-
-        offsets[0] = 0;
-        for(int k = 0; k < this->num_blocks_; ++k)
-        {
-            offsets[k + 1] = this->block_sizes_[k];
-        }
-
-        // sum up
-        for(int i = 0; i < this->num_blocks_; ++i)
-        {
-            offsets[i + 1] += offsets[i];
-        }
-
         this->A_block_ = new OperatorType**[this->num_blocks_];
         for(int k = 0; k < this->num_blocks_; ++k)
         {
@@ -244,6 +237,10 @@ namespace rocalution
             }
         }
 
+        // The operator the blocks refer to
+        const OperatorType* op = this->op_;
+        OperatorType        perm_op;
+
         if(this->permutation_.GetSize() > 0)
         {
             // with permutation
@@ -253,39 +250,47 @@ namespace rocalution
 
             this->permutation_.CloneBackend(*this->op_);
 
-            LocalMatrix<ValueType> perm_op_;
-            perm_op_.CloneFrom(*this->op_);
-            perm_op_.Permute(this->permutation_);
+            perm_op.CloneFrom(*this->op_);
+            perm_op.Permute(this->permutation_);
 
-            perm_op_.ExtractSubMatrices(
-                this->num_blocks_, this->num_blocks_, offsets, offsets, this->A_block_);
+            op = &perm_op;
 
             this->x_.CloneBackend(*this->op_);
             this->x_.Allocate("x (not permuted)", this->op_->GetM());
         }
-        else
+
+        // Only the diagonal blocks are extracted
+        int offset = 0;
+        for(int k = 0; k < this->num_blocks_; ++k)
         {
-            // without permutation
+            if(k < this->num_blocks_ - 1 || this->A_last_ == NULL)
+            {
+                op->ExtractSubMatrix(offset,
+                                     offset,
+                                     this->block_sizes_[k],
+                                     this->block_sizes_[k],
+                                     this->A_block_[k][k]);
+            }
 
-            this->op_->ExtractSubMatrices(
-                this->num_blocks_, this->num_blocks_, offsets, offsets, this->A_block_);
+            offset += this->block_sizes_[k];
         }
 
-        free_host(&offsets);
+        // The lower blocks are applied in place, except for a permuted operator, which is
+        // released, and for backends that would extract them on every application
+        if(this->diag_solve_ == false
+           && (this->permutation_.GetSize() > 0 || op->SupportsApplySubMatrix() == false))
+        {
+            this->ExtractLowerBlocks_(*op);
+        }
 
         if(this->A_last_ != NULL)
         {
-            assert(this->A_block_[this->num_blocks_ - 1][this->num_blocks_ - 1]->GetM()
-                   == this->A_last_->GetM());
-            assert(this->A_block_[this->num_blocks_ - 1][this->num_blocks_ - 1]->GetN()
-                   == this->A_last_->GetN());
+            assert(this->block_sizes_[this->num_blocks_ - 1] == this->A_last_->GetM());
+            assert(this->block_sizes_[this->num_blocks_ - 1] == this->A_last_->GetN());
 
-            //    this->A_block_[this->num_blocks_-1][this->num_blocks_-1]->Info();
-            this->A_block_[this->num_blocks_ - 1][this->num_blocks_ - 1]->Clear();
             delete this->A_block_[this->num_blocks_ - 1][this->num_blocks_ - 1];
 
             this->A_block_[this->num_blocks_ - 1][this->num_blocks_ - 1] = this->A_last_;
-            //    this->A_block_[this->num_blocks_-1][this->num_blocks_-1]->Info();
             this->A_last_ = NULL;
         }
 
@@ -295,25 +300,33 @@ namespace rocalution
             this->D_solver_[i]->Build();
         }
 
-        for(int i = 0; i < this->num_blocks_; ++i)
+        log_debug(this, "BlockPreconditioner::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void BlockPreconditioner<OperatorType, VectorType, ValueType>::ExtractLowerBlocks_(
+        const OperatorType& op)
+    {
+        log_debug(this, "BlockPreconditioner::ExtractLowerBlocks_()", (const void*&)op);
+
+        assert(this->L_block_ == NULL);
+
+        // The lower blocks of each block row at once
+        this->L_block_ = new OperatorType*[this->num_blocks_];
+
+        int offset = 0;
+        for(int k = 0; k < this->num_blocks_; ++k)
         {
-            // Clean U part
-            for(int j = i + 1; j < this->num_blocks_; ++j)
-            {
-                this->A_block_[i][j]->Clear();
-            }
+            this->L_block_[k] = new OperatorType;
+            this->L_block_[k]->CloneBackend(*this->op_);
 
-            // Clean L part if not needed
-            if(this->diag_solve_ == true)
+            if(k > 0)
             {
-                for(int j = 0; j < i; ++j)
-                {
-                    this->A_block_[i][j]->Clear();
-                }
+                op.ExtractSubMatrix(offset, 0, this->block_sizes_[k], offset, this->L_block_[k]);
             }
-        }
 
-        log_debug(this, "BlockPreconditioner::Build()", this->build_, " #*# end");
+            offset += this->block_sizes_[k];
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -324,7 +337,15 @@ namespace rocalution
 
         assert(this->build_ == true);
 
-        // Extract RHS into the solution
+        // The operator may have been moved to a backend without in place sub-matrix products
+        if(this->diag_solve_ == false && this->L_block_ == NULL
+           && this->op_->SupportsApplySubMatrix() == false)
+        {
+            this->ExtractLowerBlocks_(*this->op_);
+        }
+
+        // Extract RHS into the solution, the blocks are views on the solution
+        VectorType* sol = x;
 
         if(this->permutation_.GetSize() > 0)
         {
@@ -336,73 +357,63 @@ namespace rocalution
             // with permutation
             this->x_.CopyFromPermute(rhs, this->permutation_);
 
-            int x_offset = 0;
-            for(int i = 0; i < this->num_blocks_; ++i)
-            {
-                this->x_block_[i]->CopyFrom(this->x_, x_offset, 0, this->block_sizes_[i]);
-
-                x_offset += this->block_sizes_[i];
-            }
+            sol = &this->x_;
         }
         else
         {
             // without permutaion
             x->CopyFrom(rhs);
+        }
 
-            int x_offset = 0;
-            for(int i = 0; i < this->num_blocks_; ++i)
-            {
-                this->x_block_[i]->CopyFrom(*x, x_offset, 0, this->block_sizes_[i]);
+        int x_offset = 0;
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            this->x_block_[i]->SetView(*sol, x_offset, this->block_sizes_[i]);
 
-                x_offset += this->block_sizes_[i];
-            }
+            x_offset += this->block_sizes_[i];
         }
 
+        VectorType x_lower;
+
         // Solve L
+        x_offset = 0;
         for(int i = 0; i < this->num_blocks_; ++i)
         {
-            if(this->diag_solve_ == false)
+            if(this->diag_solve_ == false && i > 0)
             {
-                for(int j = 0; j < i; ++j)
+                // All previous blocks at once
+                x_lower.SetView(*sol, 0, x_offset);
+
+                if(this->L_block_ != NULL)
+                {
+                    this->L_block_[i]->ApplyAdd(
+                        x_lower, static_cast<ValueType>(-1), this->x_block_[i]);
+                }
+                else
                 {
-                    this->A_block_[i][j]->ApplyAdd(
-                        *this->x_block_[j], static_cast<ValueType>(-1), this->x_block_[i]);
+                    this->op_->ApplyAddSubMatrix(x_offset,
+                                                 0,
+                                                 this->block_sizes_[i],
+                                                 x_offset,
+                                                 x_lower,
+                                                 static_cast<ValueType>(-1),
+                                                 this->x_block_[i]);
                 }
             }
 
             this->D_solver_[i]->SolveZeroSol(*this->x_block_[i], this->tmp_block_[i]);
 
             this->x_block_[i]->CopyFrom(*this->tmp_block_[i]);
+
+            x_offset += this->block_sizes_[i];
         }
 
         // Insert Solution
-
         if(this->permutation_.GetSize() > 0)
         {
             // with permutation
-
-            int x_offset = 0;
-            for(int i = 0; i < this->num_blocks_; ++i)
-            {
-                this->x_.CopyFrom(*this->x_block_[i], 0, x_offset, this->block_sizes_[i]);
-
-                x_offset += this->block_sizes_[i];
-            }
-
             x->CopyFromPermuteBackward(this->x_, this->permutation_);
         }
-        else
-        {
-            // without permutaion
-
-            int x_offset = 0;
-            for(int i = 0; i < this->num_blocks_; ++i)
-            {
-                x->CopyFrom(*this->x_block_[i], 0, x_offset, this->block_sizes_[i]);
-
-                x_offset += this->block_sizes_[i];
-            }
-        }
 
         log_debug(this, "BlockPreconditioner::Solve()", " #*# end");
     }
@@ -416,7 +427,6 @@ namespace rocalution
         {
             for(int i = 0; i < this->num_blocks_; ++i)
             {
-                this->x_block_[i]->MoveToHost();
                 this->tmp_block_[i]->MoveToHost();
                 this->D_solver_[i]->MoveToHost();
 
@@ -424,6 +434,11 @@ namespace rocalution
                 {
                     this->A_block_[i][j]->MoveToHost();
                 }
+
+                if(this->L_block_ != NULL)
+                {
+                    this->L_block_[i]->MoveToHost();
+                }
             }
 
             this->permutation_.MoveToHost();
@@ -440,7 +455,6 @@ namespace rocalution
         {
             for(int i = 0; i < this->num_blocks_; ++i)
             {
-                this->x_block_[i]->MoveToAccelerator();
                 this->tmp_block_[i]->MoveToAccelerator();
                 this->D_solver_[i]->MoveToAccelerator();
 
@@ -448,6 +462,11 @@ namespace rocalution
                 {
                     this->A_block_[i][j]->MoveToAccelerator();
                 }
+
+                if(this->L_block_ != NULL)
+                {
+                    this->L_block_[i]->MoveToAccelerator();
+                }
             }
 
             this->permutation_.MoveToAccelerator();
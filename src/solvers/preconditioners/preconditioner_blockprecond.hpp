@@ -88,8 +88,12 @@ namespace rocalution
         virtual void Solve(const VectorType& rhs, VectorType* x);
 
     protected:
-        /** \brief The operator decomposition */
+        /** \brief The operator decomposition, only the diagonal blocks are extracted */
         OperatorType*** A_block_;
+        /** \brief The lower blocks of each block row, extracted for a permuted operator or
+      * if the backend cannot apply them in place
+      */
+        OperatorType** L_block_;
         /** \brief The operator of the last block */
         OperatorType* A_last_;
 
@@ -116,6 +120,9 @@ namespace rocalution
         /** \brief Flag if diagonal solves enabled */
         bool diag_solve_;
 
+        /** \brief Extract the lower blocks of each block row of op */
+        void ExtractLowerBlocks_(const OperatorType& op);
+
         virtual void MoveToHostLocalData_(void);
         virtual void MoveToAcceleratorLocalData_(void);
     };
@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "preconditioner_global_ras.hpp"
+#include "../../utils/def.hpp"
+#include "../solver.hpp"
+
+#include "../../base/global_matrix.hpp"
+#include "../../base/global_vector.hpp"
+#include "../../base/parallel_manager.hpp"
+
+#include "../../utils/log.hpp"
+
+#include <complex>
+
+namespace rocalution
+{
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalRAS<OperatorType, VectorType, ValueType>::GlobalRAS()
+    {
+        log_debug(this, "GlobalRAS::GlobalRAS()", "default constructor");
+
+        this->local_precond_ = NULL;
+        this->overlap_       = 1;
+        this->pm_overlap_    = NULL;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    GlobalRAS<OperatorType, VectorType, ValueType>::~GlobalRAS()
+    {
+        log_debug(this, "GlobalRAS::~GlobalRAS()", "destructor");
+
+        this->Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Print(void) const
+    {
+        LOG_INFO("GlobalRAS preconditioner, overlap = " << this->overlap_);
+
+        this->local_precond_->Print();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Set(
+        Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>& precond)
+    {
+        log_debug(this, "GlobalRAS::Set()", this->build_, (const void*&)precond);
+
+        assert(this->local_precond_ == NULL);
+        assert(this->build_ == false);
+
+        this->local_precond_ = &precond;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::SetOverlap(int overlap)
+    {
+        log_debug(this, "GlobalRAS::SetOverlap()", overlap);
+
+        assert(overlap >= 0);
+        assert(this->build_ == false);
+
+        this->overlap_ = overlap;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Overlap_(void)
+    {
+        this->op_->ExtractOverlap(this->overlap_, this->pm_overlap_, &this->overlap_mat_);
+
+        this->halo_.Clear();
+        this->r_.Clear();
+        this->z_.Clear();
+
+        this->halo_.CloneBackend(*this->op_);
+        this->halo_.SetParallelManager(*this->pm_overlap_);
+        this->halo_.Allocate("overlap rhs", this->op_->GetN());
+
+        this->r_.CloneBackend(this->overlap_mat_);
+        this->r_.Allocate("r", this->overlap_mat_.GetN());
+
+        this->z_.CloneBackend(this->overlap_mat_);
+        this->z_.Allocate("z", this->overlap_mat_.GetN());
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Build(void)
+    {
+        log_debug(this, "GlobalRAS::Build()", this->build_, " #*# begin");
+
+        if(this->build_ == true)
+        {
+            this->Clear();
+        }
+
+        assert(this->build_ == false);
+        this->build_ = true;
+
+        assert(this->op_ != NULL);
+        assert(this->local_precond_ != NULL);
+
+        // The overlap rows are fetched from the neighbours once
+        this->pm_overlap_ = new ParallelManager;
+
+        this->Overlap_();
+
+        this->local_precond_->SetOperator(this->overlap_mat_);
+        this->local_precond_->Build();
+
+        log_debug(this, "GlobalRAS::Build()", this->build_, " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::ReBuildNumeric(void)
+    {
+        log_debug(this, "GlobalRAS::ReBuildNumeric()", this->build_);
+
+        if(this->build_ == true)
+        {
+            // The overlap rows hold the new values
+            this->Overlap_();
+
+            this->local_precond_->ResetOperator(this->overlap_mat_);
+            this->local_precond_->ReBuildNumeric();
+        }
+        else
+        {
+            this->Clear();
+            this->Build();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "GlobalRAS::Clear()", this->build_);
+
+        if(this->local_precond_ != NULL)
+        {
+            this->local_precond_->Clear();
+        }
+
+        this->local_precond_ = NULL;
+
+        this->halo_.Clear();
+        this->r_.Clear();
+        this->z_.Clear();
+        this->overlap_mat_.Clear();
+
+        delete this->pm_overlap_;
+        this->pm_overlap_ = NULL;
+
+        this->build_ = false;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
+                                                               VectorType*       x)
+    {
+        log_debug(this, "GlobalRAS::Solve()", " #*# begin", (const void*&)rhs, x);
+
+        assert(x != NULL);
+        assert(this->build_ == true);
+
+        int nrow     = this->halo_.GetLocalSize();
+        int noverlap = this->halo_.GetGhostSize();
+
+        // Right-hand side on the overlap from the neighbours
+        this->halo_.GetInterior().CopyFrom(rhs.GetInterior(), 0, 0, nrow);
+        this->halo_.UpdateGhostValues();
+
+        this->r_.CopyFrom(this->halo_.GetInterior(), 0, 0, nrow);
+
+        if(noverlap > 0)
+        {
+            this->r_.CopyFrom(this->halo_.GetGhost(), 0, nrow, noverlap);
+        }
+
+        this->local_precond_->SolveZeroSol(this->r_, &this->z_);
+
+        // Restricted, only the local part of the solution is kept
+        x->GetInterior().CopyFrom(this->z_, 0, 0, nrow);
+
+        log_debug(this, "GlobalRAS::Solve()", " #*# end");
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "GlobalRAS::MoveToHostLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->overlap_mat_.MoveToHost();
+            this->halo_.MoveToHost();
+            this->r_.MoveToHost();
+            this->z_.MoveToHost();
+
+            this->local_precond_->MoveToHost();
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void GlobalRAS<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "GlobalRAS::MoveToAcceleratorLocalData_()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->overlap_mat_.MoveToAccelerator();
+            this->halo_.MoveToAccelerator();
+            this->r_.MoveToAccelerator();
+            this->z_.MoveToAccelerator();
+
+            this->local_precond_->MoveToAccelerator();
+        }
+    }
+
+    template class GlobalRAS<GlobalMatrix<double>, GlobalVector<double>, double>;
+    template class GlobalRAS<GlobalMatrix<float>, GlobalVector<float>, float>;
+#ifdef SUPPORT_COMPLEX
+    template class GlobalRAS<GlobalMatrix<std::complex<double>>,
+                             GlobalVector<std::complex<double>>,
+                             std::complex<double>>;
+    template class GlobalRAS<GlobalMatrix<std::complex<float>>,
+                             GlobalVector<std::complex<float>>,
+                             std::complex<float>>;
+#endif
+
+} // namespace rocalution
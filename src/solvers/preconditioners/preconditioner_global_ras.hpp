@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_PRECONDITIONER_GLOBAL_RAS_HPP_
+#define ROCALUTION_PRECONDITIONER_GLOBAL_RAS_HPP_
+
+#include "../../base/local_matrix.hpp"
+#include "../../base/local_vector.hpp"
+#include "preconditioner.hpp"
+
+namespace rocalution
+{
+
+    class ParallelManager;
+
+    /** \ingroup precond_module
+  * \class GlobalRAS
+  * \brief Global Restricted Additive Schwarz (MPI) Preconditioner
+  * \details
+  * The Global Restricted Additive Schwarz preconditioner wraps any local preconditioner
+  * and applies it on each process to the interior matrix, which is extended by a number
+  * of overlap levels of neighbouring rows. The first level are the ghost unknowns of the
+  * global matrix, each further level adds the unknowns coupled to the previous one, see
+  * GlobalMatrix::ExtractOverlap(). The overlap rows are fetched from the neighbours once
+  * in Build(). In each application, the right-hand side on the overlap is received from
+  * the neighbours and only the local part of the solution is kept. In contrast to
+  * BlockJacobi, which corresponds to an overlap of zero, the couplings to the
+  * neighbouring processes are taken into account, such that the convergence degrades
+  * less with the number of processes.
+  * \cite RAS
+  *
+  * \tparam OperatorType - can be GlobalMatrix
+  * \tparam VectorType - can be GlobalVector
+  * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
+  */
+    template <class OperatorType, class VectorType, typename ValueType>
+    class GlobalRAS : public Preconditioner<OperatorType, VectorType, ValueType>
+    {
+    public:
+        GlobalRAS();
+        virtual ~GlobalRAS();
+
+        virtual void Print(void) const;
+
+        /** \brief Set local preconditioner */
+        void Set(Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>& precond);
+
+        /** \brief Set the number of overlap levels, default is 1 */
+        void SetOverlap(int overlap);
+
+        virtual void Solve(const VectorType& rhs, VectorType* x);
+
+        virtual void Build(void);
+        virtual void ReBuildNumeric(void);
+        virtual void Clear(void);
+
+    protected:
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
+    private:
+        // Extracts the overlap and sets up the vectors
+        void Overlap_(void);
+
+        Solver<LocalMatrix<ValueType>, LocalVector<ValueType>, ValueType>* local_precond_;
+
+        int overlap_;
+
+        // Parallel manager with the overlap unknowns as ghost unknowns
+        ParallelManager* pm_overlap_;
+
+        // Interior matrix extended by the overlap
+        LocalMatrix<ValueType> overlap_mat_;
+
+        // Right-hand side, which receives the overlap values
+        VectorType halo_;
+        // Right-hand side and solution on the extended matrix
+        LocalVector<ValueType> r_;
+        LocalVector<ValueType> z_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_PRECONDITIONER_GLOBAL_RAS_HPP_
@@ -44,6 +44,10 @@ namespace rocalution
         log_debug(this, "MultiColoredSGS::MultiColoredSGS()", "default constructor");
 
         this->omega_ = static_cast<ValueType>(1);
+
+        this->streaming_   = false;
+        this->lower_color_ = NULL;
+        this->upper_color_ = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -64,6 +68,36 @@ namespace rocalution
         this->omega_ = omega;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::SetStreamingSweeps(bool streaming)
+    {
+        log_debug(this, "MultiColoredSGS::SetStreamingSweeps()", streaming);
+
+        assert(this->build_ == false);
+
+        this->streaming_ = streaming;
+
+        if(streaming == true)
+        {
+            this->decomp_ = false;
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::Clear(void)
+    {
+        log_debug(this, "MultiColoredSGS::Clear()", this->build_);
+
+        if(this->build_ == true)
+        {
+            this->ClearStreaming_();
+
+            this->streaming_ = false;
+        }
+
+        MultiColored<OperatorType, VectorType, ValueType>::Clear();
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void MultiColoredSGS<OperatorType, VectorType, ValueType>::Print(void) const
     {
@@ -86,31 +120,43 @@ namespace rocalution
             delete this->preconditioner_;
         }
 
-        for(int i = 0; i < this->num_blocks_; ++i)
+        if(this->streaming_ == true)
         {
-            delete this->x_block_[i];
-            delete this->diag_block_[i];
-            delete this->diag_solver_[i];
-
-            for(int j = 0; j < this->num_blocks_; ++j)
+            this->ClearStreaming_();
+        }
+        else
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
             {
-                delete this->preconditioner_block_[i][j];
+                delete this->x_block_[i];
+                delete this->diag_block_[i];
+                delete this->diag_solver_[i];
+
+                for(int j = 0; j < this->num_blocks_; ++j)
+                {
+                    delete this->preconditioner_block_[i][j];
+                }
+
+                delete[] this->preconditioner_block_[i];
             }
 
-            delete[] this->preconditioner_block_[i];
+            delete[] this->preconditioner_block_;
+            delete[] this->x_block_;
+            delete[] this->diag_block_;
+            delete[] this->diag_solver_;
         }
 
-        delete[] this->preconditioner_block_;
-        delete[] this->x_block_;
-        delete[] this->diag_block_;
-        delete[] this->diag_solver_;
-
         this->preconditioner_ = new OperatorType;
         this->preconditioner_->CloneFrom(*this->op_);
 
         this->Permute_();
         this->Factorize_();
         this->Decompose_();
+
+        if(this->streaming_ == true)
+        {
+            this->BuildStreaming_();
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -119,8 +165,218 @@ namespace rocalution
         log_debug(this, "MultiColoredSGS::PostAnalyse_()", this->build_);
 
         assert(this->build_ == true);
-        this->preconditioner_->LAnalyse(false);
-        this->preconditioner_->UAnalyse(false);
+
+        if(this->streaming_ == true)
+        {
+            this->BuildStreaming_();
+        }
+        else
+        {
+            this->preconditioner_->LAnalyse(false);
+            this->preconditioner_->UAnalyse(false);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::BuildStreaming_(void)
+    {
+        log_debug(this, "MultiColoredSGS::BuildStreaming_()");
+
+        assert(this->num_blocks_ > 0);
+        assert(this->block_sizes_ != NULL);
+        assert(this->lower_color_ == NULL);
+        assert(this->upper_color_ == NULL);
+
+        int nrow = this->preconditioner_->GetM();
+
+        unsigned int format = (this->op_mat_format_ == true) ? this->precond_mat_format_
+                                                             : static_cast<unsigned int>(CSR);
+
+        this->inv_diag_.CloneBackend(*this->op_);
+        this->preconditioner_->ExtractInverseDiagonal(&this->inv_diag_);
+
+        this->lower_color_ = new OperatorType*[this->num_blocks_];
+        this->upper_color_ = new OperatorType*[this->num_blocks_];
+
+        int offset = 0;
+        for(int i = 0; i < this->num_blocks_; ++i)
+        {
+            int size = this->block_sizes_[i];
+            int next = offset + size;
+
+            this->lower_color_[i] = new OperatorType;
+            this->upper_color_[i] = new OperatorType;
+
+            this->lower_color_[i]->CloneBackend(*this->op_);
+            this->upper_color_[i]->CloneBackend(*this->op_);
+
+            // Rows of color i, columns of all previous and all subsequent colors
+            if(offset > 0)
+            {
+                this->preconditioner_->ExtractSubMatrix(
+                    offset, 0, size, offset, this->lower_color_[i]);
+            }
+
+            if(next < nrow)
+            {
+                this->preconditioner_->ExtractSubMatrix(
+                    offset, next, size, nrow - next, this->upper_color_[i]);
+            }
+
+            // Scale the rows by the inverse diagonal, such that each sweep over a color
+            // is a single SpMV
+            this->inv_diag_color_.SetView(this->inv_diag_, offset, size);
+
+            OperatorType** part[2] = {&this->lower_color_[i], &this->upper_color_[i]};
+
+            for(int k = 0; k < 2; ++k)
+            {
+                if((*part[k])->GetNnz() > 0)
+                {
+                    (*part[k])->DiagonalMatrixMultL(this->inv_diag_color_);
+                    (*part[k])->ConvertTo(format);
+                }
+                else
+                {
+                    // Not coupled
+                    delete *part[k];
+                    *part[k] = NULL;
+                }
+            }
+
+            offset = next;
+        }
+
+        this->inv_diag_color_.Clear();
+
+        // The permuted matrix and its diagonal are not used by the sweeps
+        this->preconditioner_->Clear();
+        this->diag_.Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::ClearStreaming_(void)
+    {
+        log_debug(this, "MultiColoredSGS::ClearStreaming_()");
+
+        if(this->lower_color_ != NULL)
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
+            {
+                delete this->lower_color_[i];
+                delete this->upper_color_[i];
+            }
+
+            delete[] this->lower_color_;
+            delete[] this->upper_color_;
+
+            this->lower_color_ = NULL;
+            this->upper_color_ = NULL;
+        }
+
+        this->x_color_.Clear();
+        this->x_other_.Clear();
+        this->inv_diag_color_.Clear();
+
+        this->inv_diag_.Clear();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::StreamingSweep_(bool forward)
+    {
+        log_debug(this, "MultiColoredSGS::StreamingSweep_()", forward);
+
+        assert(this->build_ == true);
+        assert(this->lower_color_ != NULL);
+        assert(this->upper_color_ != NULL);
+
+        int nrow = this->x_.GetSize();
+
+        // Offset of the current color in x_
+        int offset = (forward == true) ? 0 : nrow;
+
+        for(int k = 0; k < this->num_blocks_; ++k)
+        {
+            int i    = (forward == true) ? k : this->num_blocks_ - 1 - k;
+            int size = this->block_sizes_[i];
+
+            if(forward == false)
+            {
+                offset -= size;
+            }
+
+            this->x_color_.SetView(this->x_, offset, size);
+            this->inv_diag_color_.SetView(this->inv_diag_, offset, size);
+
+            // x_i = D_i^-1 x_i - D_i^-1 A_ij x_j, with j < i (forward) or j > i (backward)
+            this->x_color_.PointWiseMult(this->inv_diag_color_);
+
+            if(forward == true && this->lower_color_[i] != NULL)
+            {
+                this->x_other_.SetView(this->x_, 0, offset);
+                this->lower_color_[i]->ApplyAdd(
+                    this->x_other_, static_cast<ValueType>(-1), &this->x_color_);
+            }
+
+            if(forward == false && this->upper_color_[i] != NULL)
+            {
+                this->x_other_.SetView(this->x_, offset + size, nrow - offset - size);
+                this->upper_color_[i]->ApplyAdd(
+                    this->x_other_, static_cast<ValueType>(-1), &this->x_color_);
+            }
+
+            // SSOR
+            if(this->omega_ != static_cast<ValueType>(1))
+            {
+                this->x_color_.Scale(static_cast<ValueType>(1) / this->omega_);
+            }
+
+            if(forward == true)
+            {
+                offset += size;
+            }
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::StreamingSymmetricSweep_(void)
+    {
+        log_debug(this, "MultiColoredSGS::StreamingSymmetricSweep_()");
+
+        assert(this->build_ == true);
+        assert(this->upper_color_ != NULL);
+
+        int offset = this->x_.GetSize();
+
+        for(int i = this->num_blocks_ - 1; i >= 0; --i)
+        {
+            int size = this->block_sizes_[i];
+
+            offset -= size;
+
+            this->x_color_.SetView(this->x_, offset, size);
+
+            // The diagonal scaling D_i of the SGS cancels with D_i^-1 of the backward
+            // sweep, i.e. x_i = x_i - D_i^-1 A_ij x_j, with j > i
+            if(this->omega_ != static_cast<ValueType>(1))
+            {
+                this->x_color_.Scale(this->omega_ / (static_cast<ValueType>(2) - this->omega_));
+            }
+
+            if(this->upper_color_[i] != NULL)
+            {
+                this->x_other_.SetView(
+                    this->x_, offset + size, this->x_.GetSize() - offset - size);
+                this->upper_color_[i]->ApplyAdd(
+                    this->x_other_, static_cast<ValueType>(-1), &this->x_color_);
+            }
+
+            // SSOR
+            if(this->omega_ != static_cast<ValueType>(1))
+            {
+                this->x_color_.Scale(static_cast<ValueType>(1) / this->omega_);
+            }
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -206,15 +462,85 @@ namespace rocalution
 
         this->x_.CopyFromPermute(rhs, this->permutation_);
 
-        this->preconditioner_->LSolve(this->x_, x);
+        if(this->streaming_ == true)
+        {
+            this->StreamingSweep_(true);
+            this->StreamingSymmetricSweep_();
+        }
+        else
+        {
+            this->preconditioner_->LSolve(this->x_, x);
 
-        x->PointWiseMult(this->diag_);
+            x->PointWiseMult(this->diag_);
 
-        this->preconditioner_->USolve(*x, &this->x_);
+            this->preconditioner_->USolve(*x, &this->x_);
+        }
 
         x->CopyFromPermuteBackward(this->x_, this->permutation_);
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::MoveToHostLocalData_(void)
+    {
+        log_debug(this, "MultiColoredSGS::MoveToHostLocalData_()", this->build_);
+
+        // The views are set again in the next sweep
+        this->x_color_.Clear();
+        this->x_other_.Clear();
+        this->inv_diag_color_.Clear();
+
+        MultiColored<OperatorType, VectorType, ValueType>::MoveToHostLocalData_();
+
+        if(this->lower_color_ != NULL)
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
+            {
+                if(this->lower_color_[i] != NULL)
+                {
+                    this->lower_color_[i]->MoveToHost();
+                }
+
+                if(this->upper_color_[i] != NULL)
+                {
+                    this->upper_color_[i]->MoveToHost();
+                }
+            }
+        }
+
+        this->inv_diag_.MoveToHost();
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void MultiColoredSGS<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_(void)
+    {
+        log_debug(this, "MultiColoredSGS::MoveToAcceleratorLocalData_()", this->build_);
+
+        // The views are set again in the next sweep
+        this->x_color_.Clear();
+        this->x_other_.Clear();
+        this->inv_diag_color_.Clear();
+
+        MultiColored<OperatorType, VectorType, ValueType>::MoveToAcceleratorLocalData_();
+
+        if(this->lower_color_ != NULL)
+        {
+            for(int i = 0; i < this->num_blocks_; ++i)
+            {
+                if(this->lower_color_[i] != NULL)
+                {
+                    this->lower_color_[i]->MoveToAccelerator();
+                }
+
+                if(this->upper_color_[i] != NULL)
+                {
+                    this->upper_color_[i]->MoveToAccelerator();
+                }
+            }
+        }
+
+        this->inv_diag_.MoveToAccelerator();
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     MultiColoredGS<OperatorType, VectorType, ValueType>::MultiColoredGS()
     {
@@ -241,7 +567,15 @@ namespace rocalution
     void MultiColoredGS<OperatorType, VectorType, ValueType>::PostAnalyse_(void)
     {
         assert(this->build_ == true);
-        this->preconditioner_->UAnalyse(false);
+
+        if(this->streaming_ == true)
+        {
+            this->BuildStreaming_();
+        }
+        else
+        {
+            this->preconditioner_->UAnalyse(false);
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -284,8 +618,19 @@ namespace rocalution
     void MultiColoredGS<OperatorType, VectorType, ValueType>::Solve_(const VectorType& rhs,
                                                                      VectorType*       x)
     {
-        LOG_INFO("No implemented yet");
-        FATAL_ERROR(__FILE__, __LINE__);
+        if(this->streaming_ == true)
+        {
+            this->x_.CopyFromPermute(rhs, this->permutation_);
+
+            this->StreamingSweep_(false);
+
+            x->CopyFromPermuteBackward(this->x_, this->permutation_);
+        }
+        else
+        {
+            LOG_INFO("No implemented yet");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
     }
 
     template class MultiColoredSGS<LocalMatrix<double>, LocalVector<double>, double>;
@@ -44,6 +44,9 @@ namespace rocalution
   * Details on the Symmetric Gauss-Seidel / SSOR algorithm can be found in the SGS
   * preconditioner.
   *
+  * With SetStreamingSweeps(), the matrix is stored by color instead of by color blocks.
+  * See SetStreamingSweeps() for details.
+  *
   * \tparam OperatorType - can be LocalMatrix
   * \tparam VectorType - can be LocalVector
   * \tparam ValueType - can be float, double, std::complex<float> or std::complex<double>
@@ -57,11 +60,28 @@ namespace rocalution
 
         virtual void Print(void) const;
 
+        virtual void Clear(void);
+
         virtual void ReBuildNumeric(void);
 
         /** \brief Set the relaxation parameter for the SOR/SSOR scheme */
         void SetRelaxation(ValueType omega);
 
+        /** \brief Sweep over the colors of the reordered matrix with streaming kernels
+      * \details
+      * Instead of decomposing the permuted matrix into blocks for each pair of colors,
+      * the rows of each color are stored contiguously in two matrices, one for the
+      * columns of all previous and one for the columns of all subsequent colors. Their
+      * rows are scaled by the inverse diagonal and stored in CSR format. On accelerators,
+      * ELL usually streams better and can be selected by SetPrecondMatrixFormat(). The
+      * solution is kept as one permuted vector and each color is updated in place by a
+      * single SpMV and a scaling, such that the per-color copies of the block
+      * decomposition are avoided. For MultiColoredSGS, the diagonal scaling between the
+      * forward and the backward sweep is fused into the backward sweep. This option
+      * disables the decomposition, see SetDecomposition().
+      */
+        void SetStreamingSweeps(bool streaming);
+
     protected:
         virtual void PostAnalyse_(void);
 
@@ -70,8 +90,40 @@ namespace rocalution
         virtual void SolveR_(void);
         virtual void Solve_(const VectorType& rhs, VectorType* x);
 
+        /** \brief Build the per-color matrices for the streaming sweeps */
+        void BuildStreaming_(void);
+        /** \brief Free the per-color matrices of the streaming sweeps */
+        void ClearStreaming_(void);
+        /** \brief Gauss-Seidel sweep over the colors of x_, forward with the lower or
+      * backward with the upper matrices
+      */
+        void StreamingSweep_(bool forward);
+        /** \brief Backward sweep over the colors of x_, fused with the diagonal scaling of
+      * SGS
+      */
+        void StreamingSymmetricSweep_(void);
+
+        virtual void MoveToHostLocalData_(void);
+        virtual void MoveToAcceleratorLocalData_(void);
+
         /** \brief Relaxation parameter */
         ValueType omega_;
+
+        /** \brief Use the streaming sweeps */
+        bool streaming_;
+
+        /** \brief Rows of each color with the columns of all previous colors */
+        OperatorType** lower_color_;
+        /** \brief Rows of each color with the columns of all subsequent colors */
+        OperatorType** upper_color_;
+
+        /** \brief Inverse diagonal of the permuted matrix */
+        VectorType inv_diag_;
+
+        /** \brief Views on x_ and inv_diag_ during the sweeps */
+        VectorType x_color_;
+        VectorType x_other_;
+        VectorType inv_diag_color_;
     };
 
     /** \ingroup precond_module
@@ -273,17 +273,10 @@ namespace rocalution
         this->rhs_.CloneBackend(*this->op_);
         this->rhs_.Allocate("Permuted RHS vector", this->op_->GetM());
 
-        this->x_1_.CloneBackend(*this->op_);
-        this->x_1_.Allocate("Permuted solution vector", this->size_);
-
-        this->x_2_.CloneBackend(*this->op_);
-        this->x_2_.Allocate("Permuted solution vector", this->op_->GetM() - this->size_);
-
         this->rhs_1_.CloneBackend(*this->op_);
         this->rhs_1_.Allocate("Permuted solution vector", this->size_);
 
-        this->rhs_2_.CloneBackend(*this->op_);
-        this->rhs_2_.Allocate("Permuted solution vector", this->op_->GetM() - this->size_);
+        // x_1_, x_2_ and rhs_2_ are views on x_ and rhs_, set in Solve()
 
         if(this->level_ > 1)
         {
@@ -315,9 +308,13 @@ namespace rocalution
 
         this->rhs_.CopyFromPermute(rhs, this->permutation_);
 
-        this->x_1_.CopyFrom(this->rhs_, 0, 0, this->size_);
+        // x_1_ is computed in place of the first part of rhs_, x_2_ in place of the second
+        // part of x_
+        int size2 = this->rhs_.GetLocalSize() - this->size_;
 
-        this->rhs_2_.CopyFrom(this->rhs_, this->size_, 0, this->rhs_.GetLocalSize() - this->size_);
+        this->x_1_.SetView(this->rhs_, 0, this->size_);
+        this->rhs_2_.SetView(this->rhs_, this->size_, size2);
+        this->x_2_.SetView(this->x_, this->size_, size2);
 
         // Solve L
         this->E_.ApplyAdd(this->x_1_, static_cast<ValueType>(-1), &this->rhs_2_);
@@ -329,9 +326,7 @@ namespace rocalution
 
         this->x_1_.PointWiseMult(this->inv_vec_D_);
 
-        this->x_.CopyFrom(this->x_1_, 0, 0, this->size_);
-
-        this->x_.CopyFrom(this->x_2_, 0, this->size_, this->rhs_.GetLocalSize() - this->size_);
+        this->x_.CopyFrom(this->rhs_, 0, 0, this->size_);
 
         x->CopyFromPermuteBackward(this->x_, this->permutation_);
 
@@ -351,12 +346,9 @@ namespace rocalution
         this->AA_.MoveToHost();
 
         this->x_.MoveToHost();
-        this->x_1_.MoveToHost();
-        this->x_2_.MoveToHost();
 
         this->rhs_.MoveToHost();
         this->rhs_1_.MoveToHost();
-        this->rhs_2_.MoveToHost();
 
         this->inv_vec_D_.MoveToHost();
 
@@ -386,12 +378,9 @@ namespace rocalution
         this->AA_.MoveToAccelerator();
 
         this->x_.MoveToAccelerator();
-        this->x_1_.MoveToAccelerator();
-        this->x_2_.MoveToAccelerator();
 
         this->rhs_.MoveToAccelerator();
         this->rhs_1_.MoveToAccelerator();
-        this->rhs_2_.MoveToAccelerator();
 
         this->inv_vec_D_.MoveToAccelerator();
 
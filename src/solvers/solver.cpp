@@ -31,14 +31,111 @@
 #include "../base/global_matrix.hpp"
 #include "../base/global_vector.hpp"
 
+#include "../base/host/host_tasks.hpp"
+
 #include "../utils/log.hpp"
 #include "../utils/math_functions.hpp"
 
 #include <complex>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
 
 namespace rocalution
 {
 
+    // Solvers of local operators can be built by a host task in the background
+    template <typename ValueType>
+    static bool host_task_build(const LocalMatrix<ValueType>& op)
+    {
+        return true;
+    }
+
+    template <typename ValueType>
+    static bool host_task_build(const LocalStencil<ValueType>& op)
+    {
+        return true;
+    }
+
+    // Solvers of distributed operators might communicate during their build, such that
+    // they are built by the calling thread
+    template <typename ValueType>
+    static bool host_task_build(const GlobalMatrix<ValueType>& op)
+    {
+        return false;
+    }
+
+    // OpenMP threads available to the calling thread
+    static int host_threads(void)
+    {
+        int budget = _get_host_task_threads();
+
+        return (budget > 0) ? budget : _get_backend_descriptor()->OpenMP_threads;
+    }
+
+    static void replace_file(const std::string& tmp, const std::string& filename)
+    {
+        if(std::rename(tmp.c_str(), filename.c_str()) != 0)
+        {
+            LOG_INFO("Checkpoint: filename=" << filename << "; cannot rename file");
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+    }
+
+    // Checkpoint iterates are written under a temporary name, such that the previous
+    // checkpoint is only replaced by a complete file
+    template <typename ValueType>
+    static void write_checkpoint(const LocalVector<ValueType>& x, const std::string& filename)
+    {
+        x.WriteFileBinary(filename + ".tmp");
+
+        replace_file(filename + ".tmp", filename);
+    }
+
+    // Every process replaces its own part, the master rank also replaces the head file
+    // listing the parts, see GlobalVector::WriteFileBinary()
+    template <typename ValueType>
+    static void write_checkpoint(const GlobalVector<ValueType>& x, const std::string& filename)
+    {
+        std::string tmp = filename + ".tmp";
+
+        x.WriteFileBinary(tmp);
+
+        std::ostringstream rs;
+        rs << _get_backend_descriptor()->rank;
+
+        replace_file(tmp + ".rank." + rs.str(), filename + ".rank." + rs.str());
+
+        if(_get_backend_descriptor()->rank == 0)
+        {
+            std::ifstream tmp_head(tmp.c_str(), std::ifstream::in);
+            std::ofstream head((tmp + ".head").c_str(), std::ofstream::out);
+
+            std::string line;
+
+            for(int i = 0; std::getline(tmp_head, line); ++i)
+            {
+                std::ostringstream ri;
+                ri << i;
+
+                head << filename << ".rank." << ri.str() << "\n";
+            }
+
+            tmp_head.close();
+            head.close();
+
+            if(!head)
+            {
+                LOG_INFO("Checkpoint: filename=" << filename << "; could not write to file");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            replace_file(tmp + ".head", filename);
+            std::remove(tmp.c_str());
+        }
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     Solver<OperatorType, VectorType, ValueType>::Solver()
     {
@@ -48,6 +145,8 @@ namespace rocalution
         this->precond_ = NULL;
 
         this->build_ = false;
+
+        this->tasks_ = NULL;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -55,6 +154,13 @@ namespace rocalution
     {
         log_debug(this, "Solver::~Solver()");
 
+        if(this->tasks_ != NULL)
+        {
+            this->tasks_->Wait();
+            delete this->tasks_;
+            this->tasks_ = NULL;
+        }
+
         // the preconditioner is defined outsite
         this->op_      = NULL;
         this->precond_ = NULL;
@@ -111,16 +217,43 @@ namespace rocalution
     template <class OperatorType, class VectorType, typename ValueType>
     void Solver<OperatorType, VectorType, ValueType>::BuildMoveToAcceleratorAsync(void)
     {
-        // default, normal build + move to accelerator
+        log_debug(this, "Solver::BuildMoveToAcceleratorAsync()");
 
-        this->Build();
-        this->MoveToAccelerator();
+        if(_rocalution_available_accelerator() == true)
+        {
+            // default, normal build + move to accelerator
+            this->Build();
+            this->MoveToAccelerator();
+        }
+        else if(this->op_ == NULL || host_task_build(*this->op_) == false
+                || host_threads() < 2)
+        {
+            // no background build, normal build on the host
+            this->Build();
+        }
+        else
+        {
+            // host only, build in the background with half of the threads, the caller
+            // continues with the other half until Sync()
+            if(this->tasks_ == NULL)
+            {
+                this->tasks_ = new HostTaskGroup;
+            }
+
+            this->tasks_->Launch([this](void) { this->Build(); }, host_threads() / 2);
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
     void Solver<OperatorType, VectorType, ValueType>::Sync(void)
     {
-        // default, do nothing
+        log_debug(this, "Solver::Sync()");
+
+        // default, wait for the host tasks
+        if(this->tasks_ != NULL)
+        {
+            this->tasks_->Wait();
+        }
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -206,12 +339,16 @@ namespace rocalution
 
         this->res_norm_ = 2;
         this->index_    = -1;
+
+        this->checkpoint_freq_ = 0;
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
     IterativeLinearSolver<OperatorType, VectorType, ValueType>::~IterativeLinearSolver()
     {
         log_debug(this, "IterativeLinearSolver::~IterativeLinearSolver()");
+
+        this->StopCheckpoint_();
     }
 
     template <class OperatorType, class VectorType, typename ValueType>
@@ -317,6 +454,112 @@ namespace rocalution
         this->iter_ctrl_.WriteHistoryToFile(filename);
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SaveState(
+        const std::string filename, const VectorType& x)
+    {
+        log_debug(this, "IterativeLinearSolver::SaveState()", filename, (const void*&)x);
+
+        // Do not interfere with a checkpoint that is being written
+        if(this->checkpoint_thread_.joinable())
+        {
+            this->checkpoint_thread_.join();
+        }
+
+        x.WriteFileBinary(filename + ".x");
+
+        // The iteration control is the same on all processes
+        if(_get_backend_descriptor()->rank == 0)
+        {
+            this->iter_ctrl_.WriteStateToFile(filename);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::LoadState(
+        const std::string filename, VectorType* x)
+    {
+        log_debug(this, "IterativeLinearSolver::LoadState()", filename, x);
+
+        assert(x != NULL);
+        assert(this->build_ == true);
+
+        x->ReadFileBinary(filename + ".x");
+
+        this->iter_ctrl_.ReadStateFromFile(filename);
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::SetCheckpoint(
+        const std::string filename, int frequency)
+    {
+        log_debug(this, "IterativeLinearSolver::SetCheckpoint()", filename, frequency);
+
+        assert(frequency >= 0);
+
+        this->checkpoint_name_ = filename;
+        this->checkpoint_freq_ = frequency;
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::StartCheckpoint_(
+        const VectorType* x)
+    {
+        if(this->checkpoint_freq_ == 0)
+        {
+            return;
+        }
+
+        log_debug(this, "IterativeLinearSolver::StartCheckpoint_()", x);
+
+        // Host buffer for the iterate, such that writing does not touch the accelerator
+        this->checkpoint_vec_.Clear();
+        this->checkpoint_vec_.CloneBackend(*this->op_);
+        this->checkpoint_vec_.MoveToHost();
+        this->checkpoint_vec_.Allocate("checkpoint", this->op_->GetM());
+
+        this->iter_ctrl_.SetCheckpoint(this->checkpoint_freq_,
+                                       [this, x](void) { this->Checkpoint_(*x); });
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::StopCheckpoint_(void)
+    {
+        if(this->checkpoint_thread_.joinable())
+        {
+            this->checkpoint_thread_.join();
+        }
+
+        this->iter_ctrl_.SetCheckpoint(0, std::function<void(void)>());
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::Checkpoint_(
+        const VectorType& x)
+    {
+        log_debug(this, "IterativeLinearSolver::Checkpoint_()", (const void*&)x);
+
+        // The buffers are still in use, if the previous checkpoint is not written yet
+        if(this->checkpoint_thread_.joinable())
+        {
+            this->checkpoint_thread_.join();
+        }
+
+        this->checkpoint_vec_.CopyFrom(x);
+        this->checkpoint_ctrl_ = this->iter_ctrl_;
+
+        // Each file replaces the previous one only once it is complete. The state is
+        // written last, such that it never describes a newer iterate than the one on disk
+        this->checkpoint_thread_ = std::thread([this](void) {
+            write_checkpoint(this->checkpoint_vec_, this->checkpoint_name_ + ".x");
+
+            if(_get_backend_descriptor()->rank == 0)
+            {
+                this->checkpoint_ctrl_.WriteStateToFile(this->checkpoint_name_);
+            }
+        });
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::Verbose(int verb)
     {
@@ -365,12 +608,45 @@ namespace rocalution
         return 0;
     }
 
+    template <class OperatorType, class VectorType, typename ValueType>
+    void IterativeLinearSolver<OperatorType, VectorType, ValueType>::NormBegin_(
+        const VectorType& vec, DotFuture<ValueType>* norm)
+    {
+        log_debug(this, "IterativeLinearSolver::NormBegin_()", (const void*&)vec, norm);
+
+        // Only the L2 norm is a dot product, the other norms are computed in NormEnd_()
+        if(this->res_norm_ == 2)
+        {
+            vec.DotBegin(vec, norm);
+        }
+    }
+
+    template <class OperatorType, class VectorType, typename ValueType>
+    ValueType IterativeLinearSolver<OperatorType, VectorType, ValueType>::NormEnd_(
+        const VectorType& vec, DotFuture<ValueType>* norm)
+    {
+        log_debug(this, "IterativeLinearSolver::NormEnd_()", (const void*&)vec, norm);
+
+        if(this->res_norm_ == 2)
+        {
+            return sqrt(vec.DotEnd(norm));
+        }
+
+        return this->Norm_(vec);
+    }
+
     template <class OperatorType, class VectorType, typename ValueType>
     void IterativeLinearSolver<OperatorType, VectorType, ValueType>::Solve(const VectorType& rhs,
                                                                            VectorType*       x)
     {
         log_debug(this, "IterativeLinearSolver::Solve()", (const void*&)rhs, x);
 
+        // Wait for an asynchronous build on the host
+        if(this->tasks_ != NULL)
+        {
+            this->tasks_->Wait();
+        }
+
         assert(x != NULL);
         assert(x != &rhs);
         assert(this->op_ != NULL);
@@ -382,6 +658,8 @@ namespace rocalution
             this->iter_ctrl_.PrintInit();
         }
 
+        this->StartCheckpoint_(x);
+
         if(this->precond_ == NULL)
         {
             this->SolveNonPrecond_(rhs, x);
@@ -391,6 +669,8 @@ namespace rocalution
             this->SolvePrecond_(rhs, x);
         }
 
+        this->StopCheckpoint_();
+
         if(this->verb_ > 0)
         {
             this->iter_ctrl_.PrintStatus();
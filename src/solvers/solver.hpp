@@ -28,9 +28,14 @@
 #include "../base/local_vector.hpp"
 #include "iter_ctrl.hpp"
 
+#include <string>
+#include <thread>
+
 namespace rocalution
 {
 
+    class HostTaskGroup;
+
     /** \ingroup solver_module
   * \class Solver
   * \brief Base class for all solvers and preconditioners
@@ -54,6 +59,10 @@ namespace rocalution
   * - ReBuildNumeric() to only re-build the solver numerically (if possible).
   * - MoveToHost() and MoveToAccelerator() to offload the solver (including
   *   preconditioners and sub-solvers) to the host/accelerator.
+  * - BuildMoveToAcceleratorAsync() and Sync() to build the solver asynchronously. If no
+  *   accelerator is available, solvers of local operators are built by a task on the
+  *   host with half of the OpenMP threads, while the caller continues with the other
+  *   half. Sync() waits for the build to finish.
   *
   * \tparam OperatorType - can be LocalMatrix, GlobalMatrix or LocalStencil
   * \tparam VectorType - can be LocalVector or GlobalVector
@@ -87,10 +96,17 @@ namespace rocalution
         /** \brief Build the solver (data allocation, structure and numerical computation) */
         virtual void Build(void);
 
-        /** \brief Build the solver and move it to the accelerator asynchronously */
+        /** \brief Build the solver and move it to the accelerator asynchronously
+      * \details
+      * Without accelerator, the solver of a LocalMatrix is built by a host task in the
+      * background, which uses half of the OpenMP threads of the caller. Until Sync(), the
+      * caller is limited to the other half. The solver must not be modified or destroyed
+      * before Sync() has been called by the same thread. Solvers of a GlobalMatrix, or
+      * with a single OpenMP thread, are built synchronously.
+      */
         virtual void BuildMoveToAcceleratorAsync(void);
 
-        /** \brief Synchronize the solver */
+        /** \brief Synchronize the solver, i.e. wait for an asynchronous build */
         virtual void Sync(void);
 
         /** \brief Rebuild the solver only with numerical computation (no allocation or data
@@ -129,6 +145,9 @@ namespace rocalution
         /** \brief Verbose flag */
         int verb_;
 
+        /** \brief Asynchronous build tasks on the host */
+        HostTaskGroup* tasks_;
+
         /** \brief Print starting message of the solver */
         virtual void PrintStart_(void) const = 0;
         /** \brief Print ending message of the solver */
@@ -155,6 +174,8 @@ namespace rocalution
   * - Verbose() sets the level of verbose output of the solver (0 - no output, 2 - detailed
   * output, including residual and iteration information).
   * - SetPreconditioner() sets the preconditioning.
+  * - SaveState(), LoadState() and SetCheckpoint() write and read the state of a solve,
+  * such that an interrupted solve can be continued.
   *
   * All iterative solvers are controlled based on
   * - Absolute stopping criteria, when \f$|r_{k}|_{L_{p}} \lt \epsilon_{abs}\f$
@@ -228,6 +249,56 @@ namespace rocalution
         /** \brief Write the history to file */
         void RecordHistory(const std::string filename) const;
 
+        /** \brief Save the state of the solver
+      * \details
+      * The state consists of the iterate \p x and the iteration control, i.e. the
+      * iteration count, the initial residual and the residual history. The iteration
+      * control is written to the binary file \p filename, the iterate to
+      * \p filename.x by WriteFileBinary().
+      */
+        void SaveState(const std::string filename, const VectorType& x);
+
+        /** \brief Load the state of the solver
+      * \details
+      * Reads a state, that has been written by SaveState() or SetCheckpoint(), into \p x
+      * and the iteration control. The next call of Solve() continues the iteration count
+      * and uses the initial residual of the state for the relative stopping criteria.
+      * The solver has to be built before, as Build() resets the iteration control.
+      *
+      * Krylov subspaces and preconditioners are not part of the state. The solver
+      * restarts from the iterate, such that e.g. CG continues like a restarted method.
+      * Preconditioners are recomputed from the operator by Build().
+      */
+        void LoadState(const std::string filename, VectorType* x);
+
+        /** \brief Write checkpoints of the state during Solve()
+      * \details
+      * Every \p frequency iterations, the state is written to \p filename, see
+      * SaveState(). The iterate is copied to the host and written by a background
+      * thread, while the solver continues to iterate. Solve() returns after the last
+      * checkpoint has been written. A \p frequency of 0 disables the checkpoints.
+      * The files are written under temporary names and renamed once complete, the state
+      * file last, such that an interrupted write leaves the previous checkpoint intact.
+      *
+      * Restarted methods, such as GMRES, only update the iterate at a restart. Their
+      * checkpoints contain the iterate of the last restart.
+      *
+      * \par Example
+      * \code{.cpp}
+      *   ls.SetOperator(mat);
+      *   ls.Build();
+      *
+      *   if(restart == true)
+      *   {
+      *       ls.LoadState("solver.state", &x);
+      *   }
+      *
+      *   ls.SetCheckpoint("solver.state", 100);
+      *   ls.Solve(rhs, &x);
+      * \endcode
+      */
+        void SetCheckpoint(const std::string filename, int frequency);
+
         /** \brief Set the solver verbosity output */
         virtual void Verbose(int verb = 1);
 
@@ -269,6 +340,30 @@ namespace rocalution
 
         /** \brief Computes the vector norm */
         ValueType Norm_(const VectorType& vec);
+        /** \brief Starts computing the vector norm, \p vec must not change until NormEnd_() */
+        void NormBegin_(const VectorType& vec, DotFuture<ValueType>* norm);
+        /** \brief Completes the vector norm started by NormBegin_() */
+        ValueType NormEnd_(const VectorType& vec, DotFuture<ValueType>* norm);
+
+        /** \brief Start writing checkpoints of \p x, if enabled */
+        void StartCheckpoint_(const VectorType* x);
+        /** \brief Wait for the last checkpoint and stop writing checkpoints */
+        void StopCheckpoint_(void);
+
+    private:
+        // Copies x to the host and writes it in the background
+        void Checkpoint_(const VectorType& x);
+
+        // Checkpoint file and frequency
+        std::string checkpoint_name_;
+        int         checkpoint_freq_;
+
+        // Host copy of the iterate and iteration control, that are being written
+        VectorType       checkpoint_vec_;
+        IterationControl checkpoint_ctrl_;
+
+        // Background thread writing the checkpoint
+        std::thread checkpoint_thread_;
     };
 
     /** \ingroup solver_module
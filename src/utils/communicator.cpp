@@ -25,6 +25,7 @@
 #include "def.hpp"
 #include "log_mpi.hpp"
 
+#include <algorithm>
 #include <complex>
 
 namespace rocalution
@@ -113,6 +114,61 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_allreduce_single_sum(double*     local,
+                                                  double*     global,
+                                                  MRequest*   request,
+                                                  const void* comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, 1, MPI_DOUBLE, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_single_sum(float*      local,
+                                                  float*      global,
+                                                  MRequest*   request,
+                                                  const void* comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, 1, MPI_FLOAT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_single_sum(std::complex<double>* local,
+                                                  std::complex<double>* global,
+                                                  MRequest*             request,
+                                                  const void*           comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, 1, MPI_DOUBLE_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_single_sum(std::complex<float>* local,
+                                                  std::complex<float>* global,
+                                                  MRequest*            request,
+                                                  const void*          comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, 1, MPI_COMPLEX, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    template <>
+    void communication_async_allreduce_single_sum(int*        local,
+                                                  int*        global,
+                                                  MRequest*   request,
+                                                  const void* comm)
+    {
+        int status = MPI_Iallreduce(
+            local, global, 1, MPI_INT, MPI_SUM, *(MPI_Comm*)comm, &request->req);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     template <>
     void communication_async_recv(
         double* buf, int count, int source, int tag, MRequest* request, const void* comm)
@@ -169,6 +225,15 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_recv(
+        long* buf, int count, int source, int tag, MRequest* request, const void* comm)
+    {
+        int status = MPI_Irecv(buf, count, MPI_LONG, source, tag, *(MPI_Comm*)comm, &request->req);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     template <>
     void communication_async_send(
         double* buf, int count, int dest, int tag, MRequest* request, const void* comm)
@@ -219,6 +284,15 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    template <>
+    void communication_async_send(
+        long* buf, int count, int dest, int tag, MRequest* request, const void* comm)
+    {
+        int status = MPI_Isend(buf, count, MPI_LONG, dest, tag, *(MPI_Comm*)comm, &request->req);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
     void communication_syncall(int count, MRequest* requests)
     {
         int status = MPI_Waitall(count, &requests[0].req, MPI_STATUSES_IGNORE);
@@ -226,6 +300,275 @@ namespace rocalution
         CHECK_MPI_ERROR(status, __FILE__, __LINE__);
     }
 
+    HaloExchange::HaloExchange(int         elem_size,
+                               int         nrecv,
+                               const int*  recvs,
+                               const int*  recv_offset,
+                               int         nsend,
+                               const int*  sends,
+                               const int*  send_offset,
+                               const void* comm)
+    {
+        assert(elem_size > 0);
+
+        int tag = 0;
+
+        this->elem_size_ = elem_size;
+        this->active_    = false;
+
+        this->recv_buffer_.resize(static_cast<size_t>(nrecv > 0 ? recv_offset[nrecv] : 0)
+                                  * elem_size);
+        this->send_buffer_.resize(static_cast<size_t>(nsend > 0 ? send_offset[nsend] : 0)
+                                  * elem_size);
+
+        // Only processes that exchange values get a request
+        for(int i = 0; i < nrecv; ++i)
+        {
+            int boundary_nnz = recv_offset[i + 1] - recv_offset[i];
+
+            if(boundary_nnz > 0)
+            {
+                MPI_Request req;
+
+                int status = MPI_Recv_init(this->recv_buffer_.data() + recv_offset[i] * elem_size,
+                                           boundary_nnz * elem_size,
+                                           MPI_BYTE,
+                                           recvs[i],
+                                           tag,
+                                           *(MPI_Comm*)comm,
+                                           &req);
+                CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+                this->recv_req_.push_back(req);
+            }
+        }
+
+        for(int i = 0; i < nsend; ++i)
+        {
+            int boundary_nnz = send_offset[i + 1] - send_offset[i];
+
+            if(boundary_nnz > 0)
+            {
+                MPI_Request req;
+
+                int status = MPI_Send_init(this->send_buffer_.data() + send_offset[i] * elem_size,
+                                           boundary_nnz * elem_size,
+                                           MPI_BYTE,
+                                           sends[i],
+                                           tag,
+                                           *(MPI_Comm*)comm,
+                                           &req);
+                CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+                this->send_req_.push_back(req);
+            }
+        }
+    }
+
+    HaloExchange::~HaloExchange()
+    {
+        // The requests are gone with MPI, if the parallel manager outlives it
+        int finalized;
+        MPI_Finalized(&finalized);
+
+        if(finalized == 0)
+        {
+            for(size_t i = 0; i < this->recv_req_.size(); ++i)
+            {
+                MPI_Request_free(&this->recv_req_[i]);
+            }
+
+            for(size_t i = 0; i < this->send_req_.size(); ++i)
+            {
+                MPI_Request_free(&this->send_req_[i]);
+            }
+        }
+    }
+
+    int HaloExchange::GetElementSize(void) const
+    {
+        return this->elem_size_;
+    }
+
+    void* HaloExchange::GetSendBuffer(void)
+    {
+        return this->send_buffer_.data();
+    }
+
+    const void* HaloExchange::GetRecvBuffer(void) const
+    {
+        return this->recv_buffer_.data();
+    }
+
+    void HaloExchange::StartRecv(void)
+    {
+        // The buffers are shared by all exchanges of this size
+        assert(this->active_ == false);
+
+        this->active_ = true;
+
+        if(this->recv_req_.size() > 0)
+        {
+            int status = MPI_Startall(static_cast<int>(this->recv_req_.size()),
+                                      this->recv_req_.data());
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void HaloExchange::StartSend(void)
+    {
+        assert(this->active_ == true);
+
+        if(this->send_req_.size() > 0)
+        {
+            int status = MPI_Startall(static_cast<int>(this->send_req_.size()),
+                                      this->send_req_.data());
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void HaloExchange::Wait(void)
+    {
+        this->active_ = false;
+
+        if(this->recv_req_.size() > 0)
+        {
+            int status = MPI_Waitall(static_cast<int>(this->recv_req_.size()),
+                                     this->recv_req_.data(),
+                                     MPI_STATUSES_IGNORE);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+
+        if(this->send_req_.size() > 0)
+        {
+            int status = MPI_Waitall(static_cast<int>(this->send_req_.size()),
+                                     this->send_req_.data(),
+                                     MPI_STATUSES_IGNORE);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void communication_allgather_single(long long local, long long* global, const void* comm)
+    {
+        int status
+            = MPI_Allgather(&local, 1, MPI_LONG_LONG, global, 1, MPI_LONG_LONG, *(MPI_Comm*)comm);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    void communication_alltoall_single(const int* send, int* recv, const void* comm)
+    {
+        int status = MPI_Alltoall(
+            const_cast<int*>(send), 1, MPI_INT, recv, 1, MPI_INT, *(MPI_Comm*)comm);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    void communication_comm_split(int color, MComm* newcomm, const void* comm)
+    {
+        int rank;
+        int status = MPI_Comm_rank(*(MPI_Comm*)comm, &rank);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+        status = MPI_Comm_split(
+            *(MPI_Comm*)comm, color < 0 ? MPI_UNDEFINED : color, rank, &newcomm->comm);
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    void communication_comm_free(MComm* comm)
+    {
+        if(comm->comm != MPI_COMM_NULL)
+        {
+            int status = MPI_Comm_free(&comm->comm);
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void communication_file_open(const std::string filename,
+                                 bool              write,
+                                 MFile*            file,
+                                 const void*       comm)
+    {
+        int mode = (write == true) ? MPI_MODE_CREATE | MPI_MODE_WRONLY : MPI_MODE_RDONLY;
+
+        int status = MPI_File_open(
+            *(MPI_Comm*)comm, (char*)filename.c_str(), mode, MPI_INFO_NULL, &file->file);
+
+        if(status != MPI_SUCCESS)
+        {
+            LOG_INFO("Cannot open file: " << filename);
+            FATAL_ERROR(__FILE__, __LINE__);
+        }
+
+        if(write == true)
+        {
+            status = MPI_File_set_size(file->file, 0);
+
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+        }
+    }
+
+    void communication_file_close(MFile* file)
+    {
+        int status = MPI_File_close(&file->file);
+
+        CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+    }
+
+    // MPI counts are int, large blocks are transferred in chunks
+    static const long long _file_chunk_size = 1 << 30;
+
+    void communication_file_write_at(MFile*      file,
+                                     long long   offset,
+                                     const void* buf,
+                                     long long   size)
+    {
+        const char* ptr = static_cast<const char*>(buf);
+
+        while(size > 0)
+        {
+            int count = static_cast<int>(std::min(size, _file_chunk_size));
+
+            MPI_Status info;
+            int        status
+                = MPI_File_write_at(file->file, offset, (void*)ptr, count, MPI_BYTE, &info);
+
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+            offset += count;
+            ptr += count;
+            size -= count;
+        }
+    }
+
+    void communication_file_read_at(MFile* file, long long offset, void* buf, long long size)
+    {
+        char* ptr = static_cast<char*>(buf);
+
+        while(size > 0)
+        {
+            int count = static_cast<int>(std::min(size, _file_chunk_size));
+
+            MPI_Status info;
+            int        status = MPI_File_read_at(file->file, offset, ptr, count, MPI_BYTE, &info);
+
+            CHECK_MPI_ERROR(status, __FILE__, __LINE__);
+
+            int nread;
+            MPI_Get_count(&info, MPI_BYTE, &nread);
+
+            if(nread != count)
+            {
+                LOG_INFO("Cannot read from file, unexpected end of file");
+                FATAL_ERROR(__FILE__, __LINE__);
+            }
+
+            offset += count;
+            ptr += count;
+            size -= count;
+        }
+    }
+
     template void
         communication_allreduce_single_sum<double>(double local, double* global, const void* comm);
     template void
@@ -26,6 +26,9 @@
 
 #include <mpi.h>
 
+#include <string>
+#include <vector>
+
 namespace rocalution
 {
 
@@ -34,11 +37,28 @@ namespace rocalution
         MPI_Request req;
     };
 
+    struct MFile
+    {
+        MPI_File file;
+    };
+
+    struct MComm
+    {
+        MPI_Comm comm;
+    };
+
     // TODO make const what ever possible
 
     template <typename ValueType>
     void communication_allreduce_single_sum(ValueType local, ValueType* global, const void* comm);
 
+    // Non-blocking, local and global have to stay valid until the request is completed
+    template <typename ValueType>
+    void communication_async_allreduce_single_sum(ValueType*  local,
+                                                  ValueType*  global,
+                                                  MRequest*   request,
+                                                  const void* comm);
+
     template <typename ValueType>
     void communication_async_recv(
         ValueType* buf, int count, int source, int tag, MRequest* request, const void* comm);
@@ -49,6 +69,75 @@ namespace rocalution
 
     void communication_syncall(int count, MRequest* requests);
 
+    void communication_allgather_single(long long local, long long* global, const void* comm);
+
+    // Sends send[p] to process p and receives the value of process p in recv[p]
+    void communication_alltoall_single(const int* send, int* recv, const void* comm);
+
+    // Collective, processes with a negative color are not part of any new communicator,
+    // the ranks keep their order
+    void communication_comm_split(int color, MComm* newcomm, const void* comm);
+    void communication_comm_free(MComm* comm);
+
+    // Collective, the file is truncated when opened for writing
+    void communication_file_open(const std::string filename,
+                                 bool              write,
+                                 MFile*            file,
+                                 const void*       comm);
+    void communication_file_close(MFile* file);
+
+    // Positioned, non-collective access to size bytes at the byte offset of the file
+    void communication_file_write_at(MFile*      file,
+                                     long long   offset,
+                                     const void* buf,
+                                     long long   size);
+    void communication_file_read_at(MFile* file, long long offset, void* buf, long long size);
+
+    // Persistent exchange of the ghost values of a parallel manager, for values of
+    // elem_size bytes. The requests and buffers are set up once and reused by every
+    // exchange, such that an exchange only starts and completes the requests. Only one
+    // exchange can be in flight at a time, it has to be completed by Wait() before the
+    // next one starts.
+    class HaloExchange
+    {
+    public:
+        HaloExchange(int         elem_size,
+                     int         nrecv,
+                     const int*  recvs,
+                     const int*  recv_offset,
+                     int         nsend,
+                     const int*  sends,
+                     const int*  send_offset,
+                     const void* comm);
+        ~HaloExchange();
+
+        int GetElementSize(void) const;
+
+        // Boundary values, ordered as the boundary index of the parallel manager
+        void* GetSendBuffer(void);
+        // Ghost values, ordered as the ghost part of the parallel manager
+        const void* GetRecvBuffer(void) const;
+
+        // Starts the receives
+        void StartRecv(void);
+        // Starts the sends, the send buffer has to be packed before
+        void StartSend(void);
+        // Waits for all receives and sends
+        void Wait(void);
+
+    private:
+        int elem_size_;
+
+        // Exchange started and not yet completed
+        bool active_;
+
+        std::vector<MPI_Request> recv_req_;
+        std::vector<MPI_Request> send_req_;
+
+        std::vector<char> recv_buffer_;
+        std::vector<char> send_buffer_;
+    };
+
 } // namespace rocalution
 
 #endif // ROCALUTION_UTILS_COMMUNICATOR_HPP_
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#ifndef ROCALUTION_UTILS_PATTERN_CACHE_HPP_
+#define ROCALUTION_UTILS_PATTERN_CACHE_HPP_
+
+#include <list>
+#include <mutex>
+#include <vector>
+
+namespace rocalution
+{
+
+    /** \private
+  * Cache for data that only depends on the sparsity pattern of a matrix, such as
+  * colorings, ILU(p) level patterns or format decisions. Entries are identified by a
+  * pattern key, which is built from the matrix sizes and the row and column keys (see
+  * LocalMatrix::Key). The keys are hashes, thus different patterns can share a key. Each
+  * entry also keeps its pattern (row offsets followed by column indices), which is only
+  * compared if the key matches.
+  * AMG aggregates are not cached, since they depend on the strong connections and
+  * therefore on the values.
+  * The cache is bounded by the bytes of its keys, patterns and data. When it is full, the
+  * oldest entries are dropped, entries larger than the bound are not cached at all. The
+  * cache can be accessed concurrently, e.g. by smoothers that are built in parallel.
+  */
+    template <typename DataType>
+    class PatternCache
+    {
+    public:
+        explicit PatternCache(size_t max_bytes)
+            : max_bytes_(max_bytes)
+            , bytes_(0)
+        {
+        }
+
+        /** Returns true if an entry with a pattern of the given size (row offsets and column
+          * indices) can be cached, so that callers can skip reading patterns that are too
+          * large */
+        bool Fits(size_t pattern_size) const
+        {
+            return pattern_size * sizeof(int) <= this->max_bytes_;
+        }
+
+        /** Copies the data cached for key and pattern to data, returns false if none */
+        bool Find(const std::vector<long int>& key,
+                  const std::vector<int>&      pattern,
+                  DataType*                    data) const
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            for(typename std::list<Entry>::const_iterator it = this->entries_.begin();
+                it != this->entries_.end();
+                ++it)
+            {
+                if((it->key == key) && (it->pattern == pattern))
+                {
+                    *data = it->data;
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /** Adds or replaces data for key and pattern, data_bytes is the memory held by data.
+          * Drops the oldest entries if the cache is full */
+        void Insert(const std::vector<long int>& key,
+                    const std::vector<int>&      pattern,
+                    const DataType&              data,
+                    size_t                       data_bytes)
+        {
+            size_t bytes
+                = key.size() * sizeof(long int) + pattern.size() * sizeof(int) + data_bytes;
+
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            for(typename std::list<Entry>::iterator it = this->entries_.begin();
+                it != this->entries_.end();
+                ++it)
+            {
+                if((it->key == key) && (it->pattern == pattern))
+                {
+                    this->bytes_ -= it->bytes;
+                    this->entries_.erase(it);
+
+                    break;
+                }
+            }
+
+            if(bytes > this->max_bytes_)
+            {
+                return;
+            }
+
+            while(this->bytes_ + bytes > this->max_bytes_)
+            {
+                this->bytes_ -= this->entries_.front().bytes;
+                this->entries_.pop_front();
+            }
+
+            Entry entry;
+
+            entry.key     = key;
+            entry.pattern = pattern;
+            entry.data    = data;
+            entry.bytes   = bytes;
+
+            this->entries_.push_back(entry);
+            this->bytes_ += bytes;
+        }
+
+        /** Returns the number of entries */
+        size_t GetSize(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            return this->entries_.size();
+        }
+
+        /** Returns the bytes held by all entries */
+        size_t GetBytes(void) const
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            return this->bytes_;
+        }
+
+        /** Removes all entries */
+        void Clear(void)
+        {
+            std::lock_guard<std::mutex> lock(this->mutex_);
+
+            this->entries_.clear();
+            this->bytes_ = 0;
+        }
+
+    private:
+        struct Entry
+        {
+            std::vector<long int> key;
+            std::vector<int>      pattern;
+            DataType              data;
+            size_t                bytes;
+        };
+
+        size_t           max_bytes_;
+        size_t           bytes_;
+        std::list<Entry> entries_;
+
+        mutable std::mutex mutex_;
+    };
+
+} // namespace rocalution
+
+#endif // ROCALUTION_UTILS_PATTERN_CACHE_HPP_